@@ -130,7 +130,7 @@ private:
 class AntiAD_Player : public PlayerScript
 {
 public:
-    AntiAD_Player() : PlayerScript("AntiAD_Player") { }
+    AntiAD_Player() : PlayerScript("AntiAD_Player", GetOverriddenHooks<AntiAD_Player>()) { }
 
     void OnChat(Player* player, uint32 /*type*/, uint32 /*lang*/, std::string& msg) override
     {
@@ -26,7 +26,7 @@
 class Boss_Announcer_Player : public PlayerScript
 {
 public:
-    Boss_Announcer_Player() : PlayerScript("Boss_Announcer_Player") {}
+    Boss_Announcer_Player() : PlayerScript("Boss_Announcer_Player", GetOverriddenHooks<Boss_Announcer_Player>()) {}
 
     void OnCreatureKill(Player* player, Creature* creature) override
     {
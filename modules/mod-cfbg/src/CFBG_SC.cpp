@@ -138,7 +138,7 @@ public:
 class CFBG_Player : public PlayerScript
 {
 public:
-    CFBG_Player() : PlayerScript("CFBG_Player") { }
+    CFBG_Player() : PlayerScript("CFBG_Player", GetOverriddenHooks<CFBG_Player>()) { }
 
     void OnLogin(Player* player) override
     {
@@ -24,7 +24,7 @@
 class DuelReset_Player : public PlayerScript
 {
 public:
-    DuelReset_Player() : PlayerScript("DuelReset_Player") { }
+    DuelReset_Player() : PlayerScript("DuelReset_Player", GetOverriddenHooks<DuelReset_Player>()) { }
 
     // Called when a duel starts (after 3s countdown)
     void OnDuelStart(Player* player1, Player* player2) override
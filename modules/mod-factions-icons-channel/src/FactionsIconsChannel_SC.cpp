@@ -26,7 +26,7 @@
 class FactionsIconsChannel_Player : public PlayerScript
 {
 public:
-    FactionsIconsChannel_Player() : PlayerScript("FactionsIconsChannel_Player") { }
+    FactionsIconsChannel_Player() : PlayerScript("FactionsIconsChannel_Player", GetOverriddenHooks<FactionsIconsChannel_Player>()) { }
 
     void OnChat(Player* player, uint32 /*type*/, uint32 /*lang*/, std::string& msg, Channel* channel) override
     {
@@ -25,7 +25,7 @@
 class GMChatColor_Player : public PlayerScript
 {
 public:
-    GMChatColor_Player() : PlayerScript("GMChatColor_Player") { }
+    GMChatColor_Player() : PlayerScript("GMChatColor_Player", GetOverriddenHooks<GMChatColor_Player>()) { }
 
     void OnChat(Player* player, uint32 /*type*/, uint32 /*lang*/, std::string& msg) override
     {
@@ -299,7 +299,7 @@ private:
 class InstanceBuff_Player : public PlayerScript
 {
 public:
-    InstanceBuff_Player() : PlayerScript("InstanceBuff_Player") { }
+    InstanceBuff_Player() : PlayerScript("InstanceBuff_Player", GetOverriddenHooks<InstanceBuff_Player>()) { }
 
     void OnMapChanged(Player* player) override
     {
@@ -152,7 +152,7 @@ private:
 class LevelReward_Player : public PlayerScript
 {
 public:
-    LevelReward_Player() : PlayerScript("LevelReward_Player") { }
+    LevelReward_Player() : PlayerScript("LevelReward_Player", GetOverriddenHooks<LevelReward_Player>()) { }
 
     void OnLevelChanged(Player* player, uint8 oldLevel) override
     {
@@ -27,7 +27,7 @@
 class NotifyMuted_Player : public PlayerScript
 {
 public:
-    NotifyMuted_Player() : PlayerScript("NotifyMuted_Player") {}
+    NotifyMuted_Player() : PlayerScript("NotifyMuted_Player", GetOverriddenHooks<NotifyMuted_Player>()) {}
 
     void OnChat(Player* player, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Player* receiver) override
     {
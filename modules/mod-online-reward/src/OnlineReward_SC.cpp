@@ -25,7 +25,7 @@
 class OnlineReward_Player : public PlayerScript
 {
 public:
-    OnlineReward_Player() : PlayerScript("OnlineReward_Player") { }
+    OnlineReward_Player() : PlayerScript("OnlineReward_Player", GetOverriddenHooks<OnlineReward_Player>()) { }
 
     void OnLogin(Player* player) override
     {
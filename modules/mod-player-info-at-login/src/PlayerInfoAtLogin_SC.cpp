@@ -27,7 +27,7 @@
 class PlayerInfoAtLogin_Player : public PlayerScript
 {
 public:
-    PlayerInfoAtLogin_Player() : PlayerScript("PlayerInfoAtLogin_Player") {}
+    PlayerInfoAtLogin_Player() : PlayerScript("PlayerInfoAtLogin_Player", GetOverriddenHooks<PlayerInfoAtLogin_Player>()) {}
 
     void OnLogin(Player* player) override
     {
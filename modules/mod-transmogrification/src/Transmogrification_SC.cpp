@@ -46,7 +46,7 @@ public:
 class Transmogrification_Player : public PlayerScript
 {
 public:
-    Transmogrification_Player() : PlayerScript("Player_Transmogrify") { }
+    Transmogrification_Player() : PlayerScript("Player_Transmogrify", GetOverriddenHooks<Transmogrification_Player>()) { }
 
     void OnAfterSetVisibleItemSlot(Player* player, uint8 slot, Item* item) override
     {
@@ -264,7 +264,7 @@ public:
 class Vip_Player : public PlayerScript
 {
 public:
-    Vip_Player() : PlayerScript("Vip_Player") { }
+    Vip_Player() : PlayerScript("Vip_Player", GetOverriddenHooks<Vip_Player>()) { }
 
     void OnGiveXP(Player* player, uint32& amount, Unit* /*victim*/) override
     {
@@ -380,7 +380,7 @@ public:
 class Vip_AllCreature : public AllCreatureScript
 {
 public:
-    Vip_AllCreature() : AllCreatureScript("Vip_AllCreature") { }
+    Vip_AllCreature() : AllCreatureScript("Vip_AllCreature", GetOverriddenHooks<Vip_AllCreature>()) { }
 
     bool CanCreatureSendListInventory(Player* player, Creature* creature, uint32 /*vendorEntry*/) override
     {
@@ -20,7 +20,6 @@
 
 #include "BoundingIntervalHierarchy.h"
 #include "G3D/Array.h"
-#include "G3D/Set.h"
 #include "G3D/Table.h"
 
 template<class T, class BoundsFunc = BoundsTrait<T>>
@@ -65,66 +64,135 @@ class WH_COMMON_API BIHWrap
 
     typedef G3D::Array<const T*> ObjArray;
 
+    // Cells with at most this many models are scanned linearly, also the amount of
+    // models inserted since the last build that is tolerated before rebuilding
+    static constexpr uint32 MAX_UNINDEXED_OBJECTS = 8;
+
     BIH m_tree;
-    ObjArray m_objects;
+    ObjArray m_objects;                 // [0, m_treeSize) indexed by m_tree, the rest is scanned linearly, removed slots are nullptr
     G3D::Table<const T*, uint32> m_obj2Idx;
-    G3D::Set<const T*> m_objects_to_push;
-    int unbalanced_times;
+    uint32 m_treeSize;
+    uint32 m_removedCount;
+
+    [[nodiscard]] bool NeedsRebuild() const
+    {
+        return m_objects.size() - m_treeSize > MAX_UNINDEXED_OBJECTS || m_removedCount * 2 > m_treeSize + MAX_UNINDEXED_OBJECTS;
+    }
 
 public:
-    BIHWrap() : unbalanced_times(0) { }
+    BIHWrap() : m_treeSize(0), m_removedCount(0) { }
 
+    // O(1), new model is scanned linearly until the next rebuild
     void insert(const T& obj)
     {
-        ++unbalanced_times;
-        m_objects_to_push.insert(&obj);
+        if (m_obj2Idx.containsKey(&obj))
+        {
+            return;
+        }
+
+        m_obj2Idx.set(&obj, m_objects.size());
+        m_objects.append(&obj);
     }
 
+    // O(1), the slot is left empty so the tree built over it stays valid
     void remove(const T& obj)
     {
-        ++unbalanced_times;
         uint32 Idx = 0;
         const T* temp;
         if (m_obj2Idx.getRemove(&obj, temp, Idx))
         {
             m_objects[Idx] = nullptr;
-        }
-        else
-        {
-            m_objects_to_push.remove(&obj);
+            if (Idx < m_treeSize)
+            {
+                ++m_removedCount;
+            }
+            else
+            {
+                // not indexed yet, just drop it from the unindexed tail
+                const T* last = m_objects.pop();
+                if (Idx < uint32(m_objects.size()))
+                {
+                    m_objects[Idx] = last;
+                    m_obj2Idx.set(last, Idx);
+                }
+            }
         }
     }
 
+    // Compacts removed slots and indexes pending models, no-op for untouched cells
     void balance()
     {
-        if (unbalanced_times == 0)
+        if (m_objects.size() == m_treeSize && m_removedCount == 0)
         {
             return;
         }
 
-        unbalanced_times = 0;
-        m_objects.fastClear();
-        m_obj2Idx.getKeys(m_objects);
-        m_objects_to_push.getMembers(m_objects);
-        //assert that m_obj2Idx has all the keys
+        ObjArray alive;
+        for (const T* obj : m_objects)
+        {
+            if (obj)
+            {
+                m_obj2Idx.set(obj, alive.size());
+                alive.append(obj);
+            }
+        }
+
+        ObjArray::swap(m_objects, alive);
+        m_removedCount = 0;
+
+        // small cells are cheaper to scan than to walk a tree
+        if (uint32(m_objects.size()) <= MAX_UNINDEXED_OBJECTS)
+        {
+            m_tree.build(ObjArray(), BoundsFunc::GetBounds2);
+            m_treeSize = 0;
+            return;
+        }
 
         m_tree.build(m_objects, BoundsFunc::GetBounds2);
+        m_treeSize = m_objects.size();
     }
 
     template<typename RayCallback>
     void intersectRay(const G3D::Ray& ray, RayCallback& intersectCallback, float& maxDist, bool stopAtFirstHit)
     {
-        balance();
-        MDLCallback<RayCallback> temp_cb(intersectCallback, m_objects.getCArray(), m_objects.size());
-        m_tree.intersectRay(ray, temp_cb, maxDist, stopAtFirstHit);
+        if (NeedsRebuild())
+        {
+            balance();
+        }
+
+        if (m_treeSize)
+        {
+            MDLCallback<RayCallback> temp_cb(intersectCallback, m_objects.getCArray(), m_treeSize);
+            m_tree.intersectRay(ray, temp_cb, maxDist, stopAtFirstHit);
+        }
+
+        for (uint32 i = m_treeSize; i < uint32(m_objects.size()); ++i)
+        {
+            if (intersectCallback(ray, *m_objects[i], maxDist, stopAtFirstHit) && stopAtFirstHit)
+            {
+                return;
+            }
+        }
     }
 
     template<typename IsectCallback>
     void intersectPoint(const G3D::Vector3& point, IsectCallback& intersectCallback)
     {
-        balance();
-        MDLCallback<IsectCallback> callback(intersectCallback, m_objects.getCArray(), m_objects.size());
-        m_tree.intersectPoint(point, callback);
+        if (NeedsRebuild())
+        {
+            balance();
+        }
+
+        if (m_treeSize)
+        {
+            MDLCallback<IsectCallback> callback(intersectCallback, m_objects.getCArray(), m_treeSize);
+            m_tree.intersectPoint(point, callback);
+        }
+
+        for (uint32 i = m_treeSize; i < uint32(m_objects.size()); ++i)
+        {
+            intersectCallback(point, *m_objects[i]);
+        }
     }
 };
 
@@ -22,6 +22,7 @@
 #include "Random.h"
 #include <algorithm>
 #include <iterator>
+#include <list>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -227,6 +228,43 @@ namespace Warhead::Containers
         return false;
     }
 
+    /**
+     * @brief Stable sort of a list that is already nearly sorted, e.g. when only a few elements changed their key
+     *
+     * Each out of order element is moved back behind the first element it does not precede, O(n) when only
+     * a few moved. Once that costs more than a few steps per element it falls back to list::sort, so the
+     * worst case stays O(n log n). Like list::sort it only relinks nodes, iterators stay valid.
+     *
+     * @param list List to sort
+     * @param pred Strict weak ordering, true if the first element goes before the second
+    */
+    template<class T, class Allocator, class Predicate>
+    void SortNearlySorted(std::list<T, Allocator>& list, Predicate pred)
+    {
+        if (list.size() < 2)
+            return;
+
+        std::size_t budget = list.size() * 4;
+        for (auto itr = std::next(list.begin()); itr != list.end();)
+        {
+            auto current = itr++;
+            auto insertPos = current;
+            while (insertPos != list.begin() && pred(*current, *std::prev(insertPos)))
+            {
+                if (!budget--)
+                {
+                    list.sort(pred);
+                    return;
+                }
+
+                --insertPos;
+            }
+
+            if (insertPos != current)
+                list.splice(insertPos, list, current);
+        }
+    }
+
     /*
      * Returns a pointer to mapped value (or the value itself if map stores pointers)
      */
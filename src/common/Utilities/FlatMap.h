@@ -0,0 +1,115 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WARHEAD_FLATMAP_H
+#define WARHEAD_FLATMAP_H
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Warhead
+{
+    /*
+     * Sorted vector with the subset of the std::map interface used for small,
+     * frequently iterated maps. Lookups are binary searches over contiguous
+     * memory and iteration is in key order like std::map, but any insertion
+     * or erase invalidates all iterators - do not modify while iterating.
+     */
+    template<class Key, class Value, class Compare = std::less<Key>>
+    class FlatMap
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<Key, Value>;
+        using container_type = std::vector<value_type>;
+        using size_type = typename container_type::size_type;
+        using iterator = typename container_type::iterator;
+        using const_iterator = typename container_type::const_iterator;
+
+        iterator begin() { return _storage.begin(); }
+        iterator end() { return _storage.end(); }
+        const_iterator begin() const { return _storage.begin(); }
+        const_iterator end() const { return _storage.end(); }
+        const_iterator cbegin() const { return _storage.cbegin(); }
+        const_iterator cend() const { return _storage.cend(); }
+
+        [[nodiscard]] bool empty() const { return _storage.empty(); }
+        [[nodiscard]] size_type size() const { return _storage.size(); }
+        void clear() { _storage.clear(); }
+        void reserve(size_type count) { _storage.reserve(count); }
+
+        iterator lower_bound(Key const& key) { return std::lower_bound(_storage.begin(), _storage.end(), key, KeyCompare()); }
+        const_iterator lower_bound(Key const& key) const { return std::lower_bound(_storage.begin(), _storage.end(), key, KeyCompare()); }
+
+        iterator find(Key const& key)
+        {
+            iterator itr = lower_bound(key);
+            return itr != _storage.end() && !Compare()(key, itr->first) ? itr : _storage.end();
+        }
+
+        const_iterator find(Key const& key) const
+        {
+            const_iterator itr = lower_bound(key);
+            return itr != _storage.end() && !Compare()(key, itr->first) ? itr : _storage.end();
+        }
+
+        [[nodiscard]] size_type count(Key const& key) const { return find(key) != _storage.end() ? 1 : 0; }
+
+        Value& operator[](Key const& key)
+        {
+            iterator itr = lower_bound(key);
+            if (itr == _storage.end() || Compare()(key, itr->first))
+                itr = _storage.emplace(itr, key, Value());
+
+            return itr->second;
+        }
+
+        std::pair<iterator, bool> insert(value_type const& value)
+        {
+            iterator itr = lower_bound(value.first);
+            if (itr != _storage.end() && !Compare()(value.first, itr->first))
+                return { itr, false };
+
+            return { _storage.insert(itr, value), true };
+        }
+
+        iterator erase(const_iterator itr) { return _storage.erase(itr); }
+
+        size_type erase(Key const& key)
+        {
+            iterator itr = find(key);
+            if (itr == _storage.end())
+                return 0;
+
+            _storage.erase(itr);
+            return 1;
+        }
+
+    private:
+        struct KeyCompare
+        {
+            bool operator()(value_type const& left, Key const& right) const { return Compare()(left.first, right); }
+        };
+
+        container_type _storage;
+    };
+}
+
+#endif // WARHEAD_FLATMAP_H
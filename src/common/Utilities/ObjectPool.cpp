@@ -0,0 +1,165 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+#include "Metric.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <new>
+
+namespace
+{
+    constexpr std::size_t SizeClassGranularity = 64;
+    constexpr std::size_t SizeClassCount = 64;                  // up to 4096 bytes
+    constexpr uint32 MaxCachedBlocksPerClass = 256;
+
+    std::atomic<uint64> poolAllocations{ 0 };
+    std::atomic<uint64> poolReused{ 0 };
+    std::atomic<uint64> poolOversized{ 0 };
+    std::atomic<int64> poolCachedBytes{ 0 };
+
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+    };
+
+    // trivially destructible, it is still usable while other thread_local objects are destroyed
+    struct ThreadCache
+    {
+        struct FreeList
+        {
+            FreeBlock* Head;
+            uint32 Count;
+        };
+
+        std::array<FreeList, SizeClassCount> Lists;
+        bool Released;
+    };
+
+    thread_local ThreadCache threadCache{};
+
+    // gives the cached blocks back to the global allocator when the thread exits
+    struct ThreadCacheRelease
+    {
+        bool Armed;
+
+        ~ThreadCacheRelease()
+        {
+            threadCache.Released = true;
+
+            if (!Armed)
+                return;
+
+            for (std::size_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+            {
+                ThreadCache::FreeList& list = threadCache.Lists[sizeClass];
+                poolCachedBytes -= int64(list.Count * (sizeClass + 1) * SizeClassGranularity);
+
+                while (FreeBlock* block = list.Head)
+                {
+                    list.Head = block->Next;
+                    ::operator delete(block);
+                }
+
+                list.Count = 0;
+            }
+        }
+    };
+
+    thread_local ThreadCacheRelease threadCacheRelease{};
+
+    constexpr std::size_t GetSizeClass(std::size_t size)
+    {
+        return size ? (size - 1) / SizeClassGranularity : 0;
+    }
+}
+
+void* Warhead::ObjectPool::Allocate(std::size_t size)
+{
+    std::size_t sizeClass = GetSizeClass(size);
+    if (sizeClass >= SizeClassCount)
+    {
+        poolOversized.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+
+    poolAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    ThreadCache::FreeList& list = threadCache.Lists[sizeClass];
+    if (FreeBlock* block = list.Head)
+    {
+        list.Head = block->Next;
+        --list.Count;
+
+        poolReused.fetch_add(1, std::memory_order_relaxed);
+        poolCachedBytes.fetch_sub(int64((sizeClass + 1) * SizeClassGranularity), std::memory_order_relaxed);
+        return block;
+    }
+
+    // blocks always have the full size of their class, any object of that class can reuse them
+    return ::operator new((sizeClass + 1) * SizeClassGranularity);
+}
+
+void Warhead::ObjectPool::Deallocate(void* ptr, std::size_t size)
+{
+    if (!ptr)
+        return;
+
+    std::size_t sizeClass = GetSizeClass(size);
+    if (sizeClass >= SizeClassCount)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    ThreadCache::FreeList& list = threadCache.Lists[sizeClass];
+    if (threadCache.Released || list.Count >= MaxCachedBlocksPerClass)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    // arm the release guard, the blocks cached by this thread are freed on exit
+    threadCacheRelease.Armed = true;
+
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+    block->Next = list.Head;
+    list.Head = block;
+    ++list.Count;
+
+    poolCachedBytes.fetch_add(int64((sizeClass + 1) * SizeClassGranularity), std::memory_order_relaxed);
+}
+
+void Warhead::ObjectPool::ReportStats()
+{
+    METRIC_VALUE("object_pool_allocations", poolAllocations.exchange(0));
+    METRIC_VALUE("object_pool_reused", poolReused.exchange(0));
+    METRIC_VALUE("object_pool_oversized", poolOversized.exchange(0));
+    METRIC_VALUE("object_pool_cached_bytes", uint64(std::max<int64>(poolCachedBytes.load(), 0)));
+}
+
+uint32 Warhead::ObjectPool::GetThreadCachedBlocks(std::size_t size)
+{
+    std::size_t sizeClass = GetSizeClass(size);
+    return sizeClass < SizeClassCount ? threadCache.Lists[sizeClass].Count : 0;
+}
+
+int64 Warhead::ObjectPool::GetCachedBytes()
+{
+    return poolCachedBytes.load();
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _OBJECT_POOL_H
+#define _OBJECT_POOL_H
+
+#include "Define.h"
+#include <cstddef>
+
+// Pooling is skipped when WARHEAD_DISABLE_OBJECT_POOLS is defined or the build uses
+// AddressSanitizer, so use-after-free and leaks of pooled objects are reported again
+#if !defined(WARHEAD_DISABLE_OBJECT_POOLS) && defined(__SANITIZE_ADDRESS__)
+#  define WARHEAD_DISABLE_OBJECT_POOLS
+#endif
+
+#if !defined(WARHEAD_DISABLE_OBJECT_POOLS) && defined(__has_feature)
+#  if __has_feature(address_sanitizer)
+#    define WARHEAD_DISABLE_OBJECT_POOLS
+#  endif
+#endif
+
+/*
+ * Size class pools for short lived objects that are created and destroyed in large numbers,
+ * like spells and auras.
+ *
+ * Every thread keeps a free list per size class (multiples of 64 bytes, up to 4096 bytes).
+ * Deleted objects are put on the free list of the deleting thread and reused by its next
+ * allocation of the same size class. The memory itself comes from the global operator new,
+ * so an object may be deleted on another thread than the one that created it (deferred
+ * deletions), it is simply cached by that thread instead. Free lists are capped, the rest
+ * goes back to the global allocator.
+ */
+namespace Warhead::ObjectPool
+{
+    WH_COMMON_API void* Allocate(std::size_t size);
+    WH_COMMON_API void Deallocate(void* ptr, std::size_t size);
+
+    // Sends allocation counters since the previous call and the cached memory to the metrics
+    WH_COMMON_API void ReportStats();
+
+    // Blocks the calling thread has cached for objects of the given size
+    WH_COMMON_API uint32 GetThreadCachedBlocks(std::size_t size);
+
+    // Memory cached by all threads, in bytes
+    WH_COMMON_API int64 GetCachedBytes();
+}
+
+#ifndef WARHEAD_DISABLE_OBJECT_POOLS
+// Routes new/delete of a class (and of the classes derived from it) through Warhead::ObjectPool.
+// Classes with derived types must have a virtual destructor so delete sees the real size.
+#define WARHEAD_POOLED_OBJECT                                                                         \
+    static void* operator new(std::size_t size) { return Warhead::ObjectPool::Allocate(size); }       \
+    static void operator delete(void* ptr, std::size_t size) { Warhead::ObjectPool::Deallocate(ptr, size); }
+#else
+#define WARHEAD_POOLED_OBJECT
+#endif
+
+#endif // _OBJECT_POOL_H
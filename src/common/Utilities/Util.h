@@ -27,6 +27,7 @@
 #include <cctype>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -405,34 +406,51 @@ struct StringCompareLessI_T
 
 //handler for operations on large flags
 // simple class for not-modifyable list
+// copies share the same list until one of them is modified
 template <typename T>
 class HookList
 {
     typedef typename std::list<T>::iterator ListIterator;
 private:
-    typename std::list<T> m_list;
+    std::shared_ptr<std::list<T>> m_list;
+
+    std::list<T>& Modify()
+    {
+        if (!m_list)
+            m_list = std::make_shared<std::list<T>>();
+        else if (m_list.use_count() > 1)
+            m_list = std::make_shared<std::list<T>>(*m_list);
+
+        return *m_list;
+    }
+
+    std::list<T>& List() const
+    {
+        static std::list<T> empty;
+        return m_list ? *m_list : empty;
+    }
 public:
     HookList<T>& operator+=(T t)
     {
-        m_list.push_back(t);
+        Modify().push_back(t);
         return *this;
     }
     HookList<T>& operator-=(T t)
     {
-        m_list.remove(t);
+        Modify().remove(t);
         return *this;
     }
     size_t size()
     {
-        return m_list.size();
+        return m_list ? m_list->size() : 0;
     }
     ListIterator begin()
     {
-        return m_list.begin();
+        return List().begin();
     }
     ListIterator end()
     {
-        return m_list.end();
+        return List().end();
     }
 };
 
@@ -23,6 +23,7 @@
 * authentication server
 */
 
+#include "AuthCryptoPool.h"
 #include "AuthSocketMgr.h"
 #include "Common.h"
 #include "Config.h"
@@ -56,6 +57,7 @@ void StopDB();
 void SignalHandler(std::weak_ptr<Warhead::Asio::IoContext> ioContextRef, boost::system::error_code const& error, int signalNumber);
 void KeepDatabaseAliveHandler(std::weak_ptr<Warhead::Asio::DeadlineTimer> dbPingTimerRef, int32 dbPingInterval, boost::system::error_code const& error);
 void BanExpiryHandler(std::weak_ptr<Warhead::Asio::DeadlineTimer> banExpiryCheckTimerRef, int32 banExpiryCheckInterval, boost::system::error_code const& error);
+void CryptoStatsHandler(std::weak_ptr<Warhead::Asio::DeadlineTimer> cryptoStatsTimerRef, int32 cryptoStatsInterval, boost::system::error_code const& error);
 
 /// Print out the usage string for this program on the console.
 void usage(const char* prog)
@@ -142,7 +144,7 @@ int main(int argc, char** argv)
 
     std::shared_ptr<void> sRealmListHandle(nullptr, [](void*) { sRealmList->Close(); });
 
-    if (sRealmList->GetRealms().empty())
+    if (sRealmList->GetRealms()->empty())
     {
         LOG_ERROR("server.authserver", "No valid realms specified.");
         return 1;
@@ -158,6 +160,11 @@ int main(int argc, char** argv)
 
     std::string bindIp = sConfigMgr->GetOption<std::string>("BindIP", "0.0.0.0");
 
+    // Start the crypto workers before the network, sessions hand their SRP6 math over to them
+    sAuthCryptoPool.Start(sConfigMgr->GetOption<uint32>("Crypto.Threads", 2), sConfigMgr->GetOption<uint32>("Crypto.MaxQueued", 1000));
+
+    std::shared_ptr<void> sAuthCryptoPoolHandle(nullptr, [](void*) { sAuthCryptoPool.Stop(); });
+
     if (!sAuthSocketMgr.StartNetwork(*ioContext, bindIp, port))
     {
         LOG_ERROR("server.authserver", "Failed to initialize network");
@@ -187,9 +194,18 @@ int main(int argc, char** argv)
     banExpiryCheckTimer->expires_from_now(boost::posix_time::seconds(banExpiryCheckInterval));
     banExpiryCheckTimer->async_wait(std::bind(&BanExpiryHandler, std::weak_ptr<Warhead::Asio::DeadlineTimer>(banExpiryCheckTimer), banExpiryCheckInterval, std::placeholders::_1));
 
+    int32 cryptoStatsInterval = sConfigMgr->GetOption<int32>("Crypto.StatsInterval", 0);
+    std::shared_ptr<Warhead::Asio::DeadlineTimer> cryptoStatsTimer = std::make_shared<Warhead::Asio::DeadlineTimer>(*ioContext);
+    if (cryptoStatsInterval > 0)
+    {
+        cryptoStatsTimer->expires_from_now(boost::posix_time::seconds(cryptoStatsInterval));
+        cryptoStatsTimer->async_wait(std::bind(&CryptoStatsHandler, std::weak_ptr<Warhead::Asio::DeadlineTimer>(cryptoStatsTimer), cryptoStatsInterval, std::placeholders::_1));
+    }
+
     // Start the io service worker loop
     ioContext->run();
 
+    cryptoStatsTimer->cancel();
     banExpiryCheckTimer->cancel();
     dbPingTimer->cancel();
 
@@ -262,3 +278,17 @@ void BanExpiryHandler(std::weak_ptr<Warhead::Asio::DeadlineTimer> banExpiryCheck
         }
     }
 }
+
+void CryptoStatsHandler(std::weak_ptr<Warhead::Asio::DeadlineTimer> cryptoStatsTimerRef, int32 cryptoStatsInterval, boost::system::error_code const& error)
+{
+    if (!error)
+    {
+        if (std::shared_ptr<Warhead::Asio::DeadlineTimer> cryptoStatsTimer = cryptoStatsTimerRef.lock())
+        {
+            sAuthCryptoPool.LogStats();
+
+            cryptoStatsTimer->expires_from_now(boost::posix_time::seconds(cryptoStatsInterval));
+            cryptoStatsTimer->async_wait(std::bind(&CryptoStatsHandler, cryptoStatsTimerRef, cryptoStatsInterval, std::placeholders::_1));
+        }
+    }
+}
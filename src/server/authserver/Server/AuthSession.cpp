@@ -18,6 +18,7 @@
 #include "AuthSession.h"
 #include "AES.h"
 #include "AuthCodes.h"
+#include "AuthCryptoPool.h"
 #include "Config.h"
 #include "CryptoGenerics.h"
 #include "CryptoHash.h"
@@ -25,8 +26,10 @@
 #include "DatabaseEnv.h"
 #include "Errors.h"
 #include "IPLocation.h"
+#include "IpNetwork.h"
 #include "Log.h"
 #include "RealmList.h"
+#include "RealmListCache.h"
 #include "SecretMgr.h"
 #include "StringConvert.h"
 #include "TOTP.h"
@@ -137,6 +140,13 @@ std::unordered_map<uint8, AuthHandler> AuthSession::InitHandlers()
 
 std::unordered_map<uint8, AuthHandler> const Handlers = AuthSession::InitHandlers();
 
+namespace
+{
+    // Character counts shared by all sessions of an account, dropped on every logon since they may have changed in the world meanwhile
+    CharacterCountCache _characterCountCache;
+    RealmListPacketCache _realmListPacketCache;
+}
+
 void AccountInfo::LoadResult(Field* fields)
 {
     //          0        1          2           3             4             5
@@ -185,10 +195,32 @@ bool AuthSession::Update()
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    ProcessCryptoResult();
 
     return true;
 }
 
+void AuthSession::RunCrypto(std::function<void()>&& work, std::function<void()>&& callback)
+{
+    _cryptoCallback = std::move(callback);
+    _cryptoResult = sAuthCryptoPool.Enqueue([self = shared_from_this(), work = std::move(work)]() { work(); });
+
+    // already done here if the pool is disabled or full
+    ProcessCryptoResult();
+}
+
+void AuthSession::ProcessCryptoResult()
+{
+    if (!_cryptoResult.valid() || _cryptoResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return;
+
+    _cryptoResult.get();
+
+    std::function<void()> callback = std::move(_cryptoCallback);
+    _cryptoCallback = nullptr;
+    callback();
+}
+
 void AuthSession::CheckIpCallback(PreparedQueryResult result)
 {
     if (result)
@@ -406,49 +438,62 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
         }
     }
 
-    _srp6.emplace(_accountInfo.Login,
-        fields[12].Get<Binary, Warhead::Crypto::SRP6::SALT_LENGTH>(),
-        fields[13].Get<Binary, Warhead::Crypto::SRP6::VERIFIER_LENGTH>());
-
-    // Fill the response packet with the result
-    if (AuthHelper::IsAcceptedClientBuild(_build))
+    if (!AuthHelper::IsAcceptedClientBuild(_build))
     {
-        pkt << uint8(WOW_SUCCESS);
+        pkt << uint8(WOW_FAIL_VERSION_INVALID);
+        SendPacket(pkt);
+        return;
+    }
 
-        pkt.append(_srp6->B);
-        pkt << uint8(1);
-        pkt.append(_srp6->g);
-        pkt << uint8(32);
-        pkt.append(_srp6->N);
-        pkt.append(_srp6->s);
-        pkt.append(VersionChallenge.data(), VersionChallenge.size());
-        pkt << uint8(securityFlags);            // security flags (0x0...0x04)
-
-        if (securityFlags & 0x01)               // PIN input
-        {
-            pkt << uint32(0);
-            pkt << uint64(0) << uint64(0);      // 16 bytes hash?
-        }
+    // B = 3v + g^b is a modular exponentiation, keep it away from the network thread.
+    // Nothing touches _srp6 until the callback runs, _status stays STATUS_CLOSED meanwhile
+    RunCrypto([this, login = _accountInfo.Login,
+        salt = fields[12].Get<Binary, Warhead::Crypto::SRP6::SALT_LENGTH>(),
+        verifier = fields[13].Get<Binary, Warhead::Crypto::SRP6::VERIFIER_LENGTH>()]()
+    {
+        _srp6.emplace(login, salt, verifier);
+    },
+    [this, pkt, securityFlags]() mutable
+    {
+        SendLogonChallenge(pkt, securityFlags);
+    });
+}
 
-        if (securityFlags & 0x02)               // Matrix input
-        {
-            pkt << uint8(0);
-            pkt << uint8(0);
-            pkt << uint8(0);
-            pkt << uint8(0);
-            pkt << uint64(0);
-        }
+void AuthSession::SendLogonChallenge(ByteBuffer& pkt, uint8 securityFlags)
+{
+    pkt << uint8(WOW_SUCCESS);
 
-        if (securityFlags & 0x04)               // Security token input
-            pkt << uint8(1);
+    pkt.append(_srp6->B);
+    pkt << uint8(1);
+    pkt.append(_srp6->g);
+    pkt << uint8(32);
+    pkt.append(_srp6->N);
+    pkt.append(_srp6->s);
+    pkt.append(VersionChallenge.data(), VersionChallenge.size());
+    pkt << uint8(securityFlags);            // security flags (0x0...0x04)
 
-        LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] account {} is using '{}' locale ({})",
-            ipAddress, port, _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
+    if (securityFlags & 0x01)               // PIN input
+    {
+        pkt << uint32(0);
+        pkt << uint64(0) << uint64(0);      // 16 bytes hash?
+    }
 
-        _status = STATUS_LOGON_PROOF;
+    if (securityFlags & 0x02)               // Matrix input
+    {
+        pkt << uint8(0);
+        pkt << uint8(0);
+        pkt << uint8(0);
+        pkt << uint8(0);
+        pkt << uint64(0);
     }
-    else
-        pkt << uint8(WOW_FAIL_VERSION_INVALID);
+
+    if (securityFlags & 0x04)               // Security token input
+        pkt << uint8(1);
+
+    LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] account {} is using '{}' locale ({})",
+        GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
+
+    _status = STATUS_LOGON_PROOF;
 
     SendPacket(pkt);
 }
@@ -470,21 +515,44 @@ bool AuthSession::HandleLogonProof()
         return false;
     }
 
+    // The read buffer moves on while the proof is verified, take what we need from it now
+    bool sentToken = (logonProof->securityFlags & 0x04);
+    Optional<uint32> token;
+    if (sentToken && _totpSecret)
+    {
+        uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
+        std::string tokenStr(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
+        GetReadBuffer().ReadCompleted(sizeof(size) + size);
+
+        token = Warhead::StringTo<uint32>(tokenStr);
+    }
+
+    std::shared_ptr<Optional<SessionKey>> K = std::make_shared<Optional<SessionKey>>();
+
+    RunCrypto([this, K, A = logonProof->A, clientM = logonProof->clientM]()
+    {
+        *K = _srp6->VerifyChallengeResponse(A, clientM);
+    },
+    [this, K, A = logonProof->A, clientM = logonProof->clientM, crcHash = logonProof->crc_hash, sentToken, token]()
+    {
+        LogonProofCallback(A, clientM, crcHash, sentToken, token, *K);
+    });
+
+    return true;
+}
+
+void AuthSession::LogonProofCallback(Warhead::Crypto::SRP6::EphemeralKey const& A, Warhead::Crypto::SHA1::Digest const& clientM,
+    Warhead::Crypto::SHA1::Digest const& crcHash, bool sentToken, Optional<uint32> token, Optional<SessionKey> const& K)
+{
     // Check if SRP6 results match (password is correct), else send an error
-    if (Optional<SessionKey> K = _srp6->VerifyChallengeResponse(logonProof->A, logonProof->clientM))
+    if (K)
     {
         _sessionKey = *K;
         // Check auth token
         bool tokenSuccess = false;
-        bool sentToken = (logonProof->securityFlags & 0x04);
         if (sentToken && _totpSecret)
         {
-            uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
-            std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
-            GetReadBuffer().ReadCompleted(sizeof(size) + size);
-
-            uint32 incomingToken = *Warhead::StringTo<uint32>(token);
-            tokenSuccess = Warhead::Crypto::TOTP::ValidateToken(*_totpSecret, incomingToken);
+            tokenSuccess = token && Warhead::Crypto::TOTP::ValidateToken(*_totpSecret, *token);
             memset(_totpSecret->data(), 0, _totpSecret->size());
         }
         else if (!sentToken && !_totpSecret)
@@ -497,16 +565,16 @@ bool AuthSession::HandleLogonProof()
             packet << uint8(WOW_FAIL_UNKNOWN_ACCOUNT);
             packet << uint16(0);    // LoginFlags, 1 has account message
             SendPacket(packet);
-            return true;
+            return;
         }
 
-        if (!VerifyVersion(logonProof->A.data(), logonProof->A.size(), logonProof->crc_hash, false))
+        if (!VerifyVersion(A.data(), A.size(), crcHash, false))
         {
             ByteBuffer packet;
             packet << uint8(AUTH_LOGON_PROOF);
             packet << uint8(WOW_FAIL_VERSION_INVALID);
             SendPacket(packet);
-            return true;
+            return;
         }
 
         LOG_DEBUG("server.authserver", "'{}:{}' User '{}' successfully authenticated", GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login);
@@ -519,8 +587,11 @@ bool AuthSession::HandleLogonProof()
         stmt->SetArguments(_sessionKey, address, GetLocaleByName(_localizationName), _os, _accountInfo.Login);
         LoginDatabase.DirectExecute(stmt);
 
+        // Characters may have been created or deleted since the account logged in last time
+        _characterCountCache.Clear(_accountInfo.Id);
+
         // Finish SRP6 and send the final result to the client
-        Warhead::Crypto::SHA1::Digest M2 = Warhead::Crypto::SRP6::GetSessionVerifier(logonProof->A, logonProof->clientM, _sessionKey);
+        Warhead::Crypto::SHA1::Digest M2 = Warhead::Crypto::SRP6::GetSessionVerifier(A, clientM, _sessionKey);
 
         ByteBuffer packet;
         if (_expversion & POST_BC_EXP_FLAG)                 // 2.x and 3.x clients
@@ -605,8 +676,6 @@ bool AuthSession::HandleLogonProof()
             }
         }
     }
-
-    return true;
 }
 
 bool AuthSession::HandleReconnectChallenge()
@@ -706,6 +775,7 @@ bool AuthSession::HandleReconnectProof()
         pkt << uint8(WOW_SUCCESS);
         pkt << uint16(0);    // LoginFlags, 1 has account message
         SendPacket(pkt);
+        _characterCountCache.Clear(_accountInfo.Id);
         _status = STATUS_AUTHED;
         return true;
     }
@@ -721,6 +791,13 @@ bool AuthSession::HandleRealmList()
 {
     LOG_DEBUG("server.authserver", "Entering _HandleRealmList");
 
+    // Clients ask again and again while sitting at the realm screen, counts only change through a world server
+    if (Optional<CharacterCountMap> characterCounts = _characterCountCache.Get(_accountInfo.Id))
+    {
+        SendRealmList(*characterCounts);
+        return true;
+    }
+
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_REALM_CHARACTER_COUNTS);
     stmt->SetArguments(_accountInfo.Id);
 
@@ -731,7 +808,7 @@ bool AuthSession::HandleRealmList()
 
 void AuthSession::RealmListCallback(PreparedQueryResult result)
 {
-    std::map<uint32, uint8> characterCounts;
+    CharacterCountMap characterCounts;
     if (result)
     {
         do
@@ -741,11 +818,54 @@ void AuthSession::RealmListCallback(PreparedQueryResult result)
         } while (result->NextRow());
     }
 
+    static uint32 const cacheTime = sConfigMgr->GetOption<uint32>("RealmList.CharacterCountsCacheTime", 30);
+
+    _characterCountCache.Store(_accountInfo.Id, characterCounts, Seconds(cacheTime));
+    SendRealmList(characterCounts);
+}
+
+void AuthSession::SendRealmList(CharacterCountMap const& characterCounts)
+{
+    std::shared_ptr<RealmList::RealmMap const> realms = sRealmList->GetRealms();
+
+    // Clients outside of every realm's local network all get the same list but the character counts,
+    // which are patched into a copy of the shared one
+    bool externalClient = !GetRemoteIpAddress().is_loopback();
+    for (auto const& [realmHandle, realm] : *realms)
+    {
+        if (!externalClient)
+            break;
+
+        if (GetRemoteIpAddress().is_v4() && Warhead::Net::IsInNetwork(realm.LocalAddress->to_v4(), realm.LocalSubnetMask->to_v4(), GetRemoteIpAddress().to_v4()))
+            externalClient = false;
+    }
+
+    if (!externalClient)
+    {
+        ByteBuffer packet = BuildRealmList(*realms, characterCounts, false, nullptr);
+        SendPacket(packet);
+        _status = STATUS_AUTHED;
+        return;
+    }
+
+    ByteBuffer packet = _realmListPacketCache.Get(_build, _expversion, _accountInfo.SecurityLevel, realms, characterCounts,
+        [&](RealmListPacketCache::CharacterCountPositions& characterCountPositions)
+    {
+        return BuildRealmList(*realms, CharacterCountMap(), true, &characterCountPositions);
+    });
+
+    SendPacket(packet);
+    _status = STATUS_AUTHED;
+}
+
+ByteBuffer AuthSession::BuildRealmList(RealmList::RealmMap const& realms, CharacterCountMap const& characterCounts, bool externalAddresses,
+    RealmListPacketCache::CharacterCountPositions* characterCountPositions) const
+{
     // Circle through realms in the RealmList and construct the return packet (including # of user characters in each realm)
     ByteBuffer pkt;
 
     size_t RealmListSize = 0;
-    for (auto const& [realmHandle, realm] : sRealmList->GetRealms())
+    for (auto const& [realmHandle, realm] : realms)
     {
         // don't work with realms which not compatible with the client
         bool okBuild = ((_expversion & POST_BC_EXP_FLAG) && realm.Build == _build) || ((_expversion & PRE_BC_EXP_FLAG) && !AuthHelper::IsPreBCAcceptedClientBuild(realm.Build));
@@ -774,15 +894,26 @@ void AuthSession::RealmListCallback(PreparedQueryResult result)
 
         uint8 lock = (realm.AllowedSecurityLevel > _accountInfo.SecurityLevel) ? 1 : 0;
 
+        boost::asio::ip::tcp_endpoint address = externalAddresses ? boost::asio::ip::tcp_endpoint(*realm.ExternalAddress, realm.Port) : realm.GetAddressForClient(GetRemoteIpAddress());
+
+        uint8 characterCount = 0;
+        auto countItr = characterCounts.find(realm.Id.Realm);
+        if (countItr != characterCounts.end())
+            characterCount = countItr->second;
+
         pkt << uint8(realm.Type);                           // realm type
         if (_expversion & POST_BC_EXP_FLAG)                 // only 2.x and 3.x clients
             pkt << uint8(lock);                             // if 1, then realm locked
 
         pkt << uint8(flag);                                 // RealmFlags
         pkt << name;
-        pkt << boost::lexical_cast<std::string>(realm.GetAddressForClient(GetRemoteIpAddress()));
+        pkt << boost::lexical_cast<std::string>(address);
         pkt << float(realm.PopulationLevel);
-        pkt << uint8(characterCounts[realm.Id.Realm]);
+
+        if (characterCountPositions)
+            characterCountPositions->emplace_back(pkt.wpos(), realm.Id.Realm);
+
+        pkt << uint8(characterCount);
         pkt << uint8(realm.Timezone);                       // realm category
 
         if (_expversion & POST_BC_EXP_FLAG)                 // 2.x and 3.x clients
@@ -825,10 +956,14 @@ void AuthSession::RealmListCallback(PreparedQueryResult result)
     hdr << uint8(REALM_LIST);
     hdr << uint16(pkt.size() + RealmListSizeBuffer.size());
     hdr.append(RealmListSizeBuffer);                        // append RealmList's size buffer
-    hdr.append(pkt);                                        // append realms in the realmlist
-    SendPacket(hdr);
 
-    _status = STATUS_AUTHED;
+    // positions were taken relative to the realm entries
+    if (characterCountPositions)
+        for (auto& [position, realmId] : *characterCountPositions)
+            position += hdr.size();
+
+    hdr.append(pkt);                                        // append realms in the realmlist
+    return hdr;
 }
 
 bool AuthSession::VerifyVersion(uint8 const* a, int32 aLength, Warhead::Crypto::SHA1::Digest const& versionProof, bool isReconnect)
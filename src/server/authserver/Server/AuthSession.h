@@ -25,9 +25,12 @@
 #include "CryptoHash.h"
 #include "Optional.h"
 #include "QueryResult.h"
+#include "RealmListCache.h"
 #include "SRP6.h"
 #include "Socket.h"
 #include <boost/asio/ip/tcp.hpp>
+#include <functional>
+#include <future>
 #include <memory>
 
 using boost::asio::ip::tcp;
@@ -78,6 +81,8 @@ protected:
     void ReadHandler() override;
 
 private:
+    typedef RealmCharacterCountMap CharacterCountMap;
+
     bool HandleLogonChallenge();
     bool HandleLogonProof();
     bool HandleReconnectChallenge();
@@ -86,11 +91,22 @@ private:
 
     void CheckIpCallback(PreparedQueryResult result);
     void LogonChallengeCallback(PreparedQueryResult result);
+    void SendLogonChallenge(ByteBuffer& pkt, uint8 securityFlags);
+    void LogonProofCallback(Warhead::Crypto::SRP6::EphemeralKey const& A, Warhead::Crypto::SHA1::Digest const& clientM,
+        Warhead::Crypto::SHA1::Digest const& crcHash, bool sentToken, Optional<uint32> token, Optional<SessionKey> const& K);
     void ReconnectChallengeCallback(PreparedQueryResult result);
     void RealmListCallback(PreparedQueryResult result);
 
+    void SendRealmList(CharacterCountMap const& characterCounts);
+    ByteBuffer BuildRealmList(RealmList::RealmMap const& realms, CharacterCountMap const& characterCounts, bool externalAddresses,
+        RealmListPacketCache::CharacterCountPositions* characterCountPositions) const;
+
     bool VerifyVersion(uint8 const* a, int32 aLength, Warhead::Crypto::SHA1::Digest const& versionProof, bool isReconnect);
 
+    // work runs on the crypto pool, callback back on the network thread once it is done
+    void RunCrypto(std::function<void()>&& work, std::function<void()>&& callback);
+    void ProcessCryptoResult();
+
     Optional<Warhead::Crypto::SRP6> _srp6;
     SessionKey _sessionKey = {};
     std::array<uint8, 16> _reconnectProof = {};
@@ -105,6 +121,8 @@ private:
     uint8 _expversion;
 
     QueryCallbackProcessor _queryProcessor;
+    std::future<void> _cryptoResult;
+    std::function<void()> _cryptoCallback;
 };
 
 #pragma pack(push, 1)
@@ -151,15 +151,19 @@ enum CharacterDatabaseStatements : uint32
     CHAR_INS_GUILD_BANK_ITEM,
     CHAR_DEL_GUILD_BANK_ITEM,
     CHAR_DEL_GUILD_BANK_ITEMS,
+    CHAR_DEL_GUILD_BANK_ITEM_INSTANCES,
+    CHAR_SEL_GUILD_BANK_ITEMS,
     CHAR_INS_GUILD_BANK_RIGHT,
     CHAR_DEL_GUILD_BANK_RIGHTS,
     CHAR_DEL_GUILD_BANK_RIGHTS_FOR_RANK,
     CHAR_INS_GUILD_BANK_EVENTLOG,
     CHAR_DEL_GUILD_BANK_EVENTLOG,
     CHAR_DEL_GUILD_BANK_EVENTLOGS,
+    CHAR_SEL_GUILD_BANK_EVENTLOGS,
     CHAR_INS_GUILD_EVENTLOG,
     CHAR_DEL_GUILD_EVENTLOG,
     CHAR_DEL_GUILD_EVENTLOGS,
+    CHAR_SEL_GUILD_EVENTLOGS,
     CHAR_UPD_GUILD_MEMBER_PNOTE,
     CHAR_UPD_GUILD_MEMBER_OFFNOTE,
     CHAR_UPD_GUILD_MEMBER_RANK,
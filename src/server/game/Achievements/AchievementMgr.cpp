@@ -39,6 +39,7 @@
 #include "Language.h"
 #include "Map.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "ReputationMgr.h"
@@ -46,6 +47,13 @@
 #include "SpellMgr.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <atomic>
+
+static GameConfigOption<bool> const combatCriteriaEnable("Achievement.CombatCriteria", true);
+
+// Deferred criteria events since the last ReportDeferredCriteria, summed over all map threads
+static std::atomic<uint64> deferredCriteriaFolded{ 0 };
+static std::atomic<uint64> deferredCriteriaEvaluated{ 0 };
 
 bool AchievementCriteriaData::IsValid(AchievementCriteriaEntry const* criteria)
 {
@@ -496,6 +504,7 @@ void AchievementMgr::Reset()
 
     m_completedAchievements.clear();
     m_criteriaProgress.clear();
+    m_deferredCriteria.Clear();
     DeleteFromDB(m_player->GetGUID().GetCounter());
 
     // re-fill data
@@ -546,6 +555,8 @@ void AchievementMgr::DeleteFromDB(ObjectGuid::LowType lowguid)
 
 void AchievementMgr::SaveToDB(CharacterDatabaseTransaction trans)
 {
+    FlushDeferredCriteria();
+
     if (!m_completedAchievements.empty())
     {
         for (CompletedAchievementMap::iterator iter = m_completedAchievements.begin(); iter != m_completedAchievements.end(); ++iter)
@@ -758,6 +769,46 @@ void AchievementMgr::CheckAllAchievementCriteria()
         UpdateAchievementCriteria(AchievementCriteriaTypes(i));
 }
 
+/**
+ * queues a numeric criteria event raised once per hit or heal. Events of the same type are folded
+ * (highest value or sum) and evaluated once per player update by FlushDeferredCriteria.
+ * Types that can't be folded are passed to UpdateAchievementCriteria right away.
+ */
+void AchievementMgr::DeferAchievementCriteria(AchievementCriteriaTypes type, uint32 value)
+{
+    if (!value || !combatCriteriaEnable.Get() || m_player->IsGameMaster())
+        return;
+
+    if (!DeferredCriteriaQueue::CanFold(type))
+    {
+        UpdateAchievementCriteria(type, value);
+        return;
+    }
+
+    if (sAchievementMgr->GetAchievementCriteriaByType(type)->empty())
+        return;
+
+    ++deferredCriteriaFolded;
+    m_deferredCriteria.Add(type, value);
+}
+
+void AchievementMgr::FlushDeferredCriteria()
+{
+    if (m_deferredCriteria.IsEmpty())
+        return;
+
+    deferredCriteriaEvaluated += m_deferredCriteria.Flush([this](AchievementCriteriaTypes type, uint32 value)
+    {
+        UpdateAchievementCriteria(type, value);
+    });
+}
+
+void AchievementMgr::ReportDeferredCriteria()
+{
+    METRIC_VALUE("achievement_criteria_folded", deferredCriteriaFolded.exchange(0));
+    METRIC_VALUE("achievement_criteria_evaluated", deferredCriteriaEvaluated.exchange(0));
+}
+
 static const uint32 achievIdByArenaSlot[MAX_ARENA_SLOT] = { 1057, 1107, 1108 };
 static const uint32 achievIdForDungeon[][4] =
 {
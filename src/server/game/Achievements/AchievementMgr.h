@@ -21,10 +21,12 @@
 #include "DBCEnums.h"
 #include "DBCStores.h"
 #include "DatabaseEnv.h"
+#include "DeferredCriteriaQueue.h"
 #include "ObjectGuid.h"
 #include <chrono>
 #include <map>
 #include <string>
+#include <vector>
 
 typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
 typedef std::list<AchievementEntry const*>         AchievementEntryList;
@@ -273,6 +275,9 @@ public:
     void SaveToDB(CharacterDatabaseTransaction trans);
     void ResetAchievementCriteria(AchievementCriteriaCondition condition, uint32 value, bool evenIfCriteriaComplete = false);
     void UpdateAchievementCriteria(AchievementCriteriaTypes type, uint32 miscValue1 = 0, uint32 miscValue2 = 0, Unit* unit = nullptr);
+    void DeferAchievementCriteria(AchievementCriteriaTypes type, uint32 value);
+    void FlushDeferredCriteria();
+    static void ReportDeferredCriteria();
     void CompletedAchievement(AchievementEntry const* entry);
     void CheckAllAchievementCriteria();
     void SendAllAchievementData() const;
@@ -301,6 +306,9 @@ private:
     CompletedAchievementMap m_completedAchievements;
     typedef std::map<uint32, uint32> TimedAchievementMap;
     TimedAchievementMap m_timedAchievements;      // Criteria id/time left in MS
+
+    // Per hit criteria folded until the next player update, see DeferAchievementCriteria
+    DeferredCriteriaQueue m_deferredCriteria;
 };
 
 class WH_GAME_API AchievementGlobalMgr
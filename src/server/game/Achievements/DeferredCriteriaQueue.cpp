@@ -0,0 +1,75 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DeferredCriteriaQueue.h"
+#include "Errors.h"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    bool IsHighestValueCriteria(AchievementCriteriaTypes type)
+    {
+        switch (type)
+        {
+            case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_DEALT:
+            case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_RECEIVED:
+            case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEAL_CASTED:
+            case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEALING_RECEIVED:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool IsTotalValueCriteria(AchievementCriteriaTypes type)
+    {
+        switch (type)
+        {
+            case ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED:
+            case ACHIEVEMENT_CRITERIA_TYPE_TOTAL_HEALING_RECEIVED:
+                return true;
+            default:
+                return false;
+        }
+    }
+}
+
+bool DeferredCriteriaQueue::CanFold(AchievementCriteriaTypes type)
+{
+    return IsHighestValueCriteria(type) || IsTotalValueCriteria(type);
+}
+
+void DeferredCriteriaQueue::Add(AchievementCriteriaTypes type, uint32 value)
+{
+    ASSERT(CanFold(type));
+
+    for (Entry& entry : _criteria)
+    {
+        if (entry.Type != type)
+            continue;
+
+        if (IsHighestValueCriteria(type))
+            entry.Value = std::max(entry.Value, value);
+        else
+            entry.Value = uint32(std::min<uint64>(uint64(entry.Value) + value, std::numeric_limits<uint32>::max()));
+
+        return;
+    }
+
+    _criteria.push_back({ type, value });
+}
@@ -0,0 +1,76 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DEFERRED_CRITERIA_QUEUE_H
+#define _DEFERRED_CRITERIA_QUEUE_H
+
+#include "DBCEnums.h"
+#include "Define.h"
+#include <vector>
+
+/*
+ * Numeric criteria events raised once per hit or heal, folded per criteria type until they are
+ * evaluated: the highest value for the "highest hit/heal" types, a sum capped at uint32 for the
+ * "total" types. Types that need every single event can't be folded.
+ */
+class WH_GAME_API DeferredCriteriaQueue
+{
+public:
+    [[nodiscard]] static bool CanFold(AchievementCriteriaTypes type);
+
+    // type must be one CanFold accepts
+    void Add(AchievementCriteriaTypes type, uint32 value);
+
+    // Hands every queued event to update once and returns their count. Events queued from
+    // update (completing an achievement may raise new ones) are kept for the next flush.
+    template<class Update>
+    std::size_t Flush(Update&& update)
+    {
+        std::vector<Entry> criteria;
+        criteria.swap(_criteria);
+
+        for (Entry const& entry : criteria)
+            update(entry.Type, entry.Value);
+
+        std::size_t count = criteria.size();
+
+        // keep the capacity unless new events arrived meanwhile
+        if (_criteria.empty())
+        {
+            criteria.clear();
+            _criteria.swap(criteria);
+        }
+
+        return count;
+    }
+
+    void Clear() { _criteria.clear(); }
+
+    [[nodiscard]] bool IsEmpty() const { return _criteria.empty(); }
+    [[nodiscard]] std::size_t GetSize() const { return _criteria.size(); }
+
+private:
+    struct Entry
+    {
+        AchievementCriteriaTypes Type;
+        uint32 Value;
+    };
+
+    std::vector<Entry> _criteria;
+};
+
+#endif
@@ -370,6 +370,8 @@ void ArenaTeam::DelMember(ObjectGuid guid, bool cleanDb)
         for (uint32 i = 0; i < ARENA_TEAM_END; ++i)
             player->SetArenaTeamInfoField(GetSlot(), ArenaTeamInfoType(i), 0);
     }
+    else
+        WorldSession::InvalidateLoginPrefetch(guid.GetCounter());
 
     // Only used for single member deletion, for arena team disband we use a single query for more efficiency
     if (cleanDb)
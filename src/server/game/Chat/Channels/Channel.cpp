@@ -22,6 +22,7 @@
 #include "DatabaseEnv.h"
 #include "GameConfig.h"
 #include "GameTime.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "SocialMgr.h"
@@ -38,7 +39,8 @@ Channel::Channel(std::string const& name, uint32 channelId, uint32 channelDBId,
     _channelDBId(channelDBId),
     _teamId(teamId),
     _name(name),
-    _password("")
+    _password(""),
+    _queuedBroadcastsRegistered(false)
 {
     // set special flags if built-in channel
     if (ChatChannelsEntry const* ch = sChatChannelsStore.LookupEntry(channelId)) // check whether it's a built-in channel
@@ -214,6 +216,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     pinfo.plrPtr = player;
 
     playersStore[guid] = pinfo;
+    AddMemberIgnores(player);
 
     if (_channelRights.joinMessage.length())
         ChatHandler(player->GetSession()).PSendSysMessage("{}", _channelRights.joinMessage);
@@ -278,6 +281,8 @@ void Channel::LeaveChannel(Player* player, bool send)
     bool changeowner = playersStore[guid].IsOwner();
 
     playersStore.erase(guid);
+    RemoveMemberIgnores(player);
+
     if (_announce && (!AccountMgr::IsGMAccount(player->GetSession()->GetSecurity()) ||
                       !CONF_GET_BOOL("Channel.SilentlyGMJoin")))
     {
@@ -451,6 +456,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
     if (isOnChannel)
     {
         playersStore.erase(victim);
+        RemoveMemberIgnores(bad);
         bad->LeftChannel(this);
         RemoveWatching(bad);
         LeaveNotify(bad);
@@ -927,22 +933,128 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(guid))
-            i->second.plrPtr->GetSession()->SendPacket(data);
+    SendToMembers(data, guid, ObjectGuid::Empty);
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (i->first != who)
-            i->second.plrPtr->GetSession()->SendPacket(data);
+    SendToMembers(data, ObjectGuid::Empty, who);
+}
+
+void Channel::SendToMembers(WorldPacket* data, ObjectGuid sender, ObjectGuid except)
+{
+    static GameConfigOption<uint32> const fanOutChunkSize("Channel.FanOut.ChunkSize");
+    static GameConfigOption<uint32> const fanOutMaxQueued("Channel.FanOut.MaxQueued", 20);
+
+    METRIC_TIMER("channel_fanout_time", METRIC_TAG("channel", IsConstant() ? _name : "custom"));
+
+    // members ignoring the sender, one lookup instead of one per member
+    GuidUnorderedSet const* ignoring = nullptr;
+    if (sender)
+    {
+        IgnoredByContainer::const_iterator itr = ignoredByStore.find(sender);
+        if (itr != ignoredByStore.end())
+            ignoring = &itr->second;
+    }
+
+    std::size_t sendNow = playersStore.size();
+    uint32 chunkSize = fanOutChunkSize.Get();
+    if (chunkSize && sendNow > chunkSize)
+        sendNow = chunkSize;
+
+    bool registerQueue = false;
+
+    {
+        std::lock_guard<std::mutex> guard(_queuedBroadcastsLock);
+
+        // too far behind, catch up at once instead of letting the queue grow
+        uint32 maxQueued = fanOutMaxQueued.Get();
+        if (maxQueued && _queuedBroadcasts.GetSize() >= maxQueued)
+        {
+            uint32 budget = std::numeric_limits<uint32>::max();
+            DeliverQueuedBroadcastsLocked(budget);
+            METRIC_EVENT("channel_fanout_flushed", "Channel broadcast queue flushed", _name);
+        }
+
+        bool ordered = !_queuedBroadcasts.IsEmpty();
+        std::size_t recipients = 0;
+        std::size_t sent = 0;
+        GuidVector deferred;
+
+        for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
+        {
+            if (i->first == except || (ignoring && ignoring->find(i->first) != ignoring->end()))
+                continue;
+
+            ++recipients;
+
+            // members still waiting for earlier packets of the channel get this one after them
+            if (sent < sendNow && !(ordered && _queuedBroadcasts.HasQueued(i->first)))
+            {
+                i->second.plrPtr->GetSession()->SendPacket(data);
+                ++sent;
+            }
+            else
+                deferred.push_back(i->first);
+        }
+
+        if (!deferred.empty())
+        {
+            _queuedBroadcasts.Push(*data, std::move(deferred));
+            registerQueue = !_queuedBroadcastsRegistered;
+            _queuedBroadcastsRegistered = true;
+        }
+
+        METRIC_VALUE("channel_fanout_recipients", uint64(recipients), METRIC_TAG("channel", IsConstant() ? _name : "custom"));
+    }
+
+    // outside of our lock, ChannelMgr locks the channel while delivering
+    if (registerQueue)
+        ChannelMgr::QueueBroadcasts(this);
+}
+
+std::size_t Channel::DeliverQueuedBroadcasts(uint32& budget)
+{
+    std::lock_guard<std::mutex> guard(_queuedBroadcastsLock);
+
+    DeliverQueuedBroadcastsLocked(budget);
+
+    if (_queuedBroadcasts.IsEmpty())
+        _queuedBroadcastsRegistered = false;
+
+    return _queuedBroadcasts.GetSize();
+}
+
+void Channel::DeliverQueuedBroadcastsLocked(uint32& budget)
+{
+    // members who logged out in the meantime are skipped, the ones who left still get what was sent before
+    _queuedBroadcasts.Deliver(budget, [](ObjectGuid recipient, WorldPacket const& packet)
+    {
+        if (Player* player = ObjectAccessor::FindConnectedPlayer(recipient))
+            player->GetSession()->SendPacket(&packet);
+    });
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
 {
-    if (Player* player = ObjectAccessor::FindConnectedPlayer(who))
-        player->GetSession()->SendPacket(data);
+    bool registerQueue = false;
+
+    {
+        std::lock_guard<std::mutex> guard(_queuedBroadcastsLock);
+
+        // behind the packets of the channel still queued for this player
+        if (_queuedBroadcasts.HasQueued(who))
+        {
+            _queuedBroadcasts.Push(*data, { who });
+            registerQueue = !_queuedBroadcastsRegistered;
+            _queuedBroadcastsRegistered = true;
+        }
+        else if (Player* player = ObjectAccessor::FindConnectedPlayer(who))
+            player->GetSession()->SendPacket(data);
+    }
+
+    if (registerQueue)
+        ChannelMgr::QueueBroadcasts(this);
 }
 
 void Channel::SendToAllWatching(WorldPacket* data)
@@ -1234,6 +1346,46 @@ void Channel::RemoveWatching(Player* p)
         playersWatchingStore.erase(itr);
 }
 
+void Channel::SetIgnore(ObjectGuid member, ObjectGuid ignored, bool apply)
+{
+    if (!IsOn(member))
+        return;
+
+    if (apply)
+    {
+        ignoredByStore[ignored].insert(member);
+        return;
+    }
+
+    IgnoredByContainer::iterator itr = ignoredByStore.find(ignored);
+    if (itr == ignoredByStore.end())
+        return;
+
+    itr->second.erase(member);
+    if (itr->second.empty())
+        ignoredByStore.erase(itr);
+}
+
+void Channel::AddMemberIgnores(Player* p)
+{
+    for (ObjectGuid const& ignored : p->GetSocial()->GetIgnoredGuids())
+        ignoredByStore[ignored].insert(p->GetGUID());
+}
+
+void Channel::RemoveMemberIgnores(Player* p)
+{
+    for (ObjectGuid const& ignored : p->GetSocial()->GetIgnoredGuids())
+    {
+        IgnoredByContainer::iterator itr = ignoredByStore.find(ignored);
+        if (itr == ignoredByStore.end())
+            continue;
+
+        itr->second.erase(p->GetGUID());
+        if (itr->second.empty())
+            ignoredByStore.erase(itr);
+    }
+}
+
 void Channel::ToggleModeration(Player* player)
 {
     ObjectGuid guid = player->GetGUID();
@@ -18,11 +18,14 @@
 #ifndef _CHANNEL_H
 #define _CHANNEL_H
 
+#include "ChannelBroadcastQueue.h"
 #include "Common.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
+#include <deque>
 #include <list>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -224,6 +227,12 @@ public:
     void AddWatching(Player* p);
     void RemoveWatching(Player* p);
 
+    // keeps the reverse ignore index in sync when a member changes its ignore list
+    void SetIgnore(ObjectGuid member, ObjectGuid ignored, bool apply);
+
+    // delivers queued parts of broadcasts, see SendToAll. Returns the number of broadcasts left
+    std::size_t DeliverQueuedBroadcasts(uint32& budget);
+
 private:
     // initial packet data (notify type and channel name)
     void MakeNotifyPacket(WorldPacket* data, uint8 notify_type);
@@ -267,9 +276,15 @@ private:
 
     void SendToAll(WorldPacket* data, ObjectGuid guid = ObjectGuid::Empty);
     void SendToAllButOne(WorldPacket* data, ObjectGuid who);
+    void SendToMembers(WorldPacket* data, ObjectGuid sender, ObjectGuid except);
     void SendToOne(WorldPacket* data, ObjectGuid who);
     void SendToAllWatching(WorldPacket* data);
 
+    void AddMemberIgnores(Player* p);
+    void RemoveMemberIgnores(Player* p);
+
+    void DeliverQueuedBroadcastsLocked(uint32& budget);
+
     [[nodiscard]] bool IsOn(ObjectGuid who) const { return playersStore.find(who) != playersStore.end(); }
     [[nodiscard]] bool IsBanned(ObjectGuid guid) const;
 
@@ -317,6 +332,7 @@ private:
     typedef std::unordered_map<ObjectGuid, PlayerInfo> PlayerContainer;
     typedef std::unordered_map<ObjectGuid, uint32> BannedContainer;
     typedef std::unordered_set<Player*> PlayersWatchingContainer;
+    typedef std::unordered_map<ObjectGuid, GuidUnorderedSet> IgnoredByContainer;
 
     bool _announce;
     bool _moderation;
@@ -334,5 +350,12 @@ private:
     PlayerContainer playersStore;
     BannedContainer bannedStore;
     PlayersWatchingContainer playersWatchingStore;
+    IgnoredByContainer ignoredByStore; // sender -> members ignoring him, only members with an ignore list show up here
+
+    // remaining recipients of broadcasts to big channels, and packets sent to them meanwhile. Filled from
+    // map threads (leave notifies) and drained by the world thread, so guarded by _queuedBroadcastsLock
+    ChannelBroadcastQueue _queuedBroadcasts;
+    bool _queuedBroadcastsRegistered;
+    std::mutex _queuedBroadcastsLock;
 };
 #endif
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ChannelBroadcastQueue.h"
+
+bool ChannelBroadcastQueue::HasQueued(ObjectGuid recipient) const
+{
+    return _queuedPerRecipient.find(recipient) != _queuedPerRecipient.end();
+}
+
+void ChannelBroadcastQueue::Push(WorldPacket const& packet, GuidVector recipients)
+{
+    if (recipients.empty())
+        return;
+
+    for (ObjectGuid recipient : recipients)
+        ++_queuedPerRecipient[recipient];
+
+    _broadcasts.push_back({ packet, std::move(recipients), 0 });
+}
+
+void ChannelBroadcastQueue::Deliver(uint32& budget, SendFunction const& send)
+{
+    while (budget && !_broadcasts.empty())
+    {
+        Broadcast& broadcast = _broadcasts.front();
+
+        for (; budget && broadcast.Next < broadcast.Recipients.size(); --budget)
+        {
+            ObjectGuid recipient = broadcast.Recipients[broadcast.Next++];
+
+            auto itr = _queuedPerRecipient.find(recipient);
+            if (!--itr->second)
+                _queuedPerRecipient.erase(itr);
+
+            send(recipient, broadcast.Packet);
+        }
+
+        if (broadcast.Next >= broadcast.Recipients.size())
+            _broadcasts.pop_front();
+    }
+}
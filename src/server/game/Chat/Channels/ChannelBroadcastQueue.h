@@ -0,0 +1,60 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _CHANNEL_BROADCAST_QUEUE_H
+#define _CHANNEL_BROADCAST_QUEUE_H
+
+#include "ObjectGuid.h"
+#include "WorldPacket.h"
+#include <deque>
+#include <functional>
+#include <unordered_map>
+
+/*
+ * Packets of a channel waiting for some of their recipients, delivered a few recipients at a time. A
+ * recipient with queued packets must get every later packet of the channel through the queue too,
+ * so each recipient sees the channel's packets in the order they were sent. Not thread safe.
+ */
+class WH_GAME_API ChannelBroadcastQueue
+{
+public:
+    using SendFunction = std::function<void(ObjectGuid recipient, WorldPacket const& packet)>;
+
+    [[nodiscard]] bool IsEmpty() const { return _broadcasts.empty(); }
+    [[nodiscard]] std::size_t GetSize() const { return _broadcasts.size(); }
+
+    // Whether a packet sent to this recipient now would overtake queued ones
+    [[nodiscard]] bool HasQueued(ObjectGuid recipient) const;
+
+    void Push(WorldPacket const& packet, GuidVector recipients);
+
+    // Sends queued packets in order until the budget of recipients is used up
+    void Deliver(uint32& budget, SendFunction const& send);
+
+private:
+    struct Broadcast
+    {
+        WorldPacket Packet;
+        GuidVector Recipients;
+        std::size_t Next;
+    };
+
+    std::deque<Broadcast> _broadcasts;
+    std::unordered_map<ObjectGuid, uint32 /*packets*/> _queuedPerRecipient;
+};
+
+#endif
@@ -18,6 +18,7 @@
 #include "ChannelMgr.h"
 #include "GameConfig.h"
 #include "Log.h"
+#include "Metric.h"
 #include "Player.h"
 #include "StringConvert.h"
 #include "Tokenize.h"
@@ -25,6 +26,14 @@
 
 ChannelMgr::~ChannelMgr()
 {
+    {
+        std::lock_guard<std::mutex> guard(_broadcastChannelsLock);
+        _broadcastChannels.erase(std::remove_if(_broadcastChannels.begin(), _broadcastChannels.end(), [this](Channel* channel)
+        {
+            return std::any_of(channels.begin(), channels.end(), [channel](ChannelMap::value_type const& pair) { return pair.second == channel; });
+        }), _broadcastChannels.end());
+    }
+
     for (ChannelMap::iterator itr = channels.begin(); itr != channels.end(); ++itr)
         delete itr->second;
 
@@ -163,6 +172,8 @@ Channel* ChannelMgr::GetChannel(std::string const& name, Player* player, bool pk
 uint32 ChannelMgr::_channelIdMax = 0;
 ChannelMgr::ChannelRightsMap ChannelMgr::channels_rights;
 ChannelRights ChannelMgr::channelRightsEmpty;
+std::deque<Channel*> ChannelMgr::_broadcastChannels;
+std::mutex ChannelMgr::_broadcastChannelsLock;
 
 void ChannelMgr::LoadChannelRights()
 {
@@ -223,6 +234,49 @@ void ChannelMgr::SetChannelRightsFor(const std::string& name, const uint32& flag
     channels_rights[nameStr] = ChannelRights(flags, speakDelay, joinmessage, speakmessage, moderators);
 }
 
+void ChannelMgr::QueueBroadcasts(Channel* channel)
+{
+    std::lock_guard<std::mutex> guard(_broadcastChannelsLock);
+    _broadcastChannels.push_back(channel);
+}
+
+void ChannelMgr::UpdateBroadcasts()
+{
+    static GameConfigOption<uint32> const recipientsPerTick("Channel.FanOut.RecipientsPerTick");
+
+    uint32 budget = recipientsPerTick.Get();
+    if (!budget)
+        budget = std::numeric_limits<uint32>::max();
+
+    std::size_t channels;
+    {
+        std::lock_guard<std::mutex> guard(_broadcastChannelsLock);
+        channels = _broadcastChannels.size();
+    }
+
+    // each channel gets a turn at most once per tick, unfinished ones go to the back of the line
+    uint64 queued = 0;
+    for (; budget && channels; --channels)
+    {
+        Channel* channel;
+        {
+            std::lock_guard<std::mutex> guard(_broadcastChannelsLock);
+            channel = _broadcastChannels.front();
+            _broadcastChannels.pop_front();
+        }
+
+        if (std::size_t left = channel->DeliverQueuedBroadcasts(budget))
+        {
+            queued += left;
+
+            std::lock_guard<std::mutex> guard(_broadcastChannelsLock);
+            _broadcastChannels.push_back(channel);
+        }
+    }
+
+    METRIC_VALUE("channel_fanout_queued", queued);
+}
+
 void ChannelMgr::MakeNotOnPacket(WorldPacket* data, std::string const& name)
 {
     data->Initialize(SMSG_CHANNEL_NOTIFY, 1 + name.size());
@@ -20,7 +20,9 @@
 #include "Channel.h"
 #include "Common.h"
 #include "World.h"
+#include <deque>
 #include <map>
+#include <mutex>
 #include <string>
 
 #define MAX_CHANNEL_PASS_STR 31
@@ -47,11 +49,17 @@ public:
     static void SetChannelRightsFor(const std::string& name, const uint32& flags, const uint32& speakDelay, const std::string& joinmessage, const std::string& speakmessage, const std::set<uint32>& moderators);
     static uint32 _channelIdMax;
 
+    // Broadcasts to big channels are delivered over several world ticks, see Channel::SendToAll
+    static void QueueBroadcasts(Channel* channel);
+    static void UpdateBroadcasts();
+
 private:
     ChannelMap channels;
     TeamId _teamId;
     static ChannelRightsMap channels_rights;
     static ChannelRights channelRightsEmpty; // when not found in the map, reference to this is returned
+    static std::deque<Channel*> _broadcastChannels; // channels with queued broadcasts, served round robin
+    static std::mutex _broadcastChannelsLock;
 
     void MakeNotOnPacket(WorldPacket* data, std::string const& name);
 };
@@ -156,7 +156,13 @@ void ChatHandler::SendSysMessage(uint32 entry)
 bool ChatHandler::_ParseCommands(std::string_view text)
 {
     if (Warhead::ChatCommands::TryExecuteCommand(*this, text))
+    {
+        // GM commands may change offline characters behind the back of login prefetches
+        if (!m_session || !AccountMgr::IsPlayerAccount(m_session->GetSecurity()))
+            WorldSession::InvalidateAllLoginPrefetches();
+
         return true;
+    }
 
     // Pretend commands don't exist for regular players
     if (m_session && AccountMgr::IsPlayerAccount(m_session->GetSecurity()) && !CONF_GET_BOOL("AllowPlayerCommands"))
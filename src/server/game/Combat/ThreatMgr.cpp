@@ -16,6 +16,7 @@
  */
 
 #include "ThreatMgr.h"
+#include "Containers.h"
 #include "Creature.h"
 #include "CreatureAI.h"
 #include "Map.h"
@@ -252,6 +253,30 @@ void ThreatContainer::clearReferences()
     }
 
     iThreatList.clear();
+    iThreatIndex.clear();
+}
+
+//============================================================
+
+void ThreatContainer::remove(HostileReference* hostileRef)
+{
+    auto itr = iThreatIndex.find(hostileRef->getUnitGuid());
+    if (itr == iThreatIndex.end() || *itr->second != hostileRef)
+        return;
+
+    iThreatList.erase(itr->second);
+    iThreatIndex.erase(itr);
+}
+
+//============================================================
+
+void ThreatContainer::addReference(HostileReference* hostileRef)
+{
+    // already tracked, never list a victim twice
+    if (iThreatIndex.find(hostileRef->getUnitGuid()) != iThreatIndex.end())
+        return;
+
+    iThreatIndex.emplace(hostileRef->getUnitGuid(), iThreatList.insert(iThreatList.end(), hostileRef));
 }
 
 //============================================================
@@ -261,15 +286,11 @@ HostileReference* ThreatContainer::getReferenceByTarget(Unit* victim) const
     if (!victim)
         return nullptr;
 
-    ObjectGuid const guid = victim->GetGUID();
-    for (ThreatContainer::StorageType::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-    {
-        HostileReference* ref = (*i);
-        if (ref && ref->getUnitGuid() == guid)
-            return ref;
-    }
+    auto itr = iThreatIndex.find(victim->GetGUID());
+    if (itr == iThreatIndex.end())
+        return nullptr;
 
-    return nullptr;
+    return *itr->second;
 }
 
 //============================================================
@@ -296,8 +317,10 @@ void ThreatContainer::modifyThreatPercent(Unit* victim, int32 percent)
 
 void ThreatContainer::update()
 {
-    if (iDirty && iThreatList.size() > 1)
-        iThreatList.sort(Warhead::ThreatOrderPred());
+    // only a few refs change their threat between two updates, so the list is nearly sorted.
+    // Keeps iterators (and the index) valid
+    if (iDirty)
+        Warhead::Containers::SortNearlySorted(iThreatList, Warhead::ThreatOrderPred());
 
     iDirty = false;
 }
@@ -24,6 +24,7 @@
 #include "SharedDefines.h"
 #include "UnitEvents.h"
 #include <list>
+#include <unordered_map>
 
 //==============================================================
 
@@ -168,15 +169,9 @@ public:
     [[nodiscard]] StorageType const& getThreatList() const { return iThreatList; }
 
 private:
-    void remove(HostileReference* hostileRef)
-    {
-        iThreatList.remove(hostileRef);
-    }
+    void remove(HostileReference* hostileRef);
 
-    void addReference(HostileReference* hostileRef)
-    {
-        iThreatList.push_back(hostileRef);
-    }
+    void addReference(HostileReference* hostileRef);
 
     void clearReferences();
 
@@ -184,6 +179,8 @@ private:
     void update();
 
     StorageType iThreatList;
+    // victim guid -> position in iThreatList, every ref is looked up on each threat change
+    std::unordered_map<ObjectGuid, StorageType::iterator> iThreatIndex;
     bool iDirty{false};
 };
 
@@ -139,6 +139,7 @@ namespace DisableMgr
                     {
                         SpellInfo* spellInfo = const_cast<SpellInfo*>(sSpellMgr->GetSpellInfo(entry));
                         spellInfo->AttributesEx2 |= SPELL_ATTR2_IGNORE_LINE_OF_SIGHT;
+                        sSpellMgr->UpdateSpellHotInfo(spellInfo);
                     }
 
                     break;
@@ -25,11 +25,65 @@
 #include "StringConvert.h"
 #include "StringFormat.h"
 #include "World.h"
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 namespace
 {
-    std::unordered_map<std::string /*name*/, std::string /*value*/> _configOptions;
+    // Option value parsed once for every type it may be read as
+    struct ConfigValue
+    {
+        bool Loaded{ false };
+        std::string Str;
+        Optional<bool> Bool;
+        Optional<int64> Int;
+        Optional<uint64> UInt;
+        Optional<float> Float;
+    };
+
+    // Immutable set of options. Writers build a new one and publish it, readers never lock
+    struct ConfigSnapshot
+    {
+        std::unordered_map<std::string_view /*name*/, uint32 /*slot*/> Slots;
+        std::vector<ConfigValue> Values;
+
+        ConfigValue const* Find(std::string_view optionName) const
+        {
+            auto itr = Slots.find(optionName);
+            if (itr == Slots.end() || !Values[itr->second].Loaded)
+                return nullptr;
+
+            return &Values[itr->second];
+        }
+    };
+
+    // Published snapshot, guarded by _publishLock. Every thread keeps a reference to the snapshot it reads
+    // from and only takes the lock to reload it when the generation changed, so replaced snapshots are
+    // freed once the last thread reading them moved on
+    std::shared_ptr<ConfigSnapshot const> _publishedSnapshot = std::make_shared<ConfigSnapshot const>();
+    std::mutex _publishLock;
+    std::atomic<uint32> _publishedGeneration{ 0 };
+
+    thread_local std::shared_ptr<ConfigSnapshot const> _threadSnapshot;
+    thread_local uint32 _threadGeneration = 0;
+
+    // Snapshot built by Load on the loading thread, published as a whole once all options are checked
+    thread_local ConfigSnapshot* _stagingSnapshot = nullptr;
+
+    // Every option read or added so far. Slots never go away so they stay valid across reloads, and every
+    // load adds the options missing in the config files with the default of their first read
+    struct RegisteredOption
+    {
+        std::string Name;
+        Optional<std::string> Default;
+    };
+
+    // Guarded by _writeLock
+    std::deque<RegisteredOption> _registeredOptions;
+    std::unordered_map<std::string_view /*name*/, uint32 /*slot*/> _registeredSlots;
+    std::recursive_mutex _writeLock;
 
     // Default values if no exist in config files
     constexpr auto CONF_DEFAULT_BOOL = false;
@@ -66,6 +120,140 @@ namespace
         else
             return CONF_DEFAULT_STR;
     }
+
+    // The pointer stays valid until the next GetSnapshot call of the same thread
+    inline ConfigSnapshot const* GetSnapshot()
+    {
+        if (_stagingSnapshot)
+            return _stagingSnapshot;
+
+        if (!_threadSnapshot || _threadGeneration != _publishedGeneration.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> guard(_publishLock);
+            _threadSnapshot = _publishedSnapshot;
+            _threadGeneration = _publishedGeneration.load(std::memory_order_relaxed);
+        }
+
+        return _threadSnapshot.get();
+    }
+
+    void SetValue(ConfigValue& value, std::string str)
+    {
+        value.Loaded = true;
+        value.Bool = Warhead::StringTo<bool>(str);
+        value.Int = Warhead::StringTo<int64>(str);
+        value.UInt = Warhead::StringTo<uint64>(str);
+        value.Float = Warhead::StringTo<float>(str);
+        value.Str = std::move(str);
+    }
+
+    template<typename T>
+    Optional<T> GetValue(ConfigValue const& value)
+    {
+        if constexpr (std::is_same_v<T, std::string>)
+            return value.Str;
+        else if constexpr (std::is_same_v<T, bool>)
+            return value.Bool;
+        else if constexpr (std::is_floating_point_v<T>)
+            return value.Float;
+        else if constexpr (std::is_signed_v<T>)
+        {
+            if (!value.Int || *value.Int < std::numeric_limits<T>::min() || *value.Int > std::numeric_limits<T>::max())
+                return {};
+
+            return T(*value.Int);
+        }
+        else
+        {
+            if (!value.UInt || *value.UInt > std::numeric_limits<T>::max())
+                return {};
+
+            return T(*value.UInt);
+        }
+    }
+
+    // Must hold _writeLock
+    uint32 RegisterOption(std::string_view optionName, Optional<std::string> def = {})
+    {
+        auto itr = _registeredSlots.find(optionName);
+        if (itr != _registeredSlots.end())
+        {
+            RegisteredOption& option = _registeredOptions[itr->second];
+            if (!option.Default)
+                option.Default = std::move(def);
+
+            return itr->second;
+        }
+
+        uint32 slot = uint32(_registeredOptions.size());
+        RegisteredOption& option = _registeredOptions.emplace_back(RegisteredOption{ std::string(optionName), std::move(def) });
+        _registeredSlots.emplace(option.Name, slot);
+        return slot;
+    }
+
+    // Must hold _writeLock
+    ConfigValue& GetOrCreateValue(ConfigSnapshot& snapshot, std::string_view optionName, Optional<std::string> def = {})
+    {
+        uint32 slot = RegisterOption(optionName, std::move(def));
+
+        snapshot.Slots.emplace(_registeredOptions[slot].Name, slot);
+        if (snapshot.Values.size() <= slot)
+            snapshot.Values.resize(_registeredOptions.size());
+
+        return snapshot.Values[slot];
+    }
+
+    // First read of an option missing in the config files. Registered so every following load includes it,
+    // and added right away when a load is in progress on this thread. The published snapshot is not copied
+    // for it: until the next load readers go on with their default. Returns the slot of the option
+    uint32 AddMissingOption(std::string_view optionName, std::string const& def)
+    {
+        std::lock_guard<std::recursive_mutex> guard(_writeLock);
+
+        auto itr = _registeredSlots.find(optionName);
+        bool reported = itr != _registeredSlots.end() && _registeredOptions[itr->second].Default;
+
+        if (_stagingSnapshot)
+        {
+            ConfigValue& value = GetOrCreateValue(*_stagingSnapshot, optionName, def);
+            SetValue(value, sConfigMgr->GetOption<std::string>(std::string(optionName), def));
+        }
+        else if (!reported)
+            sConfigMgr->GetOption<std::string>(std::string(optionName), def); // logs the missing option
+
+        return RegisterOption(optionName, def);
+    }
+
+    // Must hold _writeLock, takes ownership of the snapshot
+    void Publish(ConfigSnapshot const* snapshot)
+    {
+        std::lock_guard<std::mutex> guard(_publishLock);
+        _publishedSnapshot.reset(snapshot);
+        _publishedGeneration.fetch_add(1, std::memory_order_release);
+    }
+
+    // Applies a change to the snapshot being loaded, or to a copy of the published one
+    template<typename Callback>
+    void ModifySnapshot(Callback&& modify)
+    {
+        std::lock_guard<std::recursive_mutex> guard(_writeLock);
+
+        if (_stagingSnapshot)
+        {
+            modify(*_stagingSnapshot);
+            return;
+        }
+
+        std::shared_ptr<ConfigSnapshot const> published;
+        {
+            std::lock_guard<std::mutex> publishGuard(_publishLock);
+            published = _publishedSnapshot;
+        }
+
+        ConfigSnapshot* snapshot = new ConfigSnapshot(*published);
+        modify(*snapshot);
+        Publish(snapshot);
+    }
 }
 
 GameConfig* GameConfig::instance()
@@ -78,9 +266,15 @@ void GameConfig::Load(bool reload)
 {
     LOG_INFO("server.loading", "{} game configuraton:", reload ? "Reloading" : "Loading");
 
+    // readers keep the previous options until every option is loaded and checked
+    std::lock_guard<std::recursive_mutex> guard(_writeLock);
+
     LoadConfigs(reload);
     CheckOptions(reload);
 
+    Publish(_stagingSnapshot);
+    _stagingSnapshot = nullptr;
+
     LOG_INFO("server.loading", " ");
 }
 
@@ -88,18 +282,18 @@ void GameConfig::Load(bool reload)
 template<typename T>
 WH_GAME_API void GameConfig::AddOption(std::string_view optionName, Optional<T> def /*= std::nullopt*/) const
 {
-    // copy from string_view
-    std::string option{ optionName };
-
-    // Check exist option
-    auto const& itr = _configOptions.find(option);
-    if (itr != _configOptions.end())
+    ModifySnapshot([&](ConfigSnapshot& snapshot)
     {
-        LOG_ERROR("server.loading", "> GameConfig: option ({}) is already exists", optionName);
-        return;
-    }
+        // Check exist option
+        if (snapshot.Find(optionName))
+        {
+            LOG_ERROR("server.loading", "> GameConfig: option ({}) is already exists", optionName);
+            return;
+        }
 
-    _configOptions.emplace(option, sConfigMgr->GetOption<std::string>(option, GetDefaultValueString<T>(def)));
+        std::string defStr = GetDefaultValueString<T>(def);
+        SetValue(GetOrCreateValue(snapshot, optionName, defStr), sConfigMgr->GetOption<std::string>(std::string(optionName), defStr));
+    });
 }
 
 // Add option without template
@@ -118,57 +312,62 @@ void GameConfig::AddOption(std::initializer_list<std::string> const& optionList)
 template<typename T>
 WH_GAME_API T GameConfig::GetOption(std::string_view optionName, Optional<T> def /*= std::nullopt*/) const
 {
-    // copy from string_view
-    std::string option{ optionName };
-
-    // Check exist option part 1
-    auto itr = _configOptions.find(option);
-    if (itr == _configOptions.end())
+    ConfigValue const* value = GetSnapshot()->Find(optionName);
+    if (!value)
     {
-        AddOption(optionName, def);
-    }
-
-    std::string defStr = GetDefaultValueString(def);
+        AddMissingOption(optionName, GetDefaultValueString(def));
 
-    // Check exist option part 2
-    itr = _configOptions.find(option);
-    if (itr == _configOptions.end())
-    {
-        LOG_FATAL("server.loading", "> GameConfig: option ({}) is not exists. Returned ({})", optionName, defStr);
-        return GetDefaultValue<T>();
+        // only found while loading, otherwise the default is used until the next load
+        value = GetSnapshot()->Find(optionName);
+        if (!value)
+            return def ? *def : GetDefaultValue<T>();
     }
 
-    Optional<T> result = {};
-
-    if constexpr (std::is_same_v<T, std::string>)
-        result = _configOptions.at(option);
-    else
-        result = Warhead::StringTo<T>(_configOptions.at(option));
-
+    Optional<T> result = GetValue<T>(*value);
     if (!result)
     {
-        LOG_ERROR("server.loading", "> GameConfig: Bad value defined for '{}', use '{}' instead", optionName, defStr);
+        LOG_ERROR("server.loading", "> GameConfig: Bad value defined for '{}', use '{}' instead", optionName, GetDefaultValueString(def));
         return GetDefaultValue<T>();
     }
 
     return *result;
 }
 
-// Set option
 template<typename T>
-WH_GAME_API void GameConfig::SetOption(std::string_view optionName, T value) const
+WH_GAME_API T GameConfig::GetOption(GameConfigOption<T> const& option) const
 {
-    // copy from string_view
-    std::string option{ optionName };
+    ConfigSnapshot const* snapshot = GetSnapshot();
+
+    uint32 slot = option._slot.load(std::memory_order_relaxed);
+    if (slot < snapshot->Values.size() && snapshot->Values[slot].Loaded)
+        if (Optional<T> result = GetValue<T>(snapshot->Values[slot]))
+            return *result;
 
-    // Check exist option
-    auto const& itr = _configOptions.find(option);
-    if (itr == _configOptions.end())
+    // first use: options in the config files already have a slot, missing ones get one
+    if (slot == GameConfigOption<T>::INVALID_SLOT)
     {
-        LOG_ERROR("server.loading", "> GameConfig: option ({}) is not exists", optionName);
-        return;
+        auto itr = snapshot->Slots.find(option._optionName);
+        slot = itr != snapshot->Slots.end() ? itr->second : AddMissingOption(option._optionName, GetDefaultValueString(option._def));
+        option._slot.store(slot, std::memory_order_relaxed);
+
+        snapshot = GetSnapshot();
+        if (slot < snapshot->Values.size() && snapshot->Values[slot].Loaded)
+            if (Optional<T> result = GetValue<T>(snapshot->Values[slot]))
+                return *result;
     }
 
+    // missing in the config files, the default is used until the next load
+    if (!_stagingSnapshot && (slot >= snapshot->Values.size() || !snapshot->Values[slot].Loaded))
+        return option._def ? *option._def : GetDefaultValue<T>();
+
+    // bad value or missing while loading: the long way reports it or adds it to the snapshot being loaded
+    return GetOption<T>(option._optionName, option._def);
+}
+
+// Set option
+template<typename T>
+WH_GAME_API void GameConfig::SetOption(std::string_view optionName, T value) const
+{
     std::string valueStr{};
 
     if constexpr (std::is_same_v<T, std::string>)
@@ -176,8 +375,17 @@ WH_GAME_API void GameConfig::SetOption(std::string_view optionName, T value) con
     else
         valueStr = Warhead::ToString(value);
 
-    _configOptions.erase(option);
-    _configOptions.emplace(option, valueStr);
+    ModifySnapshot([&](ConfigSnapshot& snapshot)
+    {
+        // Check exist option
+        if (!snapshot.Find(optionName))
+        {
+            LOG_ERROR("server.loading", "> GameConfig: option ({}) is not exists", optionName);
+            return;
+        }
+
+        SetValue(snapshot.Values[snapshot.Slots.at(optionName)], std::move(valueStr));
+    });
 }
 
 // Loading
@@ -197,9 +405,23 @@ void GameConfig::LoadConfigs(bool reload /*= false*/)
         };
     }
 
-    _configOptions.clear();
+    // keep the slots of known options, values are read again. Options read before but not in the config
+    // files are added with their default now, so their readers don't have to add them one by one
+    _stagingSnapshot = new ConfigSnapshot();
+    _stagingSnapshot->Slots = _registeredSlots;
+    _stagingSnapshot->Values.resize(_registeredOptions.size());
 
-    if (reload)
+    for (std::string const& optionName : sConfigMgr->GetKeysByString(""))
+        SetValue(GetOrCreateValue(*_stagingSnapshot, optionName), sConfigMgr->GetOption<std::string>(optionName, ""));
+
+    for (uint32 slot = 0; slot < _registeredOptions.size(); ++slot)
+    {
+        RegisteredOption const& option = _registeredOptions[slot];
+        if (!_stagingSnapshot->Values[slot].Loaded && option.Default)
+            SetValue(_stagingSnapshot->Values[slot], sConfigMgr->GetOption<std::string>(option.Name, *option.Default));
+    }
+
+    if (reload && !_stagingSnapshot->Find("ClientCacheVersion"))
         AddOption<int32>("ClientCacheVersion");
 
     // Check options can't be changed at worldserver.conf reload
@@ -216,7 +438,7 @@ void GameConfig::LoadConfigs(bool reload /*= false*/)
         }
     }
 
-    LOG_INFO("server.loading", "> Loaded {} config options", _configOptions.size());
+    LOG_INFO("server.loading", "> Loaded {} config options", std::count_if(_stagingSnapshot->Values.begin(), _stagingSnapshot->Values.end(), [](ConfigValue const& value) { return value.Loaded; }));
 }
 
 void GameConfig::CheckOptions(bool reload /*= false*/)
@@ -587,7 +809,9 @@ void GameConfig::CheckOptions(bool reload /*= false*/)
 }
 
 #define TEMPLATE_GAME_CONFIG_OPTION(__typename) \
+    template WH_GAME_API void GameConfig::AddOption(std::string_view optionName, Optional<__typename> def /*= std::nullopt*/) const; \
     template WH_GAME_API __typename GameConfig::GetOption(std::string_view optionName, Optional<__typename> def /*= std::nullopt*/) const; \
+    template WH_GAME_API __typename GameConfig::GetOption(GameConfigOption<__typename> const& option) const; \
     template WH_GAME_API void GameConfig::SetOption(std::string_view optionName, __typename value) const;
 
 TEMPLATE_GAME_CONFIG_OPTION(bool)
@@ -20,6 +20,36 @@
 
 #include "Common.h"
 #include "Optional.h"
+#include <atomic>
+#include <limits>
+#include <type_traits>
+
+/*
+ * Option resolved once and read from the pre-parsed value afterwards, for hot paths:
+ *
+ *     static GameConfigOption<float> const dropMoneyRate("Rate.Drop.Money");
+ *     gold *= dropMoneyRate.Get();
+ *
+ * Follows config reloads, the handle only remembers where the option is stored.
+ */
+template<typename T>
+class GameConfigOption
+{
+    friend class GameConfig;
+
+public:
+    explicit GameConfigOption(std::string_view optionName, Optional<T> def = std::nullopt) :
+        _optionName(optionName), _def(def), _slot(INVALID_SLOT) { }
+
+    T Get() const;
+
+private:
+    static constexpr uint32 INVALID_SLOT = std::numeric_limits<uint32>::max();
+
+    std::string_view _optionName;
+    Optional<T> _def;
+    mutable std::atomic<uint32> _slot;
+};
 
 class WH_GAME_API GameConfig
 {
@@ -51,6 +81,10 @@ public:
     template<typename T>
     T GetOption(std::string_view optionName, Optional<T> = std::nullopt) const;
 
+    // Get config option through a resolved handle, see GameConfigOption
+    template<typename T>
+    T GetOption(GameConfigOption<T> const& option) const;
+
     // Set config option
     template<typename T>
     void SetOption(std::string_view optionName, T value) const;
@@ -61,10 +95,38 @@ private:
 
 #define sGameConfig GameConfig::instance()
 
-#define CONF_GET_BOOL(__optionName) sGameConfig->GetOption<bool>(__optionName)
-#define CONF_GET_STR(__optionName) sGameConfig->GetOption<std::string>(__optionName)
-#define CONF_GET_INT(__optionName) sGameConfig->GetOption<int32>(__optionName)
-#define CONF_GET_UINT(__optionName) sGameConfig->GetOption<uint32>(__optionName)
-#define CONF_GET_FLOAT(__optionName) sGameConfig->GetOption<float>(__optionName)
+template<typename T>
+inline T GameConfigOption<T>::Get() const
+{
+    return sGameConfig->GetOption<T>(*this);
+}
+
+namespace Warhead::Impl
+{
+    template<typename T>
+    struct IsConfigOptionLiteral : std::false_type { };
+
+    template<std::size_t N>
+    struct IsConfigOptionLiteral<char const(&)[N]> : std::true_type { };
+}
+
+// Option names written as literals are read through a handle of the call site, computed names by name
+#define WH_CONF_GET(__type, __optionName) \
+    ([&]() -> __type \
+    { \
+        if constexpr (Warhead::Impl::IsConfigOptionLiteral<decltype(__optionName)>::value) \
+        { \
+            static GameConfigOption<__type> const option(__optionName); \
+            return option.Get(); \
+        } \
+        else \
+            return sGameConfig->GetOption<__type>(__optionName); \
+    }())
+
+#define CONF_GET_BOOL(__optionName) WH_CONF_GET(bool, __optionName)
+#define CONF_GET_STR(__optionName) WH_CONF_GET(std::string, __optionName)
+#define CONF_GET_INT(__optionName) WH_CONF_GET(int32, __optionName)
+#define CONF_GET_UINT(__optionName) WH_CONF_GET(uint32, __optionName)
+#define CONF_GET_FLOAT(__optionName) WH_CONF_GET(float, __optionName)
 
 #endif // __GAME_CONFIG
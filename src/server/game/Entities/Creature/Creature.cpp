@@ -209,7 +209,7 @@ Creature::Creature(bool isWorldObject): Unit(isWorldObject), MovableMapObject(),
     m_spawnId(0), m_equipmentId(0), m_originalEquipmentId(0), m_AlreadyCallAssistance(false),
     m_AlreadySearchedAssistance(false), m_regenHealth(true), m_AI_locked(false), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL), m_originalEntry(0), m_moveInLineOfSightDisabled(false), m_moveInLineOfSightStrictlyDisabled(false),
     m_homePosition(), m_transportHomePosition(), m_creatureInfo(nullptr), m_creatureData(nullptr), m_detectionDistance(20.0f), m_waypointID(0), m_path_id(0), m_formation(nullptr), _lastDamagedTime(nullptr), m_cannotReachTarget(false), m_cannotReachTimer(0),
-    _isMissingSwimmingFlagOutOfCombat(false), m_assistanceTimer(0)
+    _isMissingSwimmingFlagOutOfCombat(false), m_assistanceTimer(0), m_throttledUpdateDiff(0)
 {
     m_regenTimer = CREATURE_REGEN_INTERVAL;
     m_valuesCount = UNIT_END;
@@ -587,6 +587,33 @@ bool Creature::UpdateEntry(uint32 Entry, const CreatureData* data, bool changele
     return true;
 }
 
+bool Creature::UpdateThrottled(uint32 diff, uint32 throttleInterval)
+{
+    diff += m_throttledUpdateDiff;
+
+    if (throttleInterval && diff < throttleInterval && CanThrottleUpdate())
+    {
+        m_throttledUpdateDiff = diff;
+        return false;
+    }
+
+    m_throttledUpdateDiff = 0;
+    Update(diff);
+    return true;
+}
+
+bool Creature::CanThrottleUpdate() const
+{
+    // fighting, returning home, casting or serving players: keep the full rate
+    if (IsInCombat() || IsInEvadeMode() || GetVictim() || HasUnitState(UNIT_STATE_CASTING))
+        return false;
+
+    if (IsCharmedOwnedByPlayerOrPlayer() || IsVehicle() || isActiveObject())
+        return false;
+
+    return true;
+}
+
 void Creature::Update(uint32 diff)
 {
     if (IsAIEnabled && TriggerJustRespawned)
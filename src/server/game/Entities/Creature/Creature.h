@@ -63,6 +63,9 @@ public:
     [[nodiscard]] ObjectGuid::LowType GetSpawnId() const { return m_spawnId; }
 
     void Update(uint32 time) override;                         // overwrited Unit::Update
+    // Map::Update passes a throttle interval for creatures far from all players. Idle ones only gather
+    // the time until the interval has passed and are then updated with all of it. Returns false if deferred.
+    bool UpdateThrottled(uint32 diff, uint32 throttleInterval);
     void GetRespawnPosition(float& x, float& y, float& z, float* ori = nullptr, float* dist = nullptr) const;
 
     void SetCorpseDelay(uint32 delay) { m_corpseDelay = delay; }
@@ -459,6 +462,9 @@ private:
 
     uint32 m_assistanceTimer;
 
+    uint32 m_throttledUpdateDiff;                       // time gathered while the update was throttled, see UpdateThrottled
+
+    [[nodiscard]] bool CanThrottleUpdate() const;
 };
 
 class WH_GAME_API AssistDelayEvent : public BasicEvent
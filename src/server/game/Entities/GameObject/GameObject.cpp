@@ -587,6 +587,7 @@ void GameObject::Update(uint32 diff)
                         }
 
                         m_respawnTime = 0;
+                        InvalidateModelLineOfSight();
                         m_SkillupList.clear();
                         m_usetimes = 0;
 
@@ -836,11 +837,13 @@ void GameObject::Update(uint32 diff)
                 if (!m_spawnedByDefault)
                 {
                     m_respawnTime = 0;
+                    InvalidateModelLineOfSight();
                     DestroyForNearbyPlayers(); // xinef: old UpdateObjectVisibility();
                     return;
                 }
 
                 m_respawnTime = GameTime::GetGameTime().count() + m_respawnDelayTime;
+                InvalidateModelLineOfSight();
 
                 // if option not set then object will be saved at grid unload
                 if (GetMap()->IsDungeon())
@@ -1249,6 +1252,7 @@ void GameObject::SetRespawnTime(int32 respawn)
 {
     m_respawnTime = respawn > 0 ? GameTime::GetGameTime().count() + respawn : 0;
     SetRespawnDelay(respawn);
+    InvalidateModelLineOfSight();
     if (respawn && !m_spawnedByDefault)
     {
         UpdateObjectVisibility(true);
@@ -2460,6 +2464,10 @@ void GameObject::EnableCollision(bool enable)
         phaseMask = GetPhaseMask();
 
     m_model->enable(phaseMask);
+
+    // enabled phase of the model is part of the dynamic tree state
+    if (IsInWorld())
+        GetMap()->InvalidateLineOfSightCache();
 }
 
 void GameObject::UpdateModel()
@@ -2751,11 +2759,19 @@ float GameObject::GetInteractionDistance() const
     }
 }
 
+void GameObject::InvalidateModelLineOfSight()
+{
+    // the model only collides while its owner is spawned, see GameObjectModel::intersectRay
+    if (m_model && IsInWorld())
+        GetMap()->InvalidateLineOfSightCache();
+}
+
 void GameObject::UpdateModelPosition()
 {
     if (!m_model)
         return;
 
+    // moving transports come through here every update, the remove and insert also drop cached line of sight
     if (GetMap()->ContainsGameObjectModel(*m_model))
     {
         GetMap()->RemoveGameObjectModel(*m_model);
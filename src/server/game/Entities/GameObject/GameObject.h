@@ -993,6 +993,7 @@ public:
     [[nodiscard]] float GetInteractionDistance() const;
 
     void UpdateModelPosition();
+    void InvalidateModelLineOfSight();
 
     [[nodiscard]] bool IsAtInteractDistance(Position const& pos, float radius) const;
     [[nodiscard]] bool IsAtInteractDistance(Player const* player, SpellInfo const* spell = nullptr) const;
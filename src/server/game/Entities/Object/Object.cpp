@@ -1327,19 +1327,8 @@ bool WorldObject::IsWithinLOS(float ox, float oy, float oz, VMAP::ModelIgnoreFla
 {
     if (IsInWorld())
     {
-        oz += GetCollisionHeight();
-        float x, y, z;
-        if (GetTypeId() == TYPEID_PLAYER)
-        {
-            GetPosition(x, y, z);
-            z += GetCollisionHeight();
-        }
-        else
-        {
-            GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
-        }
-
-        return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+        LineOfSightQuery query = GetLineOfSightQuery(ox, oy, oz);
+        return GetMap()->isInLineOfSight(query.X1, query.Y1, query.Z1, query.X2, query.Y2, query.Z2, query.PhaseMask, checks, ignoreFlags);
     }
     return true;
 }
@@ -1349,6 +1338,29 @@ bool WorldObject::IsWithinLOSInMap(WorldObject const* obj, VMAP::ModelIgnoreFlag
    if (!IsInMap(obj))
         return false;
 
+    LineOfSightQuery query = GetLineOfSightQuery(obj);
+    return GetMap()->isInLineOfSight(query.X1, query.Y1, query.Z1, query.X2, query.Y2, query.Z2, query.PhaseMask, checks, ignoreFlags);
+}
+
+LineOfSightQuery WorldObject::GetLineOfSightQuery(float ox, float oy, float oz) const
+{
+    oz += GetCollisionHeight();
+    float x, y, z;
+    if (GetTypeId() == TYPEID_PLAYER)
+    {
+        GetPosition(x, y, z);
+        z += GetCollisionHeight();
+    }
+    else
+    {
+        GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
+    }
+
+    return LineOfSightQuery(x, y, z, ox, oy, oz, GetPhaseMask());
+}
+
+LineOfSightQuery WorldObject::GetLineOfSightQuery(WorldObject const* obj) const
+{
     float ox, oy, oz;
     if (obj->GetTypeId() == TYPEID_PLAYER)
     {
@@ -1367,7 +1379,7 @@ bool WorldObject::IsWithinLOSInMap(WorldObject const* obj, VMAP::ModelIgnoreFlag
     else
         GetHitSpherePointFor({ obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ() + obj->GetCollisionHeight() }, x, y, z);
 
-    return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+    return LineOfSightQuery(x, y, z, ox, oy, oz, GetPhaseMask());
 }
 
 void WorldObject::GetHitSpherePointFor(Position const& dest, float& x, float& y, float& z) const
@@ -2047,6 +2059,55 @@ void WorldObject::SendMessageToSetInRange(WorldPacket const* data, float dist, b
     Cell::VisitWorldObjects(this, notifier, dist);
 }
 
+
+void WorldObject::SendMovementMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const
+{
+    if (!WorldSession::IsMovementCoalesced())
+    {
+        SendMessageToSet(data, skipped_rcvr);
+        return;
+    }
+
+    if (!IsInWorld())
+        return;
+
+    // a player moved by someone else still gets its own movement, like Player::SendMessageToSet does
+    if (Player const* player = ToPlayer())
+        if (player != skipped_rcvr)
+            player->GetSession()->SendPacket(data);
+
+    float dist = GetVisibilityRange() + GetObjectSize() + VISIBILITY_COMPENSATION;
+    Warhead::MessageDistDeliverer notifier(this, data, dist, false, skipped_rcvr, Warhead::PacketRelay::Movement);
+    Cell::VisitWorldObjects(this, notifier, dist);
+}
+
+static GameConfigOption<float> const combatLogTrimDistance("Network.CombatLog.TrimDistance", 0.0f);
+
+void WorldObject::SendCombatLogMessageToSet(WorldPacket const* data, WorldObject const* target) const
+{
+    if (!WorldSession::IsCombatLogAggregated())
+    {
+        SendMessageToSet(data, true);
+        return;
+    }
+
+    // Player::SendMessageToSet does not require the player to be in world for its own copy
+    if (Player const* player = ToPlayer())
+        player->GetSession()->SendCombatLogPacket(data);
+
+    if (!IsInWorld())
+        return;
+
+    float dist = GetVisibilityRange() + GetObjectSize() + VISIBILITY_COMPENSATION;
+    Warhead::MessageDistDeliverer notifier(this, data, dist, false, nullptr, Warhead::PacketRelay::CombatLog);
+    notifier.i_combatLogTarget = target;
+
+    float trimDist = combatLogTrimDistance.Get();
+    notifier.i_combatLogTrimDistSq = trimDist * trimDist;
+
+    Cell::VisitWorldObjects(this, notifier, dist);
+}
+
 void WorldObject::SendObjectDeSpawnAnim(ObjectGuid guid)
 {
     WorldPacket data(SMSG_GAMEOBJECT_DESPAWN_ANIM, 8);
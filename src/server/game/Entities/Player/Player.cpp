@@ -4474,6 +4474,8 @@ void Player::OfflineResurrect(ObjectGuid const guid, CharacterDatabaseTransactio
     stmt->SetData(0, uint16(AT_LOGIN_RESURRECT));
     stmt->SetData(1, guid.GetCounter());
     CharacterDatabase.ExecuteOrAppend(trans, stmt);
+
+    WorldSession::InvalidateLoginPrefetch(guid.GetCounter());
 }
 
 Corpse* Player::CreateCorpse()
@@ -4888,6 +4890,12 @@ void Player::LeftChannel(Channel* c)
     m_channels.remove(c);
 }
 
+void Player::UpdateChannelIgnore(ObjectGuid ignored, bool apply)
+{
+    for (Channel* channel : m_channels)
+        channel->SetIgnore(GetGUID(), ignored, apply);
+}
+
 void Player::CleanupChannels()
 {
     while (!m_channels.empty())
@@ -6461,6 +6469,8 @@ void Player::_ApplyItemMods(Item* item, uint8 slot, bool apply)
 
     LOG_DEBUG("entities.player", "applying mods for item {} ", item->GetGUID().ToString());
 
+    StatUpdateBatch statBatch(this);
+
     uint8 attacktype = Player::GetAttackBySlot(slot);
 
     if (item->HasSocket())                              //only (un)equipping of items with sockets can influence metagems, so no need to waste time with normal items
@@ -7376,6 +7386,8 @@ void Player::_RemoveAllItemMods()
 {
     LOG_DEBUG("entities.player.items", "_RemoveAllItemMods start.");
 
+    StatUpdateBatch statBatch(this);
+
     for (uint8 i = 0; i < INVENTORY_SLOT_BAG_END; ++i)
     {
         if (m_items[i])
@@ -7424,6 +7436,8 @@ void Player::_ApplyAllItemMods()
 {
     LOG_DEBUG("entities.player.items", "_ApplyAllItemMods start.");
 
+    StatUpdateBatch statBatch(this);
+
     for (uint8 i = 0; i < INVENTORY_SLOT_BAG_END; ++i)
     {
         if (m_items[i])
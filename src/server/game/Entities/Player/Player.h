@@ -2005,6 +2005,7 @@ public:
 
     void JoinedChannel(Channel* c);
     void LeftChannel(Channel* c);
+    void UpdateChannelIgnore(ObjectGuid ignored, bool apply);
     void CleanupChannels();
     void ClearChannelWatch();
     void UpdateLocalChannels(uint32 newZone);
@@ -2451,6 +2452,7 @@ public:
     void CheckAllAchievementCriteria();
     void ResetAchievementCriteria(AchievementCriteriaCondition condition, uint32 value, bool evenIfCriteriaComplete = false);
     void UpdateAchievementCriteria(AchievementCriteriaTypes type, uint32 miscValue1 = 0, uint32 miscValue2 = 0, Unit* unit = nullptr);
+    void DeferAchievementCriteria(AchievementCriteriaTypes type, uint32 value);
     void StartTimedAchievement(AchievementCriteriaTimedTypes type, uint32 entry, uint32 timeLost = 0);
     void RemoveTimedAchievement(AchievementCriteriaTimedTypes type, uint32 entry);
     void CompletedAchievement(AchievementEntry const* entry);
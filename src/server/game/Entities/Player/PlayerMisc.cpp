@@ -79,6 +79,8 @@ void Player::SavePositionInDB(uint32 mapid, float x, float y, float z, float o,
     stmt->SetData(6, guid.GetCounter());
 
     CharacterDatabase.Execute(stmt);
+
+    WorldSession::InvalidateLoginPrefetch(guid.GetCounter());
 }
 
 void Player::SavePositionInDB(WorldLocation const& loc, uint16 zoneId, ObjectGuid guid, CharacterDatabaseTransaction trans)
@@ -94,6 +96,8 @@ void Player::SavePositionInDB(WorldLocation const& loc, uint16 zoneId, ObjectGui
     stmt->SetData(6, guid.GetCounter());
 
     CharacterDatabase.ExecuteOrAppend(trans, stmt);
+
+    WorldSession::InvalidateLoginPrefetch(guid.GetCounter());
 }
 
 void Player::Customize(CharacterCustomizeInfo const* customizeInfo, CharacterDatabaseTransaction trans)
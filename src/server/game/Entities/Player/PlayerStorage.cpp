@@ -7138,6 +7138,8 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
     // save pet (hunter pet level and experience and all type pets health/mana).
     if (Pet* pet = GetPet())
         pet->SavePetToDB(PET_SAVE_AS_CURRENT);
+
+    WorldSession::InvalidateLoginPrefetch(GetGUID().GetCounter());
 }
 
 // fast save function for item/money cheating preventing - save only inventory and money state
@@ -149,6 +149,7 @@ void Player::Update(uint32 p_time)
     }
 
     m_achievementMgr->UpdateTimedAchievements(p_time);
+    m_achievementMgr->FlushDeferredCriteria();
 
     if (HasUnitState(UNIT_STATE_MELEE_ATTACKING) && !HasUnitState(UNIT_STATE_CASTING) && !HasUnitState(UNIT_STATE_CHARGING))
     {
@@ -225,7 +226,8 @@ void Player::Update(uint32 p_time)
             {
                 _restTime = currTime;
 
-                float bubble = 0.125f * CONF_GET_FLOAT("Rate.Rest.InGame");
+                static GameConfigOption<float> const restInGameRate("Rate.Rest.InGame");
+                float bubble = 0.125f * restInGameRate.Get();
                 float extraPerSec =
                     ((float) GetUInt32Value(PLAYER_NEXT_LEVEL_XP) / 72000.0f) *
                     bubble;
@@ -1925,6 +1927,11 @@ void Player::UpdateAchievementCriteria(AchievementCriteriaTypes type, uint32 mis
     m_achievementMgr->UpdateAchievementCriteria(type, miscValue1, miscValue2, unit);
 }
 
+void Player::DeferAchievementCriteria(AchievementCriteriaTypes type, uint32 value)
+{
+    m_achievementMgr->DeferAchievementCriteria(type, value);
+}
+
 void Player::UpdateFallInformationIfNeed(MovementInfo const& minfo, uint16 opcode)
 {
     if (m_lastFallTime >= minfo.fallTime || m_lastFallZ <= minfo.pos.GetPositionZ() || opcode == MSG_MOVE_FALL_LAND)
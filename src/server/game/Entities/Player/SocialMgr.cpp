@@ -196,6 +196,17 @@ bool PlayerSocial::HasIgnore(ObjectGuid ignore_guid) const
     return _checkContact(ignore_guid, SOCIAL_FLAG_IGNORED);
 }
 
+GuidVector PlayerSocial::GetIgnoredGuids() const
+{
+    GuidVector ignored;
+
+    for (auto const& [guid, info] : m_playerSocialMap)
+        if (info.Flags & SOCIAL_FLAG_IGNORED)
+            ignored.push_back(guid);
+
+    return ignored;
+}
+
 SocialMgr::SocialMgr()
 {
 }
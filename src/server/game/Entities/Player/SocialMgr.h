@@ -113,6 +113,7 @@ class WH_GAME_API PlayerSocial
         // Misc
         bool HasFriend(ObjectGuid friend_guid) const;
         bool HasIgnore(ObjectGuid ignore_guid) const;
+        GuidVector GetIgnoredGuids() const;
         ObjectGuid GetPlayerGUID() const { return m_playerGUID; }
         void SetPlayerGUID(ObjectGuid guid) { m_playerGUID = guid; }
         uint32 GetNumberOfSocialsWithFlag(SocialFlag flag) const;
@@ -0,0 +1,93 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PROC_AURA_INDEX_H
+#define _PROC_AURA_INDEX_H
+
+#include "Define.h"
+#include <map>
+
+/*
+ * The applied auras of a unit that can proc, with the union of their proc flags, so an event no aura
+ * reacts to is dropped with a single test. Keeps the order of the applied aura map (by spell id, then
+ * by application), the order procs are handled in. Built for one generation of the SpellMgr proc
+ * tables, it is rebuilt once they are reloaded.
+ */
+template<class AuraApp>
+class ProcAuraIndex
+{
+public:
+    struct Entry
+    {
+        uint32 ProcFlags;
+        AuraApp* Application;
+    };
+
+    typedef std::multimap<uint32 /*spell id*/, Entry> EntryMap;
+    typedef typename EntryMap::const_iterator const_iterator;
+
+    // Applications without proc flags are not indexed
+    void Add(uint32 spellId, uint32 procFlags, AuraApp* application)
+    {
+        if (!procFlags)
+            return;
+
+        _entries.insert(typename EntryMap::value_type(spellId, { procFlags, application }));
+        _procFlags |= procFlags;
+    }
+
+    void Remove(uint32 spellId, AuraApp* application)
+    {
+        auto bounds = _entries.equal_range(spellId);
+        for (auto itr = bounds.first; itr != bounds.second; ++itr)
+        {
+            if (itr->second.Application != application)
+                continue;
+
+            _entries.erase(itr);
+
+            _procFlags = 0;
+            for (auto const& [id, entry] : _entries)
+                _procFlags |= entry.ProcFlags;
+
+            return;
+        }
+    }
+
+    // Empties the index before adding every application again for the given proc tables generation
+    void Clear(uint32 generation)
+    {
+        _entries.clear();
+        _procFlags = 0;
+        _generation = generation;
+    }
+
+    [[nodiscard]] bool IsBuiltFor(uint32 generation) const { return _generation == generation; }
+    [[nodiscard]] bool CanProcOn(uint32 procFlags) const { return (_procFlags & procFlags) != 0; }
+    [[nodiscard]] uint32 GetProcFlags() const { return _procFlags; }
+    [[nodiscard]] std::size_t size() const { return _entries.size(); }
+
+    const_iterator begin() const { return _entries.begin(); }
+    const_iterator end() const { return _entries.end(); }
+
+private:
+    EntryMap _entries;
+    uint32 _procFlags{ 0 };
+    uint32 _generation{ 0 };
+};
+
+#endif
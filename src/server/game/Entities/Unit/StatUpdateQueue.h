@@ -0,0 +1,77 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _STAT_UPDATE_QUEUE_H
+#define _STAT_UPDATE_QUEUE_H
+
+#include "Define.h"
+#include "Errors.h"
+
+/*
+ * The stat groups (UnitMods) of a unit waiting for their recalculation while stat update batches
+ * are open, one bit per group. Batches nest, the groups are due when the outermost one closes.
+ */
+class StatUpdateQueue
+{
+public:
+    static constexpr uint32 MaxGroups = 32;
+
+    void OpenBatch() { ++_depth; }
+
+    // True when the outermost batch closed
+    bool CloseBatch()
+    {
+        ASSERT(_depth);
+        return !--_depth;
+    }
+
+    [[nodiscard]] bool IsBatching() const { return _depth != 0; }
+    [[nodiscard]] bool HasPending() const { return _pending != 0; }
+
+    // False if the group was pending already, the update is merged into the queued one
+    bool Defer(uint32 group)
+    {
+        ASSERT(group < MaxGroups);
+
+        uint32 const groupMask = 1 << group;
+        bool const queued = !(_pending & groupMask);
+        _pending |= groupMask;
+        return queued;
+    }
+
+    // Calls update once per pending group in group order, so primary stats come before the values
+    // derived from them. A group is cleared before its update as the update may read (and resolve) again
+    template<class Update>
+    void Resolve(Update&& update)
+    {
+        for (uint32 group = 0; group < MaxGroups && _pending; ++group)
+        {
+            uint32 const groupMask = 1 << group;
+            if (!(_pending & groupMask))
+                continue;
+
+            _pending &= ~groupMask;
+            update(group);
+        }
+    }
+
+private:
+    uint32 _depth{ 0 };
+    uint32 _pending{ 0 };
+};
+
+#endif
@@ -43,6 +43,7 @@
 #include "InstanceScript.h"
 #include "Log.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "MoveSpline.h"
 #include "MoveSplineInit.h"
 #include "MovementGenerator.h"
@@ -72,6 +73,7 @@
 #include "Vehicle.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <atomic>
 #include <math.h>
 
 float baseMoveSpeed[MAX_MOVE_TYPE] =
@@ -100,6 +102,45 @@ float playerBaseMoveSpeed[MAX_MOVE_TYPE] =
     3.14f                  // MOVE_PITCH_RATE
 };
 
+static GameConfigOption<bool> const auraModifierCacheEnable("Unit.AuraModifierCache", true);
+static GameConfigOption<bool> const auraModifierCacheVerify("Unit.AuraModifierCache.Verify", false);
+
+// Stat group recalculations since the last ReportStatUpdates, summed over all map threads
+static std::atomic<uint64> statUpdatesDone{ 0 };
+static std::atomic<uint64> statUpdatesMerged{ 0 };
+static GameConfigOption<bool> const statUpdateBatching("Unit.BatchStatUpdates", true);
+
+// Aura effect lists shorter than this are walked, a cache lookup would not be cheaper
+static constexpr std::size_t AURA_MODIFIER_CACHE_MIN_EFFECTS = 4;
+
+template<typename T, typename Walk>
+static T GetCachedAuraAggregate(AuraModifierCache& cache, Unit::AuraEffectList const& effects, AuraType auratype, AuraModifierAggregate aggregate, int32 misc, Walk&& walk)
+{
+    if (effects.size() < AURA_MODIFIER_CACHE_MIN_EFFECTS || !auraModifierCacheEnable.Get())
+        return walk();
+
+    if (double const* cached = cache.Find(auratype, aggregate, misc))
+    {
+        if (auraModifierCacheVerify.Get())
+        {
+            T value = walk();
+            if (double(value) != *cached)
+            {
+                LOG_ERROR("entities.unit", "AuraModifierCache: aura type {} aggregate {} misc {} is cached as {} but the effects give {}",
+                    uint32(auratype), uint32(aggregate), misc, *cached, value);
+                cache.Invalidate(auratype);
+                return value;
+            }
+        }
+
+        return T(*cached);
+    }
+
+    T value = walk();
+    cache.Store(auratype, aggregate, misc, double(value));
+    return value;
+}
+
 // Used for prepare can/can`t triggr aura
 static bool InitTriggerAuraData();
 // Define can trigger auras
@@ -111,6 +152,8 @@ static bool isAlwaysTriggeredAura[TOTAL_AURAS];
 // Prepare lists
 static bool procPrepared = InitTriggerAuraData();
 
+static GameConfigOption<float> const durabilityLossChanceDamage("DurabilityLossChance.Damage");
+
 DamageInfo::DamageInfo(Unit* _attacker, Unit* _victim, uint32 _damage, SpellInfo const* _spellInfo, SpellSchoolMask _schoolMask, DamageEffectType _damageType, uint32 cleanDamage)
     : m_attacker(_attacker), m_victim(_victim), m_damage(_damage), m_spellInfo(_spellInfo), m_schoolMask(_schoolMask),
       m_damageType(_damageType), m_attackType(BASE_ATTACK), m_cleanDamage(cleanDamage)
@@ -716,11 +759,19 @@ bool Unit::GetRandomContactPoint(Unit const* obj, float& x, float& y, float& z,
     return true;
 }
 
+void Unit::RebuildProcAuras()
+{
+    m_procAuras.Clear(sSpellMgr->GetSpellProcGeneration());
+
+    for (AuraApplicationMap::const_iterator i = m_appliedAuras.begin(); i != m_appliedAuras.end(); ++i)
+        m_procAuras.Add(i->first, sSpellMgr->GetSpellProcEventFlags(i->second->GetBase()->GetSpellInfo()), i->second);
+}
+
 void Unit::UpdateInterruptMask()
 {
     m_interruptMask = 0;
     for (AuraApplicationList::const_iterator i = m_interruptableAuras.begin(); i != m_interruptableAuras.end(); ++i)
-        m_interruptMask |= (*i)->GetBase()->GetSpellInfo()->AuraInterruptFlags;
+        m_interruptMask |= sSpellMgr->GetSpellHotInfo((*i)->GetBase()->GetSpellInfo()).AuraInterruptFlags;
 
     if (Spell* spell = m_currentSpells[CURRENT_CHANNELED_SPELL])
         if (spell->getState() == SPELL_STATE_CASTING)
@@ -977,11 +1028,11 @@ uint32 Unit::DealDamage(Unit* attacker, Unit* victim, uint32 damage, CleanDamage
                 bg->UpdatePlayerScore(killer, SCORE_DAMAGE_DONE, damage);
                 killer->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_DAMAGE_DONE, damage, 0, victim); // pussywizard: InBattleground() optimization
             }
-            //killer->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_DEALT, damage); // pussywizard: optimization
+            killer->DeferAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_DEALT, damage);
         }
 
     if (victim->GetTypeId() == TYPEID_PLAYER)
-        ;//victim->ToPlayer()->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_RECEIVED, damage); // pussywizard: optimization
+        victim->ToPlayer()->DeferAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_RECEIVED, damage);
     else if (!victim->IsControlledByPlayer() || victim->IsVehicle())
     {
         if (!victim->ToCreature()->hasLootRecipient())
@@ -995,16 +1046,17 @@ uint32 Unit::DealDamage(Unit* attacker, Unit* victim, uint32 damage, CleanDamage
     {
         LOG_DEBUG("entities.unit", "DealDamage: victim just died");
 
-        //if (attacker && victim->GetTypeId() == TYPEID_PLAYER && victim != attacker)
-        //victim->ToPlayer()->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED, health); // pussywizard: optimization
+        if (attacker && victim->GetTypeId() == TYPEID_PLAYER && victim != attacker)
+            victim->ToPlayer()->DeferAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED, health);
+
         Unit::Kill(attacker, victim, durabilityLoss, cleanDamage ? cleanDamage->attackType : BASE_ATTACK, spellProto);
     }
     else
     {
         LOG_DEBUG("entities.unit", "DealDamageAlive");
 
-        //if (victim->GetTypeId() == TYPEID_PLAYER)
-        //    victim->ToPlayer()->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED, damage); // pussywizard: optimization
+        if (victim->GetTypeId() == TYPEID_PLAYER)
+            victim->ToPlayer()->DeferAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED, damage);
 
         victim->ModifyHealth(- (int32)damage);
 
@@ -1023,7 +1075,7 @@ uint32 Unit::DealDamage(Unit* attacker, Unit* victim, uint32 damage, CleanDamage
         else                                                // victim is a player
         {
             // random durability for items (HIT TAKEN)
-            if (roll_chance_f(CONF_GET_FLOAT("DurabilityLossChance.Damage")))
+            if (roll_chance_f(durabilityLossChanceDamage.Get()))
             {
                 EquipmentSlots slot = EquipmentSlots(urand(0, EQUIPMENT_SLOT_END - 1));
                 victim->ToPlayer()->DurabilityPointLossForEquipSlot(slot);
@@ -1040,7 +1092,7 @@ uint32 Unit::DealDamage(Unit* attacker, Unit* victim, uint32 damage, CleanDamage
         if (attacker && attacker->GetTypeId() == TYPEID_PLAYER)
         {
             // random durability for items (HIT DONE)
-            if (roll_chance_f(CONF_GET_FLOAT("DurabilityLossChance.Damage")))
+            if (roll_chance_f(durabilityLossChanceDamage.Get()))
             {
                 EquipmentSlots slot = EquipmentSlots(urand(0, EQUIPMENT_SLOT_END - 1));
                 attacker->ToPlayer()->DurabilityPointLossForEquipSlot(slot);
@@ -3061,10 +3113,14 @@ SpellMissInfo Unit::MagicSpellHitResult(Unit* victim, SpellInfo const* spellInfo
 
     int32 MISS_CHANCE_MULTIPLIER;
 
-    if (CONF_GET_BOOL("Rate.MissChanceMultiplier.OnlyAffectsPlayer") && GetTypeId() != TYPEID_PLAYER) // keep it as it was originally (7 and 11)
+    static GameConfigOption<bool> const missChanceOnlyAffectsPlayer("Rate.MissChanceMultiplier.OnlyAffectsPlayer");
+    static GameConfigOption<float> const missChanceTargetPlayer("Rate.MissChanceMultiplier.TargetPlayer");
+    static GameConfigOption<float> const missChanceTargetCreature("Rate.MissChanceMultiplier.TargetCreature");
+
+    if (missChanceOnlyAffectsPlayer.Get() && GetTypeId() != TYPEID_PLAYER) // keep it as it was originally (7 and 11)
         MISS_CHANCE_MULTIPLIER = victim->GetTypeId() == TYPEID_PLAYER ? 7 : 11;
     else
-        MISS_CHANCE_MULTIPLIER = victim->GetTypeId() == TYPEID_PLAYER ? CONF_GET_FLOAT("Rate.MissChanceMultiplier.TargetPlayer") : CONF_GET_FLOAT("Rate.MissChanceMultiplier.TargetCreature");
+        MISS_CHANCE_MULTIPLIER = victim->GetTypeId() == TYPEID_PLAYER ? missChanceTargetPlayer.Get() : missChanceTargetCreature.Get();
 
     // Base hit chance from attacker and victim levels
     int32 modHitChance = levelDiff < 3
@@ -3250,6 +3306,8 @@ uint32 Unit::GetDefenseSkillValue(Unit const* target) const
 
 float Unit::GetUnitDodgeChance() const
 {
+    ResolvePendingStatUpdatesForRead();
+
     if (GetTypeId() == TYPEID_PLAYER)
         return ToPlayer()->GetRealDodge(); //GetFloatValue(PLAYER_DODGE_PERCENTAGE);
     else
@@ -3267,6 +3325,8 @@ float Unit::GetUnitDodgeChance() const
 
 float Unit::GetUnitParryChance() const
 {
+    ResolvePendingStatUpdatesForRead();
+
     float chance = 0.0f;
 
     if (Player const* player = ToPlayer())
@@ -3312,6 +3372,8 @@ float Unit::GetUnitMissChance(WeaponAttackType attType) const
 
 float Unit::GetUnitBlockChance() const
 {
+    ResolvePendingStatUpdatesForRead();
+
     if (Player const* player = ToPlayer())
     {
         if (player->CanBlock())
@@ -3338,6 +3400,8 @@ float Unit::GetUnitBlockChance() const
 
 float Unit::GetUnitCriticalChance(WeaponAttackType attackType, Unit const* victim) const
 {
+    ResolvePendingStatUpdatesForRead();
+
     float crit;
 
     if (GetTypeId() == TYPEID_PLAYER)
@@ -4063,6 +4127,8 @@ AuraApplication* Unit::_CreateAuraApplication(Aura* aura, uint8 effMask)
     AuraApplication* aurApp = new AuraApplication(this, caster, aura, effMask);
     m_appliedAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
 
+    m_procAuras.Add(aurId, sSpellMgr->GetSpellProcEventFlags(aurSpellInfo), aurApp);
+
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: even if it gets removed, it will be reapplied in a second
     if (aurSpellInfo->AuraInterruptFlags && this == aura->GetOwner())
@@ -4135,6 +4201,7 @@ void Unit::_ApplyAura(AuraApplication* aurApp, uint8 effMask)
     aura->HandleAuraSpecificMods(aurApp, caster, true, false);
 
     // apply effects of the aura
+    StatUpdateBatch statBatch(this);
     for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
     {
         if (effMask & 1 << i && (!aurApp->GetRemoveMode()))
@@ -4164,6 +4231,8 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
 
+    m_procAuras.Remove(aura->GetId(), aurApp);
+
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: event if it gets removed, it will be reapplied in a second
     if (aura->GetSpellInfo()->AuraInterruptFlags && this == aura->GetOwner())
@@ -4196,10 +4265,13 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
     aura->_UnapplyForTarget(this, caster, aurApp);
 
     // remove effects of the spell - needs to be done after removing aura from lists
-    for (uint8 itr = 0; itr < MAX_SPELL_EFFECTS; ++itr)
     {
-        if (aurApp->HasEffect(itr))
-            aurApp->_HandleEffect(itr, false);
+        StatUpdateBatch statBatch(this);
+        for (uint8 itr = 0; itr < MAX_SPELL_EFFECTS; ++itr)
+        {
+            if (aurApp->HasEffect(itr))
+                aurApp->_HandleEffect(itr, false);
+        }
     }
 
     // all effect mustn't be applied
@@ -4279,6 +4351,8 @@ void Unit::_RegisterAuraEffect(AuraEffect* aurEff, bool apply)
         m_modAuras[aurEff->GetAuraType()].push_back(aurEff);
     else
         m_modAuras[aurEff->GetAuraType()].remove(aurEff);
+
+    m_auraModifierCache.Invalidate(aurEff->GetAuraType());
 }
 
 // All aura base removes should go threw this function!
@@ -4751,7 +4825,7 @@ void Unit::RemoveAurasWithInterruptFlags(uint32 flag, uint32 except, bool isAuto
     {
         Aura* aura = (*iter)->GetBase();
         ++iter;
-        if ((aura->GetSpellInfo()->AuraInterruptFlags & flag) && (!except || aura->GetId() != except))
+        if ((sSpellMgr->GetSpellHotInfo(aura->GetSpellInfo()).AuraInterruptFlags & flag) && (!except || aura->GetId() != except))
         {
             uint32 removedAuras = m_removedAurasCount;
             RemoveAura(aura);
@@ -5471,154 +5545,196 @@ int32 Unit::GetTotalAuraModifier(AuraType auratype) const
     if (mTotalAuraList.empty())
         return 0;
 
-    int32 modifier = 0;
+    return GetCachedAuraAggregate<int32>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::Total, 0, [&]()
+    {
+        int32 modifier = 0;
 
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        modifier += (*i)->GetAmount();
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+            modifier += (*i)->GetAmount();
 
-    return modifier;
+        return modifier;
+    });
 }
 
 float Unit::GetTotalAuraMultiplier(AuraType auratype) const
 {
-    float multiplier = 1.0f;
-
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        AddPct(multiplier, (*i)->GetAmount());
+    return GetCachedAuraAggregate<float>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::Multiplier, 0, [&]()
+    {
+        float multiplier = 1.0f;
 
-    return multiplier;
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+            AddPct(multiplier, (*i)->GetAmount());
+
+        return multiplier;
+    });
 }
 
 int32 Unit::GetMaxPositiveAuraModifier(AuraType auratype)
 {
-    int32 modifier = 0;
-
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    return GetCachedAuraAggregate<int32>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::MaxPositive, 0, [&]()
     {
-        if ((*i)->GetAmount() > modifier)
-            modifier = (*i)->GetAmount();
-    }
+        int32 modifier = 0;
 
-    return modifier;
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+        {
+            if ((*i)->GetAmount() > modifier)
+                modifier = (*i)->GetAmount();
+        }
+
+        return modifier;
+    });
 }
 
 int32 Unit::GetMaxNegativeAuraModifier(AuraType auratype) const
 {
-    int32 modifier = 0;
-
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        if ((*i)->GetAmount() < modifier)
-            modifier = (*i)->GetAmount();
+    return GetCachedAuraAggregate<int32>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::MaxNegative, 0, [&]()
+    {
+        int32 modifier = 0;
 
-    return modifier;
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+            if ((*i)->GetAmount() < modifier)
+                modifier = (*i)->GetAmount();
+
+        return modifier;
+    });
 }
 
 int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask) const
 {
-    int32 modifier = 0;
-
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    return GetCachedAuraAggregate<int32>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::TotalByMiscMask, int32(misc_mask), [&]()
     {
-        if ((*i)->GetMiscValue()& misc_mask)
-            modifier += (*i)->GetAmount();
-    }
-    return modifier;
+        int32 modifier = 0;
+
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+        {
+            if ((*i)->GetMiscValue()& misc_mask)
+                modifier += (*i)->GetAmount();
+        }
+        return modifier;
+    });
 }
 
 float Unit::GetTotalAuraMultiplierByMiscMask(AuraType auratype, uint32 misc_mask) const
 {
-    float multiplier = 1.0f;
-
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        if (((*i)->GetMiscValue() & misc_mask))
-            AddPct(multiplier, (*i)->GetAmount());
+    return GetCachedAuraAggregate<float>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::MultiplierByMiscMask, int32(misc_mask), [&]()
+    {
+        float multiplier = 1.0f;
 
-    return multiplier;
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+            if (((*i)->GetMiscValue() & misc_mask))
+                AddPct(multiplier, (*i)->GetAmount());
+
+        return multiplier;
+    });
 }
 
 int32 Unit::GetMaxPositiveAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask, const AuraEffect* except) const
 {
-    int32 modifier = 0;
-
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    auto walk = [&]()
     {
-        if (except != (*i) && (*i)->GetMiscValue()& misc_mask && (*i)->GetAmount() > modifier)
-            modifier = (*i)->GetAmount();
-    }
+        int32 modifier = 0;
 
-    return modifier;
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+        {
+            if (except != (*i) && (*i)->GetMiscValue()& misc_mask && (*i)->GetAmount() > modifier)
+                modifier = (*i)->GetAmount();
+        }
+
+        return modifier;
+    };
+
+    // results excluding an effect are not cached
+    if (except)
+        return walk();
+
+    return GetCachedAuraAggregate<int32>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::MaxPositiveByMiscMask, int32(misc_mask), walk);
 }
 
 int32 Unit::GetMaxNegativeAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask) const
 {
-    int32 modifier = 0;
-
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    return GetCachedAuraAggregate<int32>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::MaxNegativeByMiscMask, int32(misc_mask), [&]()
     {
-        if ((*i)->GetMiscValue()& misc_mask && (*i)->GetAmount() < modifier)
-            modifier = (*i)->GetAmount();
-    }
+        int32 modifier = 0;
 
-    return modifier;
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+        {
+            if ((*i)->GetMiscValue()& misc_mask && (*i)->GetAmount() < modifier)
+                modifier = (*i)->GetAmount();
+        }
+
+        return modifier;
+    });
 }
 
 int32 Unit::GetTotalAuraModifierByMiscValue(AuraType auratype, int32 misc_value) const
 {
-    int32 modifier = 0;
-
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        if ((*i)->GetMiscValue() == misc_value)
-            modifier += (*i)->GetAmount();
+    return GetCachedAuraAggregate<int32>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::TotalByMiscValue, misc_value, [&]()
+    {
+        int32 modifier = 0;
 
-    return modifier;
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+            if ((*i)->GetMiscValue() == misc_value)
+                modifier += (*i)->GetAmount();
+
+        return modifier;
+    });
 }
 
 float Unit::GetTotalAuraMultiplierByMiscValue(AuraType auratype, int32 misc_value) const
 {
-    float multiplier = 1.0f;
-
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
-        if ((*i)->GetMiscValue() == misc_value)
-            AddPct(multiplier, (*i)->GetAmount());
+    return GetCachedAuraAggregate<float>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::MultiplierByMiscValue, misc_value, [&]()
+    {
+        float multiplier = 1.0f;
 
-    return multiplier;
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+            if ((*i)->GetMiscValue() == misc_value)
+                AddPct(multiplier, (*i)->GetAmount());
+
+        return multiplier;
+    });
 }
 
 int32 Unit::GetMaxPositiveAuraModifierByMiscValue(AuraType auratype, int32 misc_value) const
 {
-    int32 modifier = 0;
-
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    return GetCachedAuraAggregate<int32>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::MaxPositiveByMiscValue, misc_value, [&]()
     {
-        if ((*i)->GetMiscValue() == misc_value && (*i)->GetAmount() > modifier)
-            modifier = (*i)->GetAmount();
-    }
+        int32 modifier = 0;
 
-    return modifier;
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+        {
+            if ((*i)->GetMiscValue() == misc_value && (*i)->GetAmount() > modifier)
+                modifier = (*i)->GetAmount();
+        }
+
+        return modifier;
+    });
 }
 
 int32 Unit::GetMaxNegativeAuraModifierByMiscValue(AuraType auratype, int32 misc_value) const
 {
-    int32 modifier = 0;
-
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auratype);
-    for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+    return GetCachedAuraAggregate<int32>(m_auraModifierCache, mTotalAuraList, auratype, AuraModifierAggregate::MaxNegativeByMiscValue, misc_value, [&]()
     {
-        if ((*i)->GetMiscValue() == misc_value && (*i)->GetAmount() < modifier)
-            modifier = (*i)->GetAmount();
-    }
+        int32 modifier = 0;
 
-    return modifier;
+        for (AuraEffectList::const_iterator i = mTotalAuraList.begin(); i != mTotalAuraList.end(); ++i)
+        {
+            if ((*i)->GetMiscValue() == misc_value && (*i)->GetAmount() < modifier)
+                modifier = (*i)->GetAmount();
+        }
+
+        return modifier;
+    });
 }
 
 int32 Unit::GetTotalAuraModifierByAffectMask(AuraType auratype, SpellInfo const* affectedSpell) const
@@ -5885,7 +6001,7 @@ void Unit::SendSpellNonMeleeDamageLog(SpellNonMeleeDamage* log)
     data << uint32(log->blocked);                           // blocked
     data << uint32(log->HitInfo);
     data << uint8 (0);                                      // flag to use extend data
-    SendMessageToSet(&data, true);
+    SendCombatLogMessageToSet(&data, log->target);
 }
 
 void Unit::SendSpellNonMeleeDamageLog(Unit* target, SpellInfo const* spellInfo, uint32 Damage, SpellSchoolMask damageSchoolMask, uint32 AbsorbedDamage, uint32 Resist, bool PhysicalDamage, uint32 Blocked, bool CriticalHit)
@@ -5966,7 +6082,7 @@ void Unit::SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* pInfo)
             return;
     }
 
-    SendMessageToSet(&data, true);
+    SendCombatLogMessageToSet(&data, aura->GetCaster());
 }
 
 void Unit::SendSpellMiss(Unit* target, uint32 spellID, SpellMissInfo missInfo)
@@ -6073,7 +6189,7 @@ void Unit::SendAttackStateUpdate(CalcDamageInfo* damageInfo)
         data << uint32(0);
     }
 
-    SendMessageToSet(&data, true);
+    SendCombatLogMessageToSet(&data, damageInfo->target);
 }
 
 void Unit::SendAttackStateUpdate(uint32 HitInfo, Unit* target, uint8 /*SwingType*/, SpellSchoolMask damageSchoolMask, uint32 Damage, uint32 AbsorbDamage, uint32 Resist, VictimState TargetState, uint32 BlockedAmount)
@@ -10504,14 +10620,14 @@ int32 Unit::DealHeal(Unit* healer, Unit* victim, uint32 addhealth)
         if (gain && player->InBattleground()) // pussywizard: InBattleground() optimization
             player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_HEALING_DONE, gain, 0, victim);
 
-        //player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEAL_CASTED, addhealth); // pussywizard: optimization
+        player->DeferAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEAL_CASTED, addhealth);
     }
 
-    /*if (Player* player = victim->ToPlayer())
+    if (Player* player = victim->ToPlayer())
     {
-        //player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_HEALING_RECEIVED, gain); // pussywizard: optimization
-        //player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEALING_RECEIVED, addhealth); // pussywizard: optimization
-    }*/
+        player->DeferAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_HEALING_RECEIVED, uint32(gain));
+        player->DeferAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEALING_RECEIVED, addhealth);
+    }
 
     return gain;
 }
@@ -10754,7 +10870,7 @@ void Unit::SendHealSpellLog(Unit* victim, uint32 SpellID, uint32 Damage, uint32
     data << uint32(Absorb); // Absorb amount
     data << uint8(critical ? 1 : 0);
     data << uint8(0); // unused
-    SendMessageToSet(&data, true);
+    SendCombatLogMessageToSet(&data, victim);
 }
 
 int32 Unit::HealBySpell(HealInfo& healInfo, bool critical)
@@ -10779,7 +10895,7 @@ void Unit::SendEnergizeSpellLog(Unit* victim, uint32 spellID, uint32 damage, Pow
     data << uint32(spellID);
     data << uint32(powerType);
     data << uint32(damage);
-    SendMessageToSet(&data, true);
+    SendCombatLogMessageToSet(&data, victim);
 }
 
 void Unit::EnergizeBySpell(Unit* victim, uint32 spellID, uint32 damage, Powers powerType)
@@ -14457,37 +14573,30 @@ void Unit::ApplyDiminishingAura(DiminishingGroup group, bool apply)
 
 float Unit::GetSpellMaxRangeForTarget(Unit const* target, SpellInfo const* spellInfo) const
 {
-    if (!spellInfo->RangeEntry)
-    {
-        return 0;
-    }
-
-    if (spellInfo->RangeEntry->RangeMax[1] == spellInfo->RangeEntry->RangeMax[0])
+    // both ranges are 0 without range entry
+    SpellHotInfo const& hotInfo = sSpellMgr->GetSpellHotInfo(spellInfo);
+    if (hotInfo.MaxRange[1] == hotInfo.MaxRange[0])
     {
-        return spellInfo->GetMaxRange();
+        return hotInfo.MaxRange[0];
     }
 
     if (!target)
     {
-        return spellInfo->GetMaxRange(true);
+        return hotInfo.MaxRange[1];
     }
 
-    return spellInfo->GetMaxRange(!IsHostileTo(target));
+    return hotInfo.MaxRange[IsHostileTo(target) ? 0 : 1];
 }
 
 float Unit::GetSpellMinRangeForTarget(Unit const* target, SpellInfo const* spellInfo) const
 {
-    if (!spellInfo->RangeEntry)
+    SpellHotInfo const& hotInfo = sSpellMgr->GetSpellHotInfo(spellInfo);
+    if (hotInfo.MinRange[1] == hotInfo.MinRange[0])
     {
-        return 0;
-    }
-
-    if (spellInfo->RangeEntry->RangeMin[1] == spellInfo->RangeEntry->RangeMin[0])
-    {
-        return spellInfo->GetMinRange();
+        return hotInfo.MinRange[0];
     }
 
-    return spellInfo->GetMinRange(!IsHostileTo(target));
+    return hotInfo.MinRange[IsHostileTo(target) ? 0 : 1];
 }
 
 uint32 Unit::GetCreatureType() const
@@ -14536,6 +14645,22 @@ bool Unit::HandleStatModifier(UnitMods unitMod, UnitModifierType modifierType, f
     if (!CanModifyStats())
         return false;
 
+    if (m_pendingStatUpdates.IsBatching())
+    {
+        if (!m_pendingStatUpdates.Defer(unitMod))
+            ++statUpdatesMerged;
+
+        return true;
+    }
+
+    UpdateStatModifierGroup(unitMod);
+    return true;
+}
+
+void Unit::UpdateStatModifierGroup(UnitMods unitMod)
+{
+    ++statUpdatesDone;
+
     switch (unitMod)
     {
         case UNIT_MOD_STAT_STRENGTH:
@@ -14592,8 +14717,33 @@ bool Unit::HandleStatModifier(UnitMods unitMod, UnitModifierType modifierType, f
         default:
             break;
     }
+}
 
-    return true;
+Unit::StatUpdateBatch::StatUpdateBatch(Unit* unit) : _unit(statUpdateBatching.Get() ? unit : nullptr)
+{
+    if (_unit)
+        _unit->m_pendingStatUpdates.OpenBatch();
+}
+
+Unit::StatUpdateBatch::~StatUpdateBatch()
+{
+    if (_unit && _unit->m_pendingStatUpdates.CloseBatch())
+        _unit->ResolvePendingStatUpdates();
+}
+
+void Unit::ResolvePendingStatUpdates()
+{
+    m_pendingStatUpdates.Resolve([this](uint32 unitMod)
+    {
+        if (CanModifyStats())
+            UpdateStatModifierGroup(UnitMods(unitMod));
+    });
+}
+
+void Unit::ReportStatUpdates()
+{
+    METRIC_VALUE("unit_stat_updates", statUpdatesDone.exchange(0));
+    METRIC_VALUE("unit_stat_updates_merged", statUpdatesMerged.exchange(0));
 }
 
 float Unit::GetModifierValue(UnitMods unitMod, UnitModifierType modifierType) const
@@ -14738,6 +14888,8 @@ Powers Unit::GetPowerTypeByAuraGroup(UnitMods unitMod) const
 
 float Unit::GetTotalAttackPowerValue(WeaponAttackType attType, Unit* victim) const
 {
+    ResolvePendingStatUpdatesForRead();
+
     if (attType == RANGED_ATTACK)
     {
         int32 ap = GetInt32Value(UNIT_FIELD_RANGED_ATTACK_POWER) + GetInt32Value(UNIT_FIELD_RANGED_ATTACK_POWER_MODS);
@@ -14762,6 +14914,8 @@ float Unit::GetTotalAttackPowerValue(WeaponAttackType attType, Unit* victim) con
 
 float Unit::GetWeaponDamageRange(WeaponAttackType attType, WeaponDamageRange type) const
 {
+    ResolvePendingStatUpdatesForRead();
+
     if (attType == OFF_ATTACK && !haveOffhandWeapon())
         return 0.0f;
 
@@ -15693,30 +15847,43 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         }
     }
 
+    // proc tables were reloaded since the index was built
+    if (!m_procAuras.IsBuiltFor(sSpellMgr->GetSpellProcGeneration()))
+        RebuildProcAuras();
+
+    // No aura of this unit can proc on this event
+    if (!m_procAuras.CanProcOn(procFlag))
+        return;
+
     Unit* actor = isVictim ? target : this;
     Unit* actionTarget = !isVictim ? target : this;
 
     ProcEventInfo eventInfo = ProcEventInfo(actor, actionTarget, target, procFlag, 0, procPhase, procExtra, procSpell, damageInfo, healInfo, procAura, procAuraEffectIndex);
 
     ProcTriggeredList procTriggered;
-    // Fill procTriggered list
-    for (AuraApplicationMap::const_iterator itr = GetAppliedAuras().begin(); itr != GetAppliedAuras().end(); ++itr)
+
+    if (isVictim)
+        procExtra &= ~PROC_EX_INTERNAL_REQ_FAMILY;
+
+    // Fill procTriggered list, only auras with a matching proc flag can pass IsTriggeredAtSpellProcEvent
+    for (ProcAuraApplicationIndex::const_iterator itr = m_procAuras.begin(); itr != m_procAuras.end(); ++itr)
     {
+        if (!(itr->second.ProcFlags & procFlag))
+            continue;
+
         // Do not allow auras to proc from effect triggered by itself
         if (procAura && procAura->Id == itr->first)
             continue;
 
         // Xinef: Generic Item Equipment cooldown, -1 is a special marker
-        if (itr->second->GetBase()->GetCastItemGUID() && HasSpellItemCooldown(itr->first, uint32(-1)))
+        if (itr->second.Application->GetBase()->GetCastItemGUID() && HasSpellItemCooldown(itr->first, uint32(-1)))
             continue;
 
-        ProcTriggeredData triggerData(itr->second->GetBase());
+        ProcTriggeredData triggerData(itr->second.Application->GetBase());
         // Defensive procs are active on absorbs (so absorption effects are not a hindrance)
         bool active = damage || (procExtra & PROC_EX_BLOCK && isVictim);
-        if (isVictim)
-            procExtra &= ~PROC_EX_INTERNAL_REQ_FAMILY;
 
-        SpellInfo const* spellProto = itr->second->GetBase()->GetSpellInfo();
+        SpellInfo const* spellProto = itr->second.Application->GetBase()->GetSpellInfo();
 
         // only auras that have trigger spell should proc from fully absorbed damage
         if (procExtra & PROC_EX_ABSORB && isVictim)
@@ -15738,7 +15905,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
             continue;
 
         // AuraScript Hook
-        if (!triggerData.aura->CallScriptCheckProcHandlers(itr->second, eventInfo))
+        if (!triggerData.aura->CallScriptCheckProcHandlers(itr->second.Application, eventInfo))
             continue;
 
         // Triggered spells not triggering additional spells
@@ -15748,9 +15915,9 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         bool hasTriggeredProc = false;
         for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
         {
-            if (itr->second->HasEffect(i))
+            if (itr->second.Application->HasEffect(i))
             {
-                AuraEffect* aurEff = itr->second->GetBase()->GetEffect(i);
+                AuraEffect* aurEff = itr->second.Application->GetBase()->GetEffect(i);
 
                 // Skip this auras
                 if (isNonTriggerAura[aurEff->GetAuraType()])
@@ -16917,21 +17084,23 @@ bool Unit::InitTamedPet(Pet* pet, uint8 level, uint32 spell_id)
 bool Unit::IsTriggeredAtSpellProcEvent(Unit* victim, Aura* aura, WeaponAttackType attType, bool isVictim, bool active, SpellProcEventEntry const*& spellProcEvent, ProcEventInfo const& eventInfo)
 {
     SpellInfo const* spellProto = aura->GetSpellInfo();
+    SpellHotInfo const& hotInfo = sSpellMgr->GetSpellHotInfo(spellProto);
     SpellInfo const* procSpell = eventInfo.GetSpellInfo();
+    SpellHotInfo const* procHotInfo = procSpell ? &sSpellMgr->GetSpellHotInfo(procSpell) : nullptr;
 
     // let the aura be handled by new proc system if it has new entry
-    if (sSpellMgr->GetSpellProcEntry(spellProto->Id))
+    if (sSpellMgr->GetSpellProcEntry(hotInfo.Id))
         return false;
 
     // Get proc Event Entry
-    spellProcEvent = sSpellMgr->GetSpellProcEvent(spellProto->Id);
+    spellProcEvent = sSpellMgr->GetSpellProcEvent(hotInfo.Id);
 
     // Get EventProcFlag
     uint32 EventProcFlag;
     if (spellProcEvent && spellProcEvent->procFlags) // if exist get custom spellProcEvent->procFlags
         EventProcFlag = spellProcEvent->procFlags;
     else
-        EventProcFlag = spellProto->ProcFlags;       // else get from spell proto
+        EventProcFlag = hotInfo.ProcFlags;           // else get from spell proto
     // Continue if no trigger exist
     if (!EventProcFlag)
         return false;
@@ -16947,7 +17116,7 @@ bool Unit::IsTriggeredAtSpellProcEvent(Unit* victim, Aura* aura, WeaponAttackTyp
     // Xinef: skip victim auras
     // Excluded player shoot spells
     if (!isVictim && GetTypeId() == TYPEID_PLAYER) //spellProto->SpellFamilyName != SPELLFAMILY_GENERIC)
-        if (!(EventProcFlag & (PROC_FLAG_KILL | PROC_FLAG_DEATH)) && procSpell && procSpell->SpellFamilyName == SPELLFAMILY_GENERIC && procSpell->GetCategory() != 76 &&
+        if (!(EventProcFlag & (PROC_FLAG_KILL | PROC_FLAG_DEATH)) && procHotInfo && procHotInfo->SpellFamilyName == SPELLFAMILY_GENERIC && procSpell->GetCategory() != 76 &&
             (!eventInfo.GetTriggerAuraSpell() || eventInfo.GetTriggerAuraSpell()->SpellFamilyName == SPELLFAMILY_GENERIC))
             return false;
 
@@ -16970,15 +17139,15 @@ bool Unit::IsTriggeredAtSpellProcEvent(Unit* victim, Aura* aura, WeaponAttackTyp
     }
     // Aura added by spell can`t trigger from self (prevent drop charges/do triggers)
     // But except periodic and kill triggers (can triggered from self)
-    if (procSpell && procSpell->Id == spellProto->Id
-            && !(spellProto->ProcFlags & (PROC_FLAG_TAKEN_PERIODIC | PROC_FLAG_KILL)))
+    if (procHotInfo && procHotInfo->Id == hotInfo.Id
+            && !(hotInfo.ProcFlags & (PROC_FLAG_TAKEN_PERIODIC | PROC_FLAG_KILL)))
         return false;
 
     // Check if current equipment allows aura to proc
-    if (!isVictim && GetTypeId() == TYPEID_PLAYER && !spellProto->HasAttribute(SPELL_ATTR3_NO_PROC_EQUIP_REQUIREMENT))
+    if (!isVictim && GetTypeId() == TYPEID_PLAYER && !hotInfo.HasAttribute(SPELL_ATTR3_NO_PROC_EQUIP_REQUIREMENT))
     {
         Player* player = ToPlayer();
-        if (spellProto->EquippedItemClass == ITEM_CLASS_WEAPON)
+        if (hotInfo.EquippedItemClass == ITEM_CLASS_WEAPON)
         {
             Item* item = nullptr;
             if (attType == BASE_ATTACK)
@@ -16991,19 +17160,19 @@ bool Unit::IsTriggeredAtSpellProcEvent(Unit* victim, Aura* aura, WeaponAttackTyp
             if (player->IsInFeralForm())
                 return false;
 
-            if (!item || item->IsBroken() || item->GetTemplate()->Class != ITEM_CLASS_WEAPON || !((1 << item->GetTemplate()->SubClass) & spellProto->EquippedItemSubClassMask))
+            if (!item || item->IsBroken() || item->GetTemplate()->Class != ITEM_CLASS_WEAPON || !((1 << item->GetTemplate()->SubClass) & hotInfo.EquippedItemSubClassMask))
                 return false;
         }
-        else if (spellProto->EquippedItemClass == ITEM_CLASS_ARMOR)
+        else if (hotInfo.EquippedItemClass == ITEM_CLASS_ARMOR)
         {
             // Check if player is wearing shield
             Item* item = player->GetUseableItemByPos(INVENTORY_SLOT_BAG_0, EQUIPMENT_SLOT_OFFHAND);
-            if (!item || item->IsBroken() || item->GetTemplate()->Class != ITEM_CLASS_ARMOR || !((1 << item->GetTemplate()->SubClass) & spellProto->EquippedItemSubClassMask))
+            if (!item || item->IsBroken() || item->GetTemplate()->Class != ITEM_CLASS_ARMOR || !((1 << item->GetTemplate()->SubClass) & hotInfo.EquippedItemSubClassMask))
                 return false;
         }
     }
     // Get chance from spell
-    float chance = float(spellProto->ProcChance);
+    float chance = float(hotInfo.ProcChance);
     // If in spellProcEvent exist custom chance, chance = spellProcEvent->customChance;
     if (spellProcEvent && spellProcEvent->customChance)
         chance = spellProcEvent->customChance;
@@ -17023,12 +17192,12 @@ bool Unit::IsTriggeredAtSpellProcEvent(Unit* victim, Aura* aura, WeaponAttackTyp
     }
 
     // Custom chances
-    switch (spellProto->SpellFamilyName)
+    switch (hotInfo.SpellFamilyName)
     {
         case SPELLFAMILY_WARRIOR:
             {
                 // Recklessness, allow to proc only once for whirlwind
-                if (spellProto->Id == 1719 && procSpell && procSpell->Id == 44949)
+                if (hotInfo.Id == 1719 && procHotInfo && procHotInfo->Id == 44949)
                     return false;
             }
     }
@@ -17036,7 +17205,7 @@ bool Unit::IsTriggeredAtSpellProcEvent(Unit* victim, Aura* aura, WeaponAttackTyp
     // Apply chance modifer aura
     if (Player* modOwner = GetSpellModOwner())
     {
-        modOwner->ApplySpellMod(spellProto->Id, SPELLMOD_CHANCE_OF_SUCCESS, chance);
+        modOwner->ApplySpellMod(hotInfo.Id, SPELLMOD_CHANCE_OF_SUCCESS, chance);
     }
     return roll_chance_f(chance);
 }
@@ -19551,7 +19720,8 @@ void Unit::RewardRage(uint32 damage, uint32 weaponSpeedHitFactor, bool attacker)
             addRage *= 3.0f;
     }
 
-    addRage *= CONF_GET_FLOAT("Rate.Rage.Income");
+    static GameConfigOption<float> const rageIncomeRate("Rate.Rage.Income");
+    addRage *= rageIncomeRate.Get();
 
     ModifyPower(POWER_RAGE, uint32(addRage * 10));
 }
@@ -18,18 +18,24 @@
 #ifndef __UNIT_H
 #define __UNIT_H
 
+#include "AuraModifierCache.h"
 #include "EnumFlag.h"
 #include "EventProcessor.h"
+#include "FlatMap.h"
 #include "FollowerRefMgr.h"
 #include "FollowerReference.h"
 #include "HostileRefMgr.h"
 #include "MotionMaster.h"
 #include "Object.h"
+#include "ProcAuraIndex.h"
 #include "SpellAuraDefines.h"
 #include "SpellDefines.h"
+#include "StatUpdateQueue.h"
 #include "ThreatMgr.h"
 #include <functional>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #define WORLD_TRIGGER   12999
 
@@ -290,6 +296,8 @@ enum UnitMods
     UNIT_MOD_POWER_END = UNIT_MOD_RUNIC_POWER + 1
 };
 
+static_assert(UNIT_MOD_END <= StatUpdateQueue::MaxGroups, "Unit::m_pendingStatUpdates keeps one bit per UnitMods");
+
 enum BaseModGroup
 {
     CRIT_PERCENTAGE,
@@ -1268,11 +1276,15 @@ public:
     typedef std::unordered_set<Unit*> AttackerSet;
     typedef std::set<Unit*> ControlSet;
 
+    // Owned and applied auras and the per type effect lists stay node based containers: aura handlers add
+    // and remove entries while they are iterated, and m_auraUpdateIterator must survive erasing other entries
     typedef std::multimap<uint32,  Aura*> AuraMap;
     typedef std::pair<AuraMap::const_iterator, AuraMap::const_iterator> AuraMapBounds;
     typedef std::pair<AuraMap::iterator, AuraMap::iterator> AuraMapBoundsNonConst;
 
     typedef std::multimap<uint32,  AuraApplication*> AuraApplicationMap;
+
+    typedef ProcAuraIndex<AuraApplication> ProcAuraApplicationIndex;
     typedef std::pair<AuraApplicationMap::const_iterator, AuraApplicationMap::const_iterator> AuraApplicationMapBounds;
     typedef std::pair<AuraApplicationMap::iterator, AuraApplicationMap::iterator> AuraApplicationMapBoundsNonConst;
 
@@ -1285,7 +1297,8 @@ public:
     typedef std::list<DiminishingReturn> Diminishing;
     typedef GuidUnorderedSet ComboPointHolderSet;
 
-    typedef std::map<uint8, AuraApplication*> VisibleAuraMap;
+    // At most MAX_AURAS entries, walked on every client aura update and slot lookup
+    typedef Warhead::FlatMap<uint8, AuraApplication*> VisibleAuraMap;
 
     ~Unit() override;
 
@@ -1396,18 +1409,18 @@ public:
     [[nodiscard]] uint32 getClassMask() const { return 1 << (getClass() - 1); }
     [[nodiscard]] uint8 getGender() const { return GetByteValue(UNIT_FIELD_BYTES_0, 2); }
 
-    [[nodiscard]] float GetStat(Stats stat) const { return float(GetUInt32Value(static_cast<uint16>(UNIT_FIELD_STAT0) + stat)); }
+    [[nodiscard]] float GetStat(Stats stat) const { ResolvePendingStatUpdatesForRead(); return float(GetUInt32Value(static_cast<uint16>(UNIT_FIELD_STAT0) + stat)); }
     void SetStat(Stats stat, int32 val) { SetStatInt32Value(static_cast<uint16>(UNIT_FIELD_STAT0) + stat, val); }
     [[nodiscard]] uint32 GetArmor() const { return GetResistance(SPELL_SCHOOL_NORMAL); }
     void SetArmor(int32 val) { SetResistance(SPELL_SCHOOL_NORMAL, val); }
 
-    [[nodiscard]] uint32 GetResistance(SpellSchools school) const { return GetUInt32Value(static_cast<uint16>(UNIT_FIELD_RESISTANCES) + school); }
+    [[nodiscard]] uint32 GetResistance(SpellSchools school) const { ResolvePendingStatUpdatesForRead(); return GetUInt32Value(static_cast<uint16>(UNIT_FIELD_RESISTANCES) + school); }
     [[nodiscard]] uint32 GetResistance(SpellSchoolMask mask) const;
     void SetResistance(SpellSchools school, int32 val) { SetStatInt32Value(static_cast<uint16>(UNIT_FIELD_RESISTANCES) + school, val); }
     static float GetEffectiveResistChance(Unit const* owner, SpellSchoolMask schoolMask, Unit const* victim);
 
     [[nodiscard]] uint32 GetHealth()    const { return GetUInt32Value(UNIT_FIELD_HEALTH); }
-    [[nodiscard]] uint32 GetMaxHealth() const { return GetUInt32Value(UNIT_FIELD_MAXHEALTH); }
+    [[nodiscard]] uint32 GetMaxHealth() const { ResolvePendingStatUpdatesForRead(); return GetUInt32Value(UNIT_FIELD_MAXHEALTH); }
 
     [[nodiscard]] bool IsFullHealth() const { return GetHealth() == GetMaxHealth(); }
     [[nodiscard]] bool HealthBelowPct(int32 pct) const { return GetHealth() < CountPctFromMaxHealth(pct); }
@@ -1428,7 +1441,7 @@ public:
     [[nodiscard]] Powers getPowerType() const { return Powers(GetByteValue(UNIT_FIELD_BYTES_0, 3)); }
     void setPowerType(Powers power);
     [[nodiscard]] uint32 GetPower(Powers power) const { return GetUInt32Value(static_cast<uint16>(UNIT_FIELD_POWER1) + power); }
-    [[nodiscard]] uint32 GetMaxPower(Powers power) const { return GetUInt32Value(static_cast<uint16>(UNIT_FIELD_MAXPOWER1) + power); }
+    [[nodiscard]] uint32 GetMaxPower(Powers power) const { ResolvePendingStatUpdatesForRead(); return GetUInt32Value(static_cast<uint16>(UNIT_FIELD_MAXPOWER1) + power); }
     void SetPower(Powers power, uint32 val, bool withPowerUpdate = true);
     void SetMaxPower(Powers power, uint32 val);
     // returns the change in power
@@ -1865,6 +1878,7 @@ public:
     void _RemoveNoStackAurasDueToAura(Aura* aura);
     bool _IsNoStackAuraDueToAura(Aura* appliedAura, Aura* existingAura) const;
     void _RegisterAuraEffect(AuraEffect* aurEff, bool apply);
+    void InvalidateAuraModifierCache(AuraType type) { m_auraModifierCache.Invalidate(type); }
 
     // m_ownedAuras container management
     AuraMap&       GetOwnedAuras()       { return m_ownedAuras; }
@@ -2068,6 +2082,25 @@ public:
     [[nodiscard]] Powers GetPowerTypeByAuraGroup(UnitMods unitMod) const;
     [[nodiscard]] bool CanModifyStats() const { return m_canModifyStats; }
     void SetCanModifyStats(bool modifyStats) { m_canModifyStats = modifyStats; }
+
+    // While a batch is open HandleStatModifier only marks the modified stat group and the groups
+    // are recalculated once when the outermost batch of the unit closes. Reading max health or
+    // max power resolves the pending groups early.
+    class StatUpdateBatch
+    {
+    public:
+        explicit StatUpdateBatch(Unit* unit);
+        ~StatUpdateBatch();
+
+        StatUpdateBatch(StatUpdateBatch const&) = delete;
+        StatUpdateBatch& operator=(StatUpdateBatch const&) = delete;
+
+    private:
+        Unit* _unit;
+    };
+
+    void ResolvePendingStatUpdates();
+    static void ReportStatUpdates();
     virtual bool UpdateStats(Stats stat) = 0;
     virtual bool UpdateAllStats() = 0;
     virtual void UpdateResistances(uint32 school) = 0;
@@ -2126,6 +2159,7 @@ public:
     [[nodiscard]] uint32 GetInterruptMask() const { return m_interruptMask; }
     void AddInterruptMask(uint32 mask) { m_interruptMask |= mask; }
     void UpdateInterruptMask();
+    void RebuildProcAuras();
 
     uint32 GetDisplayId() { return GetUInt32Value(UNIT_FIELD_DISPLAYID); }
     virtual void SetDisplayId(uint32 modelId);
@@ -2463,14 +2497,17 @@ protected:
     uint32 m_removedAurasCount;
 
     AuraEffectList m_modAuras[TOTAL_AURAS];
+    mutable AuraModifierCache m_auraModifierCache;
     AuraList m_scAuras;                        // casted singlecast auras
     AuraApplicationList m_interruptableAuras;             // auras which have interrupt mask applied on unit
+    ProcAuraApplicationIndex m_procAuras;      // applications ProcDamageAndSpellFor can proc, same order as m_appliedAuras
     AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
     uint32 m_interruptMask;
 
     float m_auraModifiersGroup[UNIT_MOD_END][MODIFIER_TYPE_END];
     float m_weaponDamage[MAX_ATTACK][2];
     bool m_canModifyStats;
+    StatUpdateQueue m_pendingStatUpdates;               // UnitMods recalculated when the StatUpdateBatch closes
     VisibleAuraMap m_visibleAuras;
 
     float m_speed_rate[MAX_MOVE_TYPE];
@@ -2513,6 +2550,15 @@ private:
     void UpdateSplineMovement(uint32 t_diff);
     void UpdateSplinePosition();
 
+    void UpdateStatModifierGroup(UnitMods unitMod);
+    void ResolvePendingStatUpdatesForRead() const
+    {
+        // stats, armor, resistances, max health/power, attack power, weapon damage and the chances derived
+        // from them are update fields, the recalculation has to write them before any of their getters reads them
+        if (m_pendingStatUpdates.HasPending())
+            const_cast<Unit*>(this)->ResolvePendingStatUpdates();
+    }
+
     // player or player's pet
     [[nodiscard]] float GetCombatRatingReduction(CombatRating cr) const;
     [[nodiscard]] uint32 GetCombatRatingDamageReduction(CombatRating cr, float rate, float cap, uint32 damage) const;
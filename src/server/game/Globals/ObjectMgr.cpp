@@ -5331,43 +5331,43 @@ void ObjectMgr::LoadSpellScriptNames()
     {
         Field* fields = result->Fetch();
 
-        int32 spellId          = fields[0].Get<int32>();
-        std::string scriptName = fields[1].Get<std::string>();
+        if (LoadSpellScriptName(fields[0].Get<int32>(), fields[1].Get<std::string>()))
+            ++count;
+    } while (result->NextRow());
 
-        bool allRanks = false;
-        if (spellId <= 0)
-        {
-            allRanks = true;
-            spellId = -spellId;
-        }
+    LOG_INFO("server.loading", ">> Loaded {} spell script names in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", " ");
+}
 
-        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
-        if (!spellInfo)
-        {
-            LOG_ERROR("sql.sql", "Scriptname: `{}` spell (spell_id:{}) does not exist in `Spell.dbc`.", scriptName, fields[0].Get<int32>());
-            continue;
-        }
+// a spell id <= 0 assigns the script to every rank of the spell
+bool ObjectMgr::LoadSpellScriptName(int32 spellId, std::string const& scriptName)
+{
+    uint32 firstSpellId = spellId <= 0 ? uint32(-spellId) : uint32(spellId);
+
+    SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(firstSpellId);
+    if (!spellInfo)
+    {
+        LOG_ERROR("sql.sql", "Scriptname: `{}` spell (spell_id:{}) does not exist in `Spell.dbc`.", scriptName, spellId);
+        return false;
+    }
 
-        if (allRanks)
+    if (spellId <= 0)
+    {
+        if (sSpellMgr->GetFirstSpellInChain(firstSpellId) != firstSpellId)
         {
-            if (sSpellMgr->GetFirstSpellInChain(spellId) != uint32(spellId))
-            {
-                LOG_ERROR("sql.sql", "Scriptname: `{}` spell (spell_id:{}) is not first rank of spell.", scriptName, fields[0].Get<int32>());
-                continue;
-            }
-            while (spellInfo)
-            {
-                _spellScriptsStore.insert(SpellScriptsContainer::value_type(spellInfo->Id, GetScriptId(scriptName)));
-                spellInfo = spellInfo->GetNextRankSpell();
-            }
+            LOG_ERROR("sql.sql", "Scriptname: `{}` spell (spell_id:{}) is not first rank of spell.", scriptName, spellId);
+            return false;
         }
-        else
+        while (spellInfo)
+        {
             _spellScriptsStore.insert(SpellScriptsContainer::value_type(spellInfo->Id, GetScriptId(scriptName)));
-        ++count;
-    } while (result->NextRow());
+            spellInfo = spellInfo->GetNextRankSpell();
+        }
+    }
+    else
+        _spellScriptsStore.insert(SpellScriptsContainer::value_type(spellInfo->Id, GetScriptId(scriptName)));
 
-    LOG_INFO("server.loading", ">> Loaded {} spell script names in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
-    LOG_INFO("server.loading", " ");
+    return true;
 }
 
 void ObjectMgr::ValidateSpellScripts()
@@ -5406,7 +5406,6 @@ void ObjectMgr::ValidateSpellScripts()
                 spellScript->_Register();
                 if (!spellScript->_Validate(spellEntry))
                     valid = false;
-                delete spellScript;
             }
             if (auraScript)
             {
@@ -5414,12 +5413,15 @@ void ObjectMgr::ValidateSpellScripts()
                 auraScript->_Register();
                 if (!auraScript->_Validate(spellEntry))
                     valid = false;
-                delete auraScript;
             }
             if (!valid)
             {
+                delete spellScript;
+                delete auraScript;
                 _spellScriptsStore.erase(sitr->second);
             }
+            else // registered hooks are kept, scripts created for casts share them instead of registering again
+                sScriptMgr->AddSpellScriptHooks(spellEntry->Id, sitr->second->second, spellScript, auraScript);
         }
         ++count;
     }
@@ -5610,6 +5612,7 @@ void ObjectMgr::LoadInstanceEncounters()
                         continue;
                     }
                     const_cast<SpellInfo*>(spellInfo)->AttributesCu |= SPELL_ATTR0_CU_ENCOUNTER_REWARD;
+                    sSpellMgr->UpdateSpellHotInfo(spellInfo);
                     break;
                 }
             default:
@@ -931,6 +931,7 @@ public:
     void LoadWaypointScripts();
 
     void LoadSpellScriptNames();
+    bool LoadSpellScriptName(int32 spellId, std::string const& scriptName);
     void ValidateSpellScripts();
     void InitializeSpellInfoPrecomputedData();
 
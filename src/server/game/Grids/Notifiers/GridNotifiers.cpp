@@ -348,7 +348,17 @@ void ObjectUpdater::Visit(GridRefMgr<T>& m)
     {
         obj = iter->GetSource();
         ++iter;
-        if (obj->IsInWorld() && (i_largeOnly == obj->IsVisibilityOverridden()))
+        if (!obj->IsInWorld() || (i_largeOnly != obj->IsVisibilityOverridden()))
+            continue;
+
+        if constexpr (std::is_same_v<T, Creature>)
+        {
+            if (obj->UpdateThrottled(i_timeDiff, i_throttleInterval))
+                ++i_creatureUpdates;
+            else
+                ++i_creatureUpdatesDeferred;
+        }
+        else
             obj->Update(i_timeDiff);
     }
 }
@@ -94,6 +94,13 @@ namespace Warhead
         void Visit(CreatureMapType&);
     };
 
+    enum class PacketRelay : uint8
+    {
+        Direct,
+        Movement,                                           // queue as movement relay of i_source, see WorldSession::SendMovementPacket
+        CombatLog                                           // queue as combat log, see WorldSession::SendCombatLogPacket
+    };
+
     struct MessageDistDeliverer
     {
         WorldObject const* i_source;
@@ -102,10 +109,13 @@ namespace Warhead
         float i_distSq;
         TeamId teamId;
         Player const* skipped_receiver;
-        MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, bool own_team_only = false, Player const* skipped = nullptr)
+        PacketRelay i_relay;
+        WorldObject const* i_combatLogTarget;               // combat log only: the other side of the fight
+        float i_combatLogTrimDistSq;                        // combat log only: players further from both sides get no log, 0 sends to all
+        MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, bool own_team_only = false, Player const* skipped = nullptr, PacketRelay relay = PacketRelay::Direct)
             : i_source(src), i_message(msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
             , teamId((own_team_only && src->GetTypeId() == TYPEID_PLAYER) ? src->ToPlayer()->GetTeamId() : TEAM_NEUTRAL)
-            , skipped_receiver(skipped)
+            , skipped_receiver(skipped), i_relay(relay), i_combatLogTarget(nullptr), i_combatLogTrimDistSq(0.0f)
         {
         }
         void Visit(PlayerMapType& m);
@@ -122,7 +132,39 @@ namespace Warhead
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            switch (i_relay)
+            {
+                case PacketRelay::Movement:
+                    player->GetSession()->SendMovementPacket(i_source->GetGUID(), i_message);
+                    break;
+                case PacketRelay::CombatLog:
+                    if (IsCombatLogTrimmedFor(player))
+                        player->GetSession()->SkipCombatLogPacket(i_message);
+                    else
+                        player->GetSession()->SendCombatLogPacket(i_message);
+                    break;
+                default:
+                    player->GetSession()->SendPacket(i_message);
+                    break;
+            }
+        }
+
+        bool IsCombatLogTrimmedFor(Player const* player) const
+        {
+            if (!i_combatLogTrimDistSq || player->GetExactDist2dSq(i_source) <= i_combatLogTrimDistSq)
+                return false;
+
+            if (i_combatLogTarget && (player == i_combatLogTarget || player->GetExactDist2dSq(i_combatLogTarget) <= i_combatLogTrimDistSq))
+                return false;
+
+            // the group always sees the fights of its members and their pets, wherever they are
+            for (WorldObject const* side : { i_source, i_combatLogTarget })
+                if (Unit const* unit = side ? side->ToUnit() : nullptr)
+                    if (Player const* owner = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
+                        if (player->IsInSameRaidWith(owner))
+                            return false;
+
+            return true;
         }
     };
 
@@ -155,7 +197,11 @@ namespace Warhead
     {
         uint32 i_timeDiff;
         bool i_largeOnly;
-        explicit ObjectUpdater(const uint32 diff, bool largeOnly) : i_timeDiff(diff), i_largeOnly(largeOnly) {}
+        uint32 i_throttleInterval;                          // creatures only, see Creature::UpdateThrottled
+        uint32 i_creatureUpdates;
+        uint32 i_creatureUpdatesDeferred;
+        explicit ObjectUpdater(const uint32 diff, bool largeOnly, uint32 throttleInterval = 0) : i_timeDiff(diff), i_largeOnly(largeOnly),
+            i_throttleInterval(throttleInterval), i_creatureUpdates(0), i_creatureUpdatesDeferred(0) {}
         template<class T> void Visit(GridRefMgr<T>& m);
         void Visit(PlayerMapType&) {}
         void Visit(CorpseMapType&) {}
@@ -34,6 +34,7 @@
 #include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "Player.h"
+#include "QueryHolder.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
 #include "World.h"
@@ -162,6 +163,27 @@ void Guild::LogHolder<Entry>::AddEvent(CharacterDatabaseTransaction trans, Ts&&.
     entry.SaveToDB(trans);
 }
 
+template <typename Entry>
+void Guild::LogHolder<Entry>::InitNextGUID(uint32 guid)
+{
+    if (m_nextGUID == uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
+        m_nextGUID = guid;
+}
+
+template <typename Entry>
+void Guild::LogHolder<Entry>::RestoreEvents(std::list<Entry>&& events)
+{
+    // these replace whatever the DB returned for the same log guid, the load may have run before they were saved
+    for (Entry& entry : events)
+    {
+        m_log.remove_if([&entry](Entry const& loaded) { return loaded.GetGUID() == entry.GetGUID(); });
+        m_log.push_back(std::move(entry));
+    }
+
+    while (m_log.size() > m_maxRecords)
+        m_log.pop_front();
+}
+
 template <typename Entry>
 inline uint32 Guild::LogHolder<Entry>::GetNextGUID()
 {
@@ -435,7 +457,7 @@ void Guild::BankTab::Delete(CharacterDatabaseTransaction trans, bool removeItems
             if (removeItemsFromDB)
                 pItem->DeleteFromDB(trans);
             delete pItem;
-            pItem = nullptr;
+            m_items[slotId] = nullptr;
         }
 }
 
@@ -1062,6 +1084,7 @@ bool Guild::Create(Player* pLeader, std::string_view name)
     m_motd = "No message set.";
     m_bankMoney = 0;
     m_createdDate = GameTime::GetGameTime().count();
+    m_bankData.SetLoaded(m_createdDate);
 
     LOG_DEBUG("guild", "GUILD: creating guild [{}] for leader {} ({})",
               m_name, pLeader->GetName(), m_leaderGuid.ToString());
@@ -1134,6 +1157,14 @@ void Guild::Disband()
     // Free bank tab used memory and delete items stored in them
     _DeleteBankItems(trans, true);
 
+    // items never loaded from DB are deleted there
+    if (!IsBankDataLoaded())
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GUILD_BANK_ITEM_INSTANCES);
+        stmt->SetData(0, m_id);
+        trans->Append(stmt);
+    }
+
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GUILD_BANK_ITEMS);
     stmt->SetData(0, m_id);
     trans->Append(stmt);
@@ -1761,8 +1792,18 @@ void Guild::SendInfo(WorldSession* session) const
     LOG_DEBUG("guild", "SMSG_GUILD_INFO [{}]", session->GetPlayerInfo());
 }
 
-void Guild::SendEventLog(WorldSession* session) const
+void Guild::SendEventLog(WorldSession* session)
 {
+    if (!_PrepareBankData())
+    {
+        _DeferUntilBankData([this, guid = session->GetPlayer()->GetGUID()]()
+        {
+            if (Player* player = _FindMemberPlayer(guid))
+                SendEventLog(player->GetSession());
+        });
+        return;
+    }
+
     std::list<EventLogEntry> const& eventLog = m_eventLog.GetGuildLog();
 
     WorldPackets::Guild::GuildEventLogQueryResults packet;
@@ -1775,8 +1816,18 @@ void Guild::SendEventLog(WorldSession* session) const
     LOG_DEBUG("guild", "MSG_GUILD_EVENT_LOG_QUERY [{}]", session->GetPlayerInfo());
 }
 
-void Guild::SendBankLog(WorldSession* session, uint8 tabId) const
+void Guild::SendBankLog(WorldSession* session, uint8 tabId)
 {
+    if (!_PrepareBankData())
+    {
+        _DeferUntilBankData([this, guid = session->GetPlayer()->GetGUID(), tabId]()
+        {
+            if (Player* player = _FindMemberPlayer(guid))
+                SendBankLog(player->GetSession(), tabId);
+        });
+        return;
+    }
+
     // GUILD_BANK_MAX_TABS send by client for money log
     if (tabId < _GetPurchasedTabsSize() || tabId == GUILD_BANK_MAX_TABS)
     {
@@ -1794,14 +1845,35 @@ void Guild::SendBankLog(WorldSession* session, uint8 tabId) const
     }
 }
 
-void Guild::SendBankTabData(WorldSession* session, uint8 tabId, bool sendAllSlots) const
+void Guild::SendBankTabData(WorldSession* session, uint8 tabId, bool sendAllSlots)
 {
+    if (!_PrepareBankData())
+    {
+        _DeferUntilBankData([this, guid = session->GetPlayer()->GetGUID(), tabId, sendAllSlots]()
+        {
+            if (Player* player = _FindMemberPlayer(guid))
+                SendBankTabData(player->GetSession(), tabId, sendAllSlots);
+        });
+        return;
+    }
+
     if (tabId < _GetPurchasedTabsSize())
         _SendBankContent(session, tabId, sendAllSlots);
 }
 
-void Guild::SendBankTabsInfo(WorldSession* session, bool sendAllSlots /*= false*/) const
+void Guild::SendBankTabsInfo(WorldSession* session, bool sendAllSlots /*= false*/)
 {
+    // without slots only money and tab info are sent, they are always loaded
+    if (sendAllSlots && !_PrepareBankData())
+    {
+        _DeferUntilBankData([this, guid = session->GetPlayer()->GetGUID()]()
+        {
+            if (Player* player = _FindMemberPlayer(guid))
+                SendBankTabsInfo(player->GetSession(), true);
+        });
+        return;
+    }
+
     _SendBankList(session, 0, sendAllSlots);
 }
 
@@ -2015,6 +2087,156 @@ bool Guild::LoadBankItemFromDB(Field* fields)
     return m_bankTabs[tabId].LoadItemFromDB(fields);
 }
 
+void Guild::LoadEventLogNextGUID(uint32 guid)
+{
+    m_eventLog.InitNextGUID(guid);
+}
+
+void Guild::LoadBankEventLogNextGUID(uint8 dbTabId, uint32 guid)
+{
+    if (dbTabId == GUILD_BANK_MONEY_LOGS_TAB)
+        m_bankEventLog[GUILD_BANK_MAX_TABS].InitNextGUID(guid);
+    else if (dbTabId < GUILD_BANK_MAX_TABS)
+        m_bankEventLog[dbTabId].InitNextGUID(guid);
+}
+
+class GuildBankDataQueryHolder : public CharacterDatabaseQueryHolder
+{
+public:
+    enum
+    {
+        GUILD_BANK_DATA_QUERY_EVENT_LOGS,
+        GUILD_BANK_DATA_QUERY_BANK_EVENT_LOGS,
+        GUILD_BANK_DATA_QUERY_BANK_ITEMS,
+
+        MAX_GUILD_BANK_DATA_QUERY
+    };
+
+    explicit GuildBankDataQueryHolder(uint32 guildId) : m_guildId(guildId) { }
+
+    bool Initialize()
+    {
+        SetSize(MAX_GUILD_BANK_DATA_QUERY);
+
+        bool res = true;
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUILD_EVENTLOGS);
+        stmt->SetData(0, m_guildId);
+        res &= SetPreparedQuery(GUILD_BANK_DATA_QUERY_EVENT_LOGS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUILD_BANK_EVENTLOGS);
+        stmt->SetData(0, m_guildId);
+        res &= SetPreparedQuery(GUILD_BANK_DATA_QUERY_BANK_EVENT_LOGS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUILD_BANK_ITEMS);
+        stmt->SetData(0, m_guildId);
+        res &= SetPreparedQuery(GUILD_BANK_DATA_QUERY_BANK_ITEMS, stmt);
+
+        return res;
+    }
+
+private:
+    uint32 m_guildId;
+};
+
+bool Guild::_PrepareBankData()
+{
+    return m_bankData.Prepare(GameTime::GetGameTime().count(), [this]()
+    {
+        std::shared_ptr<GuildBankDataQueryHolder> holder = std::make_shared<GuildBankDataQueryHolder>(m_id);
+        if (!holder->Initialize())
+            return false;
+
+        // the guild may be disbanded before the data arrives
+        sGuildMgr->AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([guildId = m_id](SQLQueryHolderBase const& holder)
+        {
+            if (Guild* guild = sGuildMgr->GetGuildById(guildId))
+                guild->_LoadBankData(holder);
+        });
+
+        return true;
+    });
+}
+
+void Guild::_DeferUntilBankData(std::function<void()>&& callback)
+{
+    m_bankData.Defer(std::move(callback));
+}
+
+void Guild::SetBankDataLoaded()
+{
+    m_bankData.SetLoaded(GameTime::GetGameTime().count());
+}
+
+void Guild::_LoadBankData(SQLQueryHolderBase const& holder)
+{
+    if (!m_bankData.IsLoading())
+        return;
+
+    // events logged while the stored ones were not loaded
+    std::list<EventLogEntry> newEvents;
+    newEvents.swap(m_eventLog.GetGuildLog());
+
+    std::array<std::list<BankEventLogEntry>, GUILD_BANK_MAX_TABS + 1> newBankEvents;
+    for (std::size_t i = 0; i < m_bankEventLog.size(); ++i)
+        newBankEvents[i].swap(m_bankEventLog[i].GetGuildLog());
+
+    if (PreparedQueryResult result = holder.GetPreparedResult(GuildBankDataQueryHolder::GUILD_BANK_DATA_QUERY_EVENT_LOGS))
+    {
+        do
+        {
+            LoadEventLogFromDB(result->Fetch());
+        } while (result->NextRow());
+    }
+
+    if (PreparedQueryResult result = holder.GetPreparedResult(GuildBankDataQueryHolder::GUILD_BANK_DATA_QUERY_BANK_EVENT_LOGS))
+    {
+        do
+        {
+            LoadBankEventLogFromDB(result->Fetch());
+        } while (result->NextRow());
+    }
+
+    m_eventLog.RestoreEvents(std::move(newEvents));
+    for (std::size_t i = 0; i < m_bankEventLog.size(); ++i)
+        m_bankEventLog[i].RestoreEvents(std::move(newBankEvents[i]));
+
+    if (PreparedQueryResult result = holder.GetPreparedResult(GuildBankDataQueryHolder::GUILD_BANK_DATA_QUERY_BANK_ITEMS))
+    {
+        do
+        {
+            LoadBankItemFromDB(result->Fetch());
+        } while (result->NextRow());
+    }
+
+    LOG_DEBUG("guild", "Guild {} ({}): bank data loaded, {} waiting requests", m_name, m_id, m_bankData.GetWaiterCount());
+
+    m_bankData.SetLoaded(GameTime::GetGameTime().count());
+}
+
+// Frees bank items and logs nobody used for a while, everything is already saved to DB
+void Guild::UnloadBankDataIfIdle(time_t idleSince)
+{
+    if (!m_bankData.UnloadIfIdle(idleSince))
+        return;
+
+    for (BankTab& tab : m_bankTabs)
+        tab.Delete(CharacterDatabaseTransaction(nullptr));
+
+    m_eventLog.GetGuildLog().clear();
+    for (LogHolder<BankEventLogEntry>& bankLog : m_bankEventLog)
+        bankLog.GetGuildLog().clear();
+
+    LOG_DEBUG("guild", "Guild {} ({}): unloaded idle bank data", m_name, m_id);
+}
+
+Player* Guild::_FindMemberPlayer(ObjectGuid guid) const
+{
+    if (Member const* member = GetMember(guid))
+        return member->FindPlayer();
+
+    return nullptr;
+}
+
 // Validates guild data loaded from database. Returns false if guild should be deleted.
 bool Guild::Validate()
 {
@@ -2287,6 +2509,7 @@ void Guild::DeleteMember(ObjectGuid guid, bool isDisbanding, bool isKicked, bool
     else
     {
         sCharacterCache->UpdateCharacterGuildId(guid, 0);
+        WorldSession::InvalidateLoginPrefetch(lowguid);
     }
 
     _DeleteMemberFromDB(guid.GetCounter());
@@ -2326,6 +2549,16 @@ void Guild::SwapItems(Player* player, uint8 tabId, uint8 slotId, uint8 destTabId
     if (tabId == destTabId && slotId == destSlotId)
         return;
 
+    if (!_PrepareBankData())
+    {
+        _DeferUntilBankData([this, guid = player->GetGUID(), tabId, slotId, destTabId, destSlotId, splitedAmount]()
+        {
+            if (Player* player = _FindMemberPlayer(guid))
+                SwapItems(player, tabId, slotId, destTabId, destSlotId, splitedAmount);
+        });
+        return;
+    }
+
     BankMoveItemData from(this, player, tabId, slotId);
     BankMoveItemData to(this, player, destTabId, destSlotId);
     _MoveItems(&from, &to, splitedAmount);
@@ -2336,6 +2569,16 @@ void Guild::SwapItemsWithInventory(Player* player, bool toChar, uint8 tabId, uin
     if ((slotId >= GUILD_BANK_MAX_SLOTS && slotId != NULL_SLOT) || tabId >= _GetPurchasedTabsSize())
         return;
 
+    if (!_PrepareBankData())
+    {
+        _DeferUntilBankData([this, guid = player->GetGUID(), toChar, tabId, slotId, playerBag, playerSlotId, splitedAmount]()
+        {
+            if (Player* player = _FindMemberPlayer(guid))
+                SwapItemsWithInventory(player, toChar, tabId, slotId, playerBag, playerSlotId, splitedAmount);
+        });
+        return;
+    }
+
     BankMoveItemData bankData(this, player, tabId, slotId);
     PlayerMoveItemData charData(this, player, playerBag, playerSlotId);
     if (toChar)
@@ -2606,6 +2849,8 @@ void Guild::_LogBankEvent(CharacterDatabaseTransaction trans, GuildBankEventLogT
         tabId = GUILD_BANK_MAX_TABS;
         dbTabId = GUILD_BANK_MONEY_LOGS_TAB;
     }
+
+    // the next log guid is known even while the stored events are not loaded, see LoadGuilds
     LogHolder<BankEventLogEntry>& pLog = m_bankEventLog[tabId];
     pLog.AddEvent(trans, m_id, pLog.GetNextGUID(), eventType, dbTabId, guid, itemOrMoney, itemStackCount, destTabId);
 
@@ -18,12 +18,14 @@
 #ifndef AZEROTHCORE_GUILD_H
 #define AZEROTHCORE_GUILD_H
 
+#include "GuildBankDataState.h"
 #include "Item.h"
 #include "ObjectMgr.h"
 #include "Optional.h"
 #include "Player.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <functional>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -491,6 +493,10 @@ private:
         template <typename... Ts>
         void AddEvent(CharacterDatabaseTransaction trans, Ts&&... args);
         uint32 GetNextGUID();
+        // Continues the log guid sequence of stored events that are not loaded
+        void InitNextGUID(uint32 guid);
+        // Adds back events logged while the stored events were not loaded
+        void RestoreEvents(std::list<Entry>&& events);
         std::list<Entry>& GetGuildLog() { return m_log; }
         std::list<Entry> const& GetGuildLog() const { return m_log; }
 
@@ -716,10 +722,10 @@ public:
 
     // Send info to client
     void SendInfo(WorldSession* session) const;
-    void SendEventLog(WorldSession* session) const;
-    void SendBankLog(WorldSession* session, uint8 tabId) const;
-    void SendBankTabsInfo(WorldSession* session, bool showTabs = false) const;
-    void SendBankTabData(WorldSession* session, uint8 tabId, bool sendAllSlots) const;
+    void SendEventLog(WorldSession* session);
+    void SendBankLog(WorldSession* session, uint8 tabId);
+    void SendBankTabsInfo(WorldSession* session, bool showTabs = false);
+    void SendBankTabData(WorldSession* session, uint8 tabId, bool sendAllSlots);
     void SendBankTabText(WorldSession* session, uint8 tabId) const;
     void SendPermissions(WorldSession* session) const;
     void SendMoneyInfo(WorldSession* session) const;
@@ -734,8 +740,15 @@ public:
     void LoadBankTabFromDB(Field* fields);
     bool LoadBankEventLogFromDB(Field* fields);
     bool LoadBankItemFromDB(Field* fields);
+    void LoadEventLogNextGUID(uint32 guid);
+    void LoadBankEventLogNextGUID(uint8 dbTabId, uint32 guid);
     bool Validate();
 
+    // Bank items, event logs and bank event logs are loaded on first use
+    bool IsBankDataLoaded() const { return m_bankData.IsLoaded(); }
+    void SetBankDataLoaded();
+    void UnloadBankDataIfIdle(time_t idleSince);
+
     // Broadcasts
     void BroadcastToGuild(WorldSession* session, bool officerOnly, std::string_view msg, uint32 language = LANG_UNIVERSAL) const;
     void BroadcastPacketToRank(WorldPacket const* packet, uint8 rankId) const;
@@ -797,6 +810,8 @@ protected:
     LogHolder<EventLogEntry> m_eventLog;
     std::array<LogHolder<BankEventLogEntry>, GUILD_BANK_MAX_TABS + 1> m_bankEventLog = {};
 
+    GuildBankDataState m_bankData;
+
 private:
     inline uint8 _GetRanksSize() const { return uint8(m_ranks.size()); }
     inline const RankInfo* GetRankInfo(uint8 rankId) const { return rankId < _GetRanksSize() ? &m_ranks[rankId] : nullptr; }
@@ -832,6 +847,14 @@ private:
     void _UpdateAccountsNumber();
     bool _IsLeader(Player* player) const;
     void _DeleteBankItems(CharacterDatabaseTransaction trans, bool removeItemsFromDB = false);
+
+    // Returns true if the bank data is loaded (and marks it as used), otherwise starts loading it.
+    // World thread only: bank handlers are thread unsafe ones, logging events never loads the data
+    bool _PrepareBankData();
+    // Runs callback once the bank data is loaded
+    void _DeferUntilBankData(std::function<void()>&& callback);
+    void _LoadBankData(SQLQueryHolderBase const& holder);
+    Player* _FindMemberPlayer(ObjectGuid guid) const;
     bool _ModifyBankMoney(CharacterDatabaseTransaction trans, uint64 amount, bool add);
     void _SetLeaderGUID(Member& pLeader);
 
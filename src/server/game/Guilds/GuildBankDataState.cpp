@@ -0,0 +1,59 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GuildBankDataState.h"
+
+bool GuildBankDataState::Prepare(time_t now, LoadFunction const& startLoad)
+{
+    if (_state == State::Loaded)
+    {
+        _accessTime = now;
+        return true;
+    }
+
+    if (_state == State::NotLoaded && startLoad())
+        _state = State::Loading;
+
+    return false;
+}
+
+void GuildBankDataState::Defer(Waiter&& waiter)
+{
+    _waiters.push_back(std::move(waiter));
+}
+
+void GuildBankDataState::SetLoaded(time_t now)
+{
+    _state = State::Loaded;
+    _accessTime = now;
+
+    // a waiter may queue more work on the guild, only the ones waiting so far run here
+    std::vector<Waiter> waiters;
+    waiters.swap(_waiters);
+
+    for (Waiter const& waiter : waiters)
+        waiter();
+}
+
+bool GuildBankDataState::UnloadIfIdle(time_t idleSince)
+{
+    if (_state != State::Loaded || _accessTime > idleSince)
+        return false;
+
+    _state = State::NotLoaded;
+    return true;
+}
@@ -0,0 +1,65 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _GUILD_BANK_DATA_STATE_H
+#define _GUILD_BANK_DATA_STATE_H
+
+#include "Define.h"
+#include <ctime>
+#include <functional>
+#include <vector>
+
+/*
+ * Whether the bank items and logs of a guild are loaded, with the requests waiting for them. The data
+ * is loaded on first use and unloaded once nobody used it for a while. World thread only.
+ */
+class WH_GAME_API GuildBankDataState
+{
+public:
+    typedef std::function<void()> Waiter;
+    typedef std::function<bool()> LoadFunction; // starts loading the data, false if it could not
+
+    [[nodiscard]] bool IsLoaded() const { return _state == State::Loaded; }
+    [[nodiscard]] bool IsLoading() const { return _state == State::Loading; }
+    [[nodiscard]] std::size_t GetWaiterCount() const { return _waiters.size(); }
+
+    // Returns true if the data is loaded (and marks it as used), otherwise starts loading it unless already loading
+    bool Prepare(time_t now, LoadFunction const& startLoad);
+
+    // Runs the waiter once the data is loaded, after the ones already waiting
+    void Defer(Waiter&& waiter);
+
+    // The data arrived or a new guild has nothing to load, runs the waiters in order
+    void SetLoaded(time_t now);
+
+    // Returns true if the data was not used since idleSince, the caller frees it then
+    bool UnloadIfIdle(time_t idleSince);
+
+private:
+    enum class State : uint8
+    {
+        NotLoaded,
+        Loading,
+        Loaded
+    };
+
+    State _state{ State::NotLoaded };
+    time_t _accessTime{ 0 };
+    std::vector<Waiter> _waiters;
+};
+
+#endif
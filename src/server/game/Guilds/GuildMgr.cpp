@@ -18,8 +18,11 @@
 #include "GuildMgr.h"
 #include "Common.h"
 #include "GameConfig.h"
+#include "GameTime.h"
+#include "Metric.h"
+#include "QueryHolder.h"
 
-GuildMgr::GuildMgr() : NextGuildId(1)
+GuildMgr::GuildMgr() : NextGuildId(1), _bankDataUnloadTimer(0)
 { }
 
 GuildMgr::~GuildMgr()
@@ -246,8 +249,32 @@ void GuildMgr::LoadGuilds()
         }
     }
 
+    // Bank items and logs of guilds are loaded when a member first needs them
+    static GameConfigOption<bool> const lazyLoadBankOption("Guild.LazyLoadBank", true);
+    bool lazyLoadBank = lazyLoadBankOption.Get();
+
     // 5. Load all event logs
     LOG_INFO("server.loading", "Loading guild event logs...");
+    if (lazyLoadBank)
+    {
+        CharacterDatabase.DirectExecute("DELETE FROM guild_eventlog WHERE LogGuid > {}", CONF_GET_INT("Guild.EventLogRecordsCount"));
+
+        // only the newest log guid of each guild, new events continue from it without loading the log
+        //          0        1
+        if (QueryResult result = CharacterDatabase.Query("SELECT guildid, LogGuid FROM guild_eventlog ORDER BY TimeStamp DESC, LogGuid DESC"))
+        {
+            do
+            {
+                Field* fields = result->Fetch();
+                if (Guild* guild = GetGuildById(fields[0].Get<uint32>()))
+                    guild->LoadEventLogNextGUID(fields[1].Get<uint32>());
+            } while (result->NextRow());
+        }
+
+        LOG_INFO("server.loading", ">> Guild event logs are loaded on demand");
+        LOG_INFO("server.loading", " ");
+    }
+    else
     {
         uint32 oldMSTime = getMSTime();
 
@@ -282,6 +309,26 @@ void GuildMgr::LoadGuilds()
 
     // 6. Load all bank event logs
     LOG_INFO("server.loading", "Loading guild bank event logs...");
+    if (lazyLoadBank)
+    {
+        // Remove log entries that exceed the number of allowed entries per guild
+        CharacterDatabase.DirectExecute("DELETE FROM guild_bank_eventlog WHERE LogGuid > {}", CONF_GET_INT("Guild.BankEventLogRecordsCount"));
+
+        //          0        1      2
+        if (QueryResult result = CharacterDatabase.Query("SELECT guildid, TabId, LogGuid FROM guild_bank_eventlog ORDER BY TimeStamp DESC, LogGuid DESC"))
+        {
+            do
+            {
+                Field* fields = result->Fetch();
+                if (Guild* guild = GetGuildById(fields[0].Get<uint32>()))
+                    guild->LoadBankEventLogNextGUID(fields[1].Get<uint8>(), fields[2].Get<uint32>());
+            } while (result->NextRow());
+        }
+
+        LOG_INFO("server.loading", ">> Guild bank event logs are loaded on demand");
+        LOG_INFO("server.loading", " ");
+    }
+    else
     {
         uint32 oldMSTime = getMSTime();
 
@@ -352,6 +399,15 @@ void GuildMgr::LoadGuilds()
 
     // 8. Fill all guild bank tabs
     LOG_INFO("server.loading", "Filling bank tabs with items...");
+    if (lazyLoadBank)
+    {
+        // Delete orphan guild bank items
+        CharacterDatabase.DirectExecute("DELETE gbi FROM guild_bank_item gbi LEFT JOIN guild g ON gbi.guildId = g.guildId WHERE g.guildId IS NULL");
+
+        LOG_INFO("server.loading", ">> Guild bank items are loaded on demand");
+        LOG_INFO("server.loading", " ");
+    }
+    else
     {
         uint32 oldMSTime = getMSTime();
 
@@ -396,6 +452,10 @@ void GuildMgr::LoadGuilds()
         {
             Guild* guild = itr->second;
             ++itr;
+
+            if (guild && !lazyLoadBank)
+                guild->SetBankDataLoaded();
+
             if (guild && !guild->Validate())
                 delete guild;
         }
@@ -413,3 +473,40 @@ void GuildMgr::ResetTimes()
 
     CharacterDatabase.DirectExecute("TRUNCATE guild_member_withdraw");
 }
+
+void GuildMgr::Update(uint32 diff)
+{
+    _queryHolderProcessor.ProcessReadyCallbacks();
+
+    static GameConfigOption<uint32> const bankDataUnloadDelay("Guild.BankDataUnloadDelay", 30);
+
+    uint32 unloadDelay = bankDataUnloadDelay.Get();
+    if (!unloadDelay)
+        return;
+
+    if (_bankDataUnloadTimer > diff)
+    {
+        _bankDataUnloadTimer -= diff;
+        return;
+    }
+
+    _bankDataUnloadTimer = MINUTE * IN_MILLISECONDS;
+
+    time_t idleSince = GameTime::GetGameTime().count() - time_t(unloadDelay) * MINUTE;
+    uint32 loaded = 0;
+
+    for (auto const& [guildId, guild] : GuildStore)
+    {
+        guild->UnloadBankDataIfIdle(idleSince);
+
+        if (guild->IsBankDataLoaded())
+            ++loaded;
+    }
+
+    METRIC_VALUE("guild_bank_data_loaded", loaded);
+}
+
+SQLQueryHolderCallback& GuildMgr::AddQueryHolderCallback(SQLQueryHolderCallback&& callback)
+{
+    return _queryHolderProcessor.AddCallback(std::move(callback));
+}
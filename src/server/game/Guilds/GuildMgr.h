@@ -18,6 +18,8 @@
 #ifndef _GUILDMGR_H
 #define _GUILDMGR_H
 
+#include "AsyncCallbackProcessor.h"
+#include "DatabaseEnvFwd.h"
 #include "Guild.h"
 
 class WH_GAME_API GuildMgr
@@ -42,10 +44,19 @@ public:
     void SetNextGuildId(uint32 Id) { NextGuildId = Id; }
 
     void ResetTimes();
+
+    // Finishes lazy loads of guild bank data and unloads the idle ones
+    void Update(uint32 diff);
+    SQLQueryHolderCallback& AddQueryHolderCallback(SQLQueryHolderCallback&& callback);
+
 protected:
     typedef std::unordered_map<uint32, Guild*> GuildContainer;
     uint32 NextGuildId;
     GuildContainer GuildStore;
+
+private:
+    AsyncCallbackProcessor<SQLQueryHolderCallback> _queryHolderProcessor;
+    uint32 _bankDataUnloadTimer;
 };
 
 #define sGuildMgr GuildMgr::instance()
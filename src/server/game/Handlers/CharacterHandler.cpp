@@ -33,6 +33,7 @@
 #include "Guild.h"
 #include "GuildMgr.h"
 #include "InstanceSaveMgr.h"
+#include "LoginPrefetchSerials.h"
 #include "Language.h"
 #include "Log.h"
 #include "MapMgr.h"
@@ -60,6 +61,7 @@
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
+#include <atomic>
 
 class LoginQueryHolder : public CharacterDatabaseQueryHolder
 {
@@ -217,6 +219,106 @@ bool LoginQueryHolder::Initialize()
     return res;
 }
 
+namespace
+{
+    LoginPrefetchSerials _loginPrefetchSerials;
+
+    std::atomic<uint32> _loginPrefetchHolders{ 0 };
+
+    GameConfigOption<bool> const loginPrefetchEnable("PlayerLogin.Prefetch", true);
+    GameConfigOption<uint32> const loginPrefetchMaxAge("PlayerLogin.Prefetch.MaxAge", 30);
+    GameConfigOption<uint32> const loginPrefetchMaxHolders("PlayerLogin.Prefetch.MaxHolders", 500);
+
+    bool IsLoginPrefetchChanged(ObjectGuid::LowType guid, uint32 serial)
+    {
+        return _loginPrefetchSerials.IsChanged(guid, serial);
+    }
+}
+
+void WorldSession::InvalidateLoginPrefetch(ObjectGuid::LowType guid)
+{
+    _loginPrefetchSerials.Invalidate(guid, GameTime::GetGameTime().count(), loginPrefetchMaxAge.Get());
+}
+
+void WorldSession::InvalidateAllLoginPrefetches()
+{
+    _loginPrefetchSerials.InvalidateAll();
+}
+
+void WorldSession::PrefetchLoginData(ObjectGuid playerGuid)
+{
+    if (!loginPrefetchEnable.Get() || PlayerLoading() || GetPlayer())
+        return;
+
+    // still in the world or kept by an offline session, its saves are still to come
+    if (ObjectAccessor::FindConnectedPlayer(playerGuid) || sWorld->FindOfflineSessionForCharacterGUID(playerGuid.GetCounter()))
+    {
+        DiscardLoginPrefetch();
+        return;
+    }
+
+    if (_loginPrefetch.Holder)
+    {
+        if (_loginPrefetch.Guid == playerGuid && !IsLoginPrefetchChanged(playerGuid.GetCounter(), _loginPrefetch.Serial))
+            return;
+
+        DiscardLoginPrefetch();
+    }
+
+    uint32 maxHolders = loginPrefetchMaxHolders.Get();
+    if (maxHolders && _loginPrefetchHolders >= maxHolders)
+        return;
+
+    std::shared_ptr<LoginQueryHolder> holder = std::make_shared<LoginQueryHolder>(GetAccountId(), playerGuid);
+    if (!holder->Initialize())
+        return;
+
+    ++_loginPrefetchHolders;
+
+    _loginPrefetch.Holder = holder;
+    _loginPrefetch.Guid = playerGuid;
+    _loginPrefetch.Serial = _loginPrefetchSerials.GetSerial();
+    _loginPrefetch.IssueTime = GameTime::GetGameTime().count();
+    _loginPrefetch.Ready = false;
+    _loginPrefetch.LoginPending = false;
+
+    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& result)
+    {
+        // discarded while loading
+        if (_loginPrefetch.Holder.get() != &result)
+            return;
+
+        _loginPrefetch.Ready = true;
+
+        if (!_loginPrefetch.LoginPending)
+            return;
+
+        std::shared_ptr<LoginQueryHolder> holder = _loginPrefetch.Holder;
+        ObjectGuid playerGuid = _loginPrefetch.Guid;
+        bool changed = IsLoginPrefetchChanged(playerGuid.GetCounter(), _loginPrefetch.Serial);
+        DiscardLoginPrefetch();
+
+        METRIC_VALUE("login_prefetch", uint64(1), METRIC_TAG("result", changed ? "changed" : "hit"));
+
+        if (changed)
+            QueryPlayerLoginData(playerGuid);
+        else
+            HandlePlayerLoginFromDB(*holder);
+    });
+}
+
+void WorldSession::DiscardLoginPrefetch()
+{
+    if (!_loginPrefetch.Holder)
+        return;
+
+    _loginPrefetch.Holder.reset();
+    _loginPrefetch.Guid.Clear();
+    _loginPrefetch.Ready = false;
+    _loginPrefetch.LoginPending = false;
+    --_loginPrefetchHolders;
+}
+
 void WorldSession::HandleCharEnum(PreparedQueryResult result)
 {
     WorldPacket data(SMSG_CHAR_ENUM, 100);                  // we guess size
@@ -243,6 +345,14 @@ void WorldSession::HandleCharEnum(PreparedQueryResult result)
     data.put<uint8>(0, num);
 
     SendPacket(&data);
+
+    // start loading the character most likely to be played while the client shows the list
+    if (_lastLoggedOutGuid && IsLegitCharacterForAccount(_lastLoggedOutGuid))
+        PrefetchLoginData(_lastLoggedOutGuid);
+    else if (_legitCharacters.size() == 1)
+        PrefetchLoginData(*_legitCharacters.begin());
+    else
+        DiscardLoginPrefetch();
 }
 
 void WorldSession::HandleCharEnumOpcode(WorldPacket& /*recvData*/)
@@ -603,6 +713,8 @@ void WorldSession::HandleCharDeleteOpcode(WorldPacket& recvData)
     // Initiating
     uint32 initAccountId = GetAccountId();
 
+    DiscardLoginPrefetch();
+
     // can't delete loaded character
     if (ObjectAccessor::FindConnectedPlayer(guid) || sWorld->FindOfflineSessionForCharacterGUID(guid.GetCounter()))
     {
@@ -763,11 +875,43 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
             p->SetSession(this);
             delete p->PlayerTalkClass;
             p->PlayerTalkClass = new PlayerMenu(p->GetSession());
+            DiscardLoginPrefetch();
             HandlePlayerLoginToCharInWorld(p);
             return;
         }
     }
 
+    if (_loginPrefetch.Holder && _loginPrefetch.Guid == playerGuid)
+    {
+        bool expired = _loginPrefetch.IssueTime + time_t(loginPrefetchMaxAge.Get()) < GameTime::GetGameTime().count();
+        if (!expired && !IsLoginPrefetchChanged(playerGuid.GetCounter(), _loginPrefetch.Serial))
+        {
+            // still loading, the prefetch callback continues the login
+            if (!_loginPrefetch.Ready)
+            {
+                _loginPrefetch.LoginPending = true;
+                return;
+            }
+
+            std::shared_ptr<LoginQueryHolder> holder = _loginPrefetch.Holder;
+            DiscardLoginPrefetch();
+
+            METRIC_VALUE("login_prefetch", uint64(1), METRIC_TAG("result", "hit"));
+            HandlePlayerLoginFromDB(*holder);
+            return;
+        }
+
+        METRIC_VALUE("login_prefetch", uint64(1), METRIC_TAG("result", expired ? "expired" : "changed"));
+    }
+    else if (_loginPrefetch.Holder)
+        METRIC_VALUE("login_prefetch", uint64(1), METRIC_TAG("result", "miss"));
+
+    DiscardLoginPrefetch();
+    QueryPlayerLoginData(playerGuid);
+}
+
+void WorldSession::QueryPlayerLoginData(ObjectGuid playerGuid)
+{
     std::shared_ptr<LoginQueryHolder> holder = std::make_shared<LoginQueryHolder>(GetAccountId(), playerGuid);
     if (!holder->Initialize())
     {
@@ -1322,6 +1466,8 @@ void WorldSession::HandleCharRenameOpcode(WorldPacket& recvData)
     recvData >> renameInfo->Guid
              >> renameInfo->Name;
 
+    DiscardLoginPrefetch();
+
     // prevent character rename to invalid name
     if (!normalizePlayerName(renameInfo->Name))
     {
@@ -1587,6 +1733,8 @@ void WorldSession::HandleCharCustomize(WorldPacket& recvData)
 
     recvData >> customizeInfo->Guid;
 
+    DiscardLoginPrefetch();
+
     if (!IsLegitCharacterForAccount(customizeInfo->Guid))
     {
         LOG_ERROR("entities.player.cheat", "Account {}, IP: {} tried to customise {}, but it does not belong to their account!",
@@ -1791,6 +1939,9 @@ void WorldSession::HandleEquipmentSetUse(WorldPacket& recvData)
 {
     LOG_DEBUG("network", "CMSG_EQUIPMENT_SET_USE");
 
+    // the whole set is swapped before the stats are recalculated
+    Unit::StatUpdateBatch statBatch(_player);
+
     for (uint32 i = 0; i < EQUIPMENT_SLOT_END; ++i)
     {
         ObjectGuid itemGuid;
@@ -1877,6 +2028,8 @@ void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
 
     recvData >> factionChangeInfo->Guid;
 
+    DiscardLoginPrefetch();
+
     if (!IsLegitCharacterForAccount(factionChangeInfo->Guid))
     {
         LOG_ERROR("entities.player.cheat", "Account {}, IP: {} tried to factionchange character {}, but it does not belong to their account!",
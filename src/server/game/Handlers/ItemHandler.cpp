@@ -70,6 +70,9 @@ void WorldSession::HandleSwapInvItemOpcode(WorldPacket& recvData)
 
     recvData >> dstslot >> srcslot;
 
+    // unequip and equip recalculate the stats once
+    Unit::StatUpdateBatch statBatch(_player);
+
     // prevent attempt swap same item to current position generated by client at special checting sequence
     if (srcslot == dstslot)
         return;
@@ -130,6 +133,8 @@ void WorldSession::HandleSwapItem(WorldPacket& recvData)
 
     recvData >> dstbag >> dstslot >> srcbag >> srcslot;
 
+    Unit::StatUpdateBatch statBatch(_player);
+
     uint16 src = ((srcbag << 8) | srcslot);
     uint16 dst = ((dstbag << 8) | dstslot);
 
@@ -175,6 +180,8 @@ void WorldSession::HandleAutoEquipItemOpcode(WorldPacket& recvData)
     if (!pSrcItem)
         return;                                             // only at cheat
 
+    Unit::StatUpdateBatch statBatch(_player);
+
     ItemTemplate const* pProto = pSrcItem->GetTemplate();
     if (!pProto)
     {
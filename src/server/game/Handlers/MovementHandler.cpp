@@ -537,7 +537,7 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
 
     movementInfo.guid = mover->GetGUID();
     WriteMovementInfo(&data, &movementInfo);
-    mover->SendMessageToSet(&data, _player);
+    mover->SendMovementMessageToSet(&data, _player);
 
     mover->m_movementInfo = movementInfo;
 
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LOOT_GROUP_ROLL_H
+#define _LOOT_GROUP_ROLL_H
+
+#include "Optional.h"
+#include "Random.h"
+#include <algorithm>
+#include <vector>
+
+// The two steps of rolling a loot group, over the group's own entries: entries not valid for the
+// loot are skipped where they are, no filtered copy is made per roll
+namespace Warhead::LootRoll
+{
+    /**
+     * Walks the valid explicitly chanced entries in order, taking chance off roll (0-100) until it goes below 0.
+     *
+     * @param chanceOf Returns the chance to use for an entry, or nothing when the whole group is not to be rolled
+     * @return The entry hit, nullptr when none was hit, nothing when chanceOf stopped the roll
+     */
+    template<class Item, class IsInvalid, class ChanceOf>
+    Optional<Item*> RollExplicitlyChanced(std::vector<Item*> const& items, float roll, IsInvalid const& isInvalid, ChanceOf const& chanceOf)
+    {
+        for (Item* item : items)
+        {
+            if (isInvalid(item))
+                continue;
+
+            Optional<float> chance = chanceOf(item);
+            if (!chance)
+                return {};
+
+            if (*chance >= 100.0f)
+                return item;
+
+            roll -= *chance;
+            if (roll < 0)
+                return item;
+        }
+
+        return static_cast<Item*>(nullptr);
+    }
+
+    // Every valid entry has the same chance: counts them and takes the n-th, nullptr if none is valid
+    template<class Item, class IsInvalid>
+    Item* SelectEqualChanced(std::vector<Item*> const& items, IsInvalid const& isInvalid)
+    {
+        uint32 validCount = uint32(std::count_if(items.begin(), items.end(), [&](Item const* item) { return !isInvalid(item); }));
+        if (!validCount)
+            return nullptr;
+
+        uint32 selected = urand(0, validCount - 1);
+        for (Item* item : items)
+        {
+            if (isInvalid(item))
+                continue;
+
+            if (!selected--)
+                return item;
+        }
+
+        return nullptr;
+    }
+}
+
+#endif
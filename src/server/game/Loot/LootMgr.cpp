@@ -20,6 +20,7 @@
 #include "GameConfig.h"
 #include "Group.h"
 #include "Log.h"
+#include "LootGroupRoll.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -29,17 +30,22 @@
 #include "Util.h"
 #include "World.h"
 
-static std::string const qualityToRate[MAX_ITEM_QUALITY] =
+// Heirlooms have no drop rate option and always roll with 1.0
+static GameConfigOption<float> const qualityToRate[ITEM_QUALITY_HEIRLOOM] =
 {
-    "Rate.Drop.Item.Poor",                                    // ITEM_QUALITY_POOR
-    "Rate.Drop.Item.Normal",                                  // ITEM_QUALITY_NORMAL
-    "Rate.Drop.Item.Uncommon",                                // ITEM_QUALITY_UNCOMMON
-    "Rate.Drop.Item.Rare",                                    // ITEM_QUALITY_RARE
-    "Rate.Drop.Item.Epic",                                    // ITEM_QUALITY_EPIC
-    "Rate.Drop.Item.Legendary",                               // ITEM_QUALITY_LEGENDARY
-    "Rate.Drop.Item.Artifact",                                // ITEM_QUALITY_ARTIFACT
+    GameConfigOption<float>("Rate.Drop.Item.Poor"),           // ITEM_QUALITY_POOR
+    GameConfigOption<float>("Rate.Drop.Item.Normal"),         // ITEM_QUALITY_NORMAL
+    GameConfigOption<float>("Rate.Drop.Item.Uncommon"),       // ITEM_QUALITY_UNCOMMON
+    GameConfigOption<float>("Rate.Drop.Item.Rare"),           // ITEM_QUALITY_RARE
+    GameConfigOption<float>("Rate.Drop.Item.Epic"),           // ITEM_QUALITY_EPIC
+    GameConfigOption<float>("Rate.Drop.Item.Legendary"),      // ITEM_QUALITY_LEGENDARY
+    GameConfigOption<float>("Rate.Drop.Item.Artifact"),       // ITEM_QUALITY_ARTIFACT
 };
 
+static GameConfigOption<float> const referencedRate("Rate.Drop.Item.Referenced");
+static GameConfigOption<float> const referencedAmountRate("Rate.Drop.Item.ReferencedAmount");
+static GameConfigOption<float> const moneyRate("Rate.Drop.Money");
+
 LootStore LootTemplates_Creature("creature_loot_template",           "creature entry",                  true);
 LootStore LootTemplates_Disenchant("disenchant_loot_template",       "item disenchant id",              true);
 LootStore LootTemplates_Fishing("fishing_loot_template",             "area id",                         true);
@@ -59,14 +65,14 @@ struct LootGroupInvalidSelector : public Warhead::unary_function<LootStoreItem*,
 {
     explicit LootGroupInvalidSelector(Loot const& loot, uint16 lootMode) : _loot(loot), _lootMode(lootMode) { }
 
-    bool operator()(LootStoreItem* item) const
+    bool operator()(LootStoreItem const* item) const
     {
         if (!(item->lootmode & _lootMode))
             return true;
 
         if (!item->reference)
         {
-            ItemTemplate const* _proto = sObjectMgr->GetItemTemplate(item->itemid);
+            ItemTemplate const* _proto = item->itemProto;
             if (!_proto)
                 return true;
 
@@ -188,6 +194,10 @@ uint32 LootStore::LoadLootTable()
             continue;
         }
 
+        // Item templates are not reloadable, so the pointer stays valid for the lifetime of the store
+        if (!reference)
+            storeitem->itemProto = sObjectMgr->GetItemTemplate(item);
+
         // Looking for the template of the entry
         // often entries are put together
         if (m_LootTemplates.empty() || tab->first != entry)
@@ -312,11 +322,11 @@ bool LootStoreItem::Roll(bool rate, Player const* player, Loot& loot, LootStore
         return true;
 
     if (reference)                                   // reference case
-        return roll_chance_f(_chance * (rate ? CONF_GET_FLOAT("Rate.Drop.Item.Referenced") : 1.0f));
+        return roll_chance_f(_chance * (rate ? referencedRate.Get() : 1.0f));
 
-    ItemTemplate const* pProto = sObjectMgr->GetItemTemplate(itemid);
+    ItemTemplate const* pProto = itemProto;
 
-    float qualityModifier = pProto && rate ? CONF_GET_FLOAT(qualityToRate[pProto->Quality]) : 1.0f;
+    float qualityModifier = pProto && rate && pProto->Quality < ITEM_QUALITY_HEIRLOOM ? qualityToRate[pProto->Quality].Get() : 1.0f;
 
     return roll_chance_f(_chance * qualityModifier);
 }
@@ -799,11 +809,11 @@ void Loot::generateMoneyLoot(uint32 minAmount, uint32 maxAmount)
     if (maxAmount > 0)
     {
         if (maxAmount <= minAmount)
-            gold = uint32(maxAmount * CONF_GET_FLOAT("Rate.Drop.Money"));
+            gold = uint32(maxAmount * moneyRate.Get());
         else if ((maxAmount - minAmount) < 32700)
-            gold = uint32(urand(minAmount, maxAmount) * CONF_GET_FLOAT("Rate.Drop.Money"));
+            gold = uint32(urand(minAmount, maxAmount) * moneyRate.Get());
         else
-            gold = uint32(urand(minAmount >> 8, maxAmount >> 8) * CONF_GET_FLOAT("Rate.Drop.Money")) << 8;
+            gold = uint32(urand(minAmount >> 8, maxAmount >> 8) * moneyRate.Get()) << 8;
     }
 }
 
@@ -1250,39 +1260,32 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
 // Rolls an item from the group, returns nullptr if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, Player const* player, LootStore const& store, uint16 lootMode) const
 {
-    LootStoreItemList possibleLoot = ExplicitlyChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    LootGroupInvalidSelector isInvalid(loot, lootMode);
 
-    if (!possibleLoot.empty())                             // First explicitly chanced entries are checked
+    if (!ExplicitlyChanced.empty())                         // First explicitly chanced entries are checked
     {
-        float roll = (float)rand_chance();
-
-        for (LootStoreItemList::const_iterator itr = possibleLoot.begin(); itr != possibleLoot.end(); ++itr)   // check each explicitly chanced entry in the template and modify its chance based on quality.
+        // check each explicitly chanced entry in the template and modify its chance based on quality.
+        Optional<LootStoreItem*> item = Warhead::LootRoll::RollExplicitlyChanced(ExplicitlyChanced, float(rand_chance()), isInvalid, [&](LootStoreItem* entry) -> Optional<float>
         {
-            LootStoreItem* item = *itr;
-            float chance = item->chance;
+            float chance = entry->chance;
+            if (!sScriptMgr->OnItemRoll(player, entry, chance, loot, store))
+                return {};
 
-            if (!sScriptMgr->OnItemRoll(player, item, chance, loot, store))
-                return nullptr;
+            return chance;
+        });
 
-            if (chance >= 100.0f)
-                return item;
+        if (!item)
+            return nullptr;
 
-            roll -= chance;
-            if (roll < 0)
-                return item;
-        }
+        if (*item)
+            return *item;
     }
 
     if (!sScriptMgr->OnBeforeLootEqualChanced(player, EqualChanced, loot, store))
         return nullptr;
 
-    possibleLoot = EqualChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
-    if (!possibleLoot.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
-        return Warhead::Containers::SelectRandomContainerElement(possibleLoot);
-
-    return nullptr;                                            // Empty drop from the group
+    // If nothing selected yet - an item is taken from equal-chanced part, nullptr is an empty drop from the group
+    return Warhead::LootRoll::SelectEqualChanced(EqualChanced, isInvalid);
 }
 
 // True if group includes at least 1 quest drop entry
@@ -1405,7 +1408,7 @@ void LootTemplate::LootGroup::Process(Loot& loot, Player const* player, LootStor
         {
             if (LootTemplate const* Referenced = LootTemplates_Reference.GetLootFor(std::abs(item->reference)))
             {
-                uint32 maxcount = uint32(float(item->maxcount) * CONF_GET_FLOAT("Rate.Drop.Item.ReferencedAmount"));
+                uint32 maxcount = uint32(float(item->maxcount) * referencedAmountRate.Get());
                 sScriptMgr->OnAfterRefCount(player, loot, rate, lootMode, const_cast<LootStoreItem*>(item), maxcount, store);
 
                 for (uint32 loop = 0; loop < maxcount; ++loop) // Ref multiplicator
@@ -1680,7 +1683,7 @@ void LootTemplate::Process(Loot& loot, LootStore const& store, uint16 lootMode,
             if (!Referenced)
                 continue;                                       // Error message already printed at loading stage
 
-            uint32 maxcount = uint32(float(item->maxcount) * CONF_GET_FLOAT("Rate.Drop.Item.ReferencedAmount"));
+            uint32 maxcount = uint32(float(item->maxcount) * referencedAmountRate.Get());
             sScriptMgr->OnAfterRefCount(player, loot, rate, lootMode, item, maxcount, store);
             for (uint32 loop = 0; loop < maxcount; ++loop)      // Ref multiplicator
                 Referenced->Process(loot, store, lootMode, player, item->groupid);
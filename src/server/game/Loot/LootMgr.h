@@ -123,6 +123,7 @@ class Player;
 class LootStore;
 class ConditionMgr;
 class GameObject;
+struct ItemTemplate;
 struct Loot;
 
 struct LootStoreItem
@@ -136,12 +137,13 @@ struct LootStoreItem
     uint8   mincount;                                       // mincount for drop items
     uint8   maxcount;                                       // max drop count for the item mincount or Ref multiplicator
     ConditionList conditions;                               // additional loot condition
+    ItemTemplate const* itemProto;                          // cached at loading stage, nullptr for references
 
     // Constructor
     // displayid is filled in IsValid() which must be called after
     LootStoreItem(uint32 _itemid, int32 _reference, float _chance, bool _needs_quest, uint16 _lootmode, uint8 _groupid, int32 _mincount, uint8 _maxcount)
         : itemid(_itemid), reference(_reference), chance(_chance), needs_quest(_needs_quest),
-          lootmode(_lootmode), groupid(_groupid), mincount(_mincount), maxcount(_maxcount)
+          lootmode(_lootmode), groupid(_groupid), mincount(_mincount), maxcount(_maxcount), itemProto(nullptr)
     {}
 
     bool Roll(bool rate, Player const* player, Loot& loot, LootStore const& store) const;                             // Checks if the entry takes it's chance (at loot generation)
@@ -199,7 +201,7 @@ class LootTemplate;
 typedef std::vector<QuestItem> QuestItemList;
 typedef std::vector<LootItem> LootItemList;
 typedef std::map<ObjectGuid, QuestItemList*> QuestItemMap;
-typedef std::list<LootStoreItem*> LootStoreItemList;
+typedef std::vector<LootStoreItem*> LootStoreItemList;
 typedef std::unordered_map<uint32, LootTemplate*> LootTemplateMap;
 
 typedef std::set<uint32> LootIdSet;
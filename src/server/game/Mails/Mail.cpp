@@ -30,6 +30,7 @@
 #include "ScriptMgr.h"
 #include "Unit.h"
 #include "World.h"
+#include "WorldSession.h"
 
 MailSender::MailSender(Object* sender, MailStationery stationery) : m_stationery(stationery)
 {
@@ -203,6 +204,9 @@ void MailDraft::SendMailTo(CharacterDatabaseTransaction trans, MailReceiver cons
     Player* pReceiver = receiver.GetPlayer();               // can be nullptr
     Player* pSender = ObjectAccessor::FindPlayerByLowGUID(sender.GetSenderId());
 
+    if (!pReceiver)
+        WorldSession::InvalidateLoginPrefetch(receiver.GetPlayerGUIDLow());
+
     if (pReceiver)
         prepareItems(pReceiver, trans);                            // generate mail template items
 
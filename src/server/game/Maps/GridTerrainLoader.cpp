@@ -0,0 +1,208 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridTerrainLoader.h"
+#include "Log.h"
+#include "Map.h"
+#include "Metric.h"
+
+GridTerrainLoader::GridTerrainLoader() : _cancelationToken(false), _maxPreparedGrids(0)
+{
+}
+
+GridTerrainLoader::~GridTerrainLoader()
+{
+    Deactivate();
+}
+
+void GridTerrainLoader::Activate(size_t numThreads, size_t maxPreparedGrids)
+{
+    _maxPreparedGrids = maxPreparedGrids;
+    _cancelationToken = false;
+
+    _workerThreads.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i)
+        _workerThreads.push_back(std::thread(&GridTerrainLoader::WorkerThread, this));
+}
+
+void GridTerrainLoader::Deactivate()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _cancelationToken = true;
+    }
+
+    _queueCondition.notify_all();
+
+    for (auto& thread : _workerThreads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+
+    _workerThreads.clear();
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    for (auto& [key, request] : _requests)
+        delete request.Terrain;
+
+    _requests.clear();
+    _preparedOrder.clear();
+    _normalQueue.clear();
+    _lowQueue.clear();
+}
+
+bool GridTerrainLoader::Enqueue(uint32 mapId, uint32 gx, uint32 gy, GridLoadPriority priority /*= GridLoadPriority::Normal*/)
+{
+    if (!IsActive())
+        return false;
+
+    uint64 key = MakeKey(mapId, gx, gy);
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    auto itr = _requests.find(key);
+    if (itr != _requests.end())
+    {
+        // promote a speculative request, worker skips the stale low queue entry
+        if (priority == GridLoadPriority::Normal && itr->second.State == RequestState::Queued && itr->second.Priority == GridLoadPriority::Low)
+        {
+            itr->second.Priority = GridLoadPriority::Normal;
+            _normalQueue.push_back(key);
+            _queueCondition.notify_one();
+        }
+
+        return false;
+    }
+
+    // make room by dropping terrain prepared for grids nobody walked into
+    while (_requests.size() >= _maxPreparedGrids && !_preparedOrder.empty())
+    {
+        auto prepared = _requests.find(_preparedOrder.front());
+        _preparedOrder.pop_front();
+
+        delete prepared->second.Terrain;
+        _requests.erase(prepared);
+    }
+
+    if (_requests.size() >= _maxPreparedGrids)
+        return false;
+
+    _requests.emplace(key, Request{ RequestState::Queued, priority, nullptr, _preparedOrder.end() });
+
+    if (priority == GridLoadPriority::Normal)
+        _normalQueue.push_back(key);
+    else
+        _lowQueue.push_back(key);
+
+    _queueCondition.notify_one();
+    return true;
+}
+
+GridMap* GridTerrainLoader::Take(uint32 mapId, uint32 gx, uint32 gy)
+{
+    if (!IsActive())
+        return nullptr;
+
+    uint64 key = MakeKey(mapId, gx, gy);
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    auto itr = _requests.find(key);
+    if (itr == _requests.end())
+        return nullptr;
+
+    // not started yet or being read right now: the caller loads it right away, the worker
+    // skips the missing request or drops its result, waiting would stall the map update
+    if (itr->second.State != RequestState::Prepared)
+    {
+        _requests.erase(itr);
+        return nullptr;
+    }
+
+    GridMap* terrain = itr->second.Terrain;
+    _preparedOrder.erase(itr->second.PreparedItr);
+    _requests.erase(itr);
+    return terrain;
+}
+
+bool GridTerrainLoader::IsQueuedOrPrepared(uint32 mapId, uint32 gx, uint32 gy) const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _requests.find(MakeKey(mapId, gx, gy)) != _requests.end();
+}
+
+void GridTerrainLoader::WorkerThread()
+{
+    while (true)
+    {
+        uint64 key = 0;
+
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+
+            while (!_cancelationToken && _normalQueue.empty() && _lowQueue.empty())
+                _queueCondition.wait(guard);
+
+            if (_cancelationToken)
+                return;
+
+            std::deque<uint64>& queue = !_normalQueue.empty() ? _normalQueue : _lowQueue;
+            key = queue.front();
+            queue.pop_front();
+
+            // taken by the map, promoted to the other queue or already handled
+            auto itr = _requests.find(key);
+            if (itr == _requests.end() || itr->second.State != RequestState::Queued)
+                continue;
+
+            itr->second.State = RequestState::Loading;
+        }
+
+        uint32 mapId = uint32(key >> 32);
+        uint32 gx = uint32(key >> 16) & 0xFFFF;
+        uint32 gy = uint32(key) & 0xFFFF;
+
+        GridMap* terrain = new GridMap();
+
+        {
+            METRIC_TIMER("map_grid_load_time", METRIC_TAG("map_id", std::to_string(mapId)), METRIC_TAG("stage", "prepare_terrain"));
+
+            if (!terrain->loadData(Map::GetGridMapFileName(mapId, gx, gy)))
+            {
+                // let the map thread retry and report the error
+                delete terrain;
+                terrain = nullptr;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+
+            auto itr = _requests.find(key);
+            if (itr != _requests.end())
+            {
+                itr->second.State = RequestState::Prepared;
+                itr->second.Terrain = terrain;
+                itr->second.PreparedItr = _preparedOrder.insert(_preparedOrder.end(), key);
+            }
+            else
+                delete terrain;
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _GRID_TERRAIN_LOADER_H_INCLUDED
+#define _GRID_TERRAIN_LOADER_H_INCLUDED
+
+#include "Define.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class GridMap;
+
+enum class GridLoadPriority : uint8
+{
+    Normal, // grid is expected to be touched soon (neighbour of a loaded grid)
+    Low     // speculative, served only when no normal request is waiting
+};
+
+/*
+ * Prepares terrain (.map files) of grids on background threads.
+ *
+ * Only file I/O and parsing into a GridMap happen off the map thread, the map
+ * picks the result up in Map::LoadMap (commit stage) and falls back to a
+ * synchronous load if nothing was prepared. VMap and MMap tiles are still
+ * loaded by the map thread because their trees are shared with readers.
+ */
+class WH_GAME_API GridTerrainLoader
+{
+public:
+    GridTerrainLoader();
+    ~GridTerrainLoader();
+
+    void Activate(size_t numThreads, size_t maxPreparedGrids);
+    void Deactivate();
+    [[nodiscard]] bool IsActive() const { return !_workerThreads.empty(); }
+
+    // Queue terrain of a base map grid, ignored if already queued, prepared or over the budget
+    bool Enqueue(uint32 mapId, uint32 gx, uint32 gy, GridLoadPriority priority = GridLoadPriority::Normal);
+
+    // Hand over prepared terrain, nullptr if not prepared (yet). Never waits for a worker, the caller loads it itself then
+    GridMap* Take(uint32 mapId, uint32 gx, uint32 gy);
+
+    [[nodiscard]] bool IsQueuedOrPrepared(uint32 mapId, uint32 gx, uint32 gy) const;
+
+private:
+    enum class RequestState : uint8
+    {
+        Queued,
+        Loading,
+        Prepared
+    };
+
+    struct Request
+    {
+        RequestState State;
+        GridLoadPriority Priority;
+        GridMap* Terrain;
+        std::list<uint64>::iterator PreparedItr; // position in _preparedOrder once prepared
+    };
+
+    static uint64 MakeKey(uint32 mapId, uint32 gx, uint32 gy) { return (uint64(mapId) << 32) | (gx << 16) | gy; }
+
+    void WorkerThread();
+
+    std::vector<std::thread> _workerThreads;
+    std::atomic<bool> _cancelationToken;
+
+    mutable std::mutex _lock;
+    std::condition_variable _queueCondition;
+
+    std::deque<uint64> _normalQueue;
+    std::deque<uint64> _lowQueue;
+    std::unordered_map<uint64, Request> _requests;
+    std::list<uint64> _preparedOrder; // prepared requests, oldest first
+    size_t _maxPreparedGrids;
+};
+
+#endif //_GRID_TERRAIN_LOADER_H_INCLUDED
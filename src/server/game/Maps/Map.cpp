@@ -60,6 +60,9 @@ u_map_magic MapLiquidMagic  = { {'M', 'L', 'I', 'Q'} };
 static uint16 const holetab_h[4] = { 0x1111, 0x2222, 0x4444, 0x8888 };
 static uint16 const holetab_v[4] = { 0x000F, 0x00F0, 0x0F00, 0xF000 };
 
+// Line of sight cache resolution, rays whose endpoints round to the same 0.1 yard step share a result
+static float const LOS_CACHE_GRID_STEPS_PER_YARD = 10.0f;
+
 ZoneDynamicInfo::ZoneDynamicInfo() : MusicId(0), WeatherId(WEATHER_STATE_FINE),
                                      WeatherGrade(0.0f), OverrideLightId(0), LightFadeInTime(0) { }
 
@@ -207,21 +210,119 @@ void Map::LoadMap(int gx, int gy, bool reload)
         GridMaps[gx][gy] = nullptr;
     }
 
-    std::string mapName = Warhead::StringFormat(sWorld->GetDataPath() + "maps/{:03}{:02}{:02}.map", GetId(), gx, gy);
+    // terrain read in background by GridTerrainLoader, only the hand over happens here
+    if (!reload)
+        GridMaps[gx][gy] = sMapMgr->GetGridTerrainLoader()->Take(GetId(), gx, gy);
 
-    LOG_DEBUG("maps", "Loading map {}", mapName);
+    if (!GridMaps[gx][gy])
+    {
+        std::string mapName = GetGridMapFileName(GetId(), gx, gy);
 
-    // loading data
-    GridMaps[gx][gy] = new GridMap();
+        LOG_DEBUG("maps", "Loading map {}", mapName);
 
-    if (!GridMaps[gx][gy]->loadData(mapName))
-    {
-        LOG_ERROR("maps", "Error loading map file: \n {}\n", mapName);
+        // loading data
+        GridMaps[gx][gy] = new GridMap();
+
+        if (!GridMaps[gx][gy]->loadData(mapName))
+        {
+            LOG_ERROR("maps", "Error loading map file: \n {}\n", mapName);
+        }
     }
 
     sScriptMgr->OnLoadGridMap(this, GridMaps[gx][gy], gx, gy);
 }
 
+std::string Map::GetGridMapFileName(uint32 mapid, int gx, int gy)
+{
+    return Warhead::StringFormat(sWorld->GetDataPath() + "maps/{:03}{:02}{:02}.map", mapid, gx, gy);
+}
+
+void Map::PrepareGridTerrain(GridCoord const& p, GridLoadPriority priority /*= GridLoadPriority::Normal*/)
+{
+    if (!p.IsCoordValid())
+        return;
+
+    int gx = (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord;
+    int gy = (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord;
+
+    // terrain is owned by the base map, instances share it. Instances run on other threads than
+    // the base map loads its grids from, GridMaps of the base map are written under its GridLock
+    if (m_parentMap != this)
+    {
+        std::lock_guard<std::mutex> guard(m_parentMap->GridLock);
+        if (m_parentMap->GridMaps[gx][gy])
+            return;
+    }
+    else if (GridMaps[gx][gy])
+        return;
+
+    sMapMgr->GetGridTerrainLoader()->Enqueue(GetId(), gx, gy, priority);
+}
+
+void Map::PreloadGrid(float x, float y)
+{
+    if (!CONF_GET_UINT("GridLoader.Preload.GridsPerUpdate"))
+        return;
+
+    GridCoord p = Warhead::ComputeGridCoord(x, y);
+    if (!p.IsCoordValid())
+        return;
+
+    NGridType* grid = getNGrid(p.x_coord, p.y_coord);
+    if (grid && grid->isGridObjectDataLoaded())
+        return;
+
+    if (!_gridPreloadQueued.insert(p.x_coord * MAX_NUMBER_OF_GRIDS + p.y_coord).second)
+        return;
+
+    _gridPreloadQueue.emplace_back(x, y);
+
+    // terrain can be read right away, objects wait for the budget in UpdateGridPreloads
+    PrepareGridTerrain(p, GridLoadPriority::Low);
+}
+
+void Map::UpdateGridPreloads()
+{
+    uint32 budget = CONF_GET_UINT("GridLoader.Preload.GridsPerUpdate");
+
+    while (budget && !_gridPreloadQueue.empty())
+    {
+        Position pos = _gridPreloadQueue.front();
+        _gridPreloadQueue.pop_front();
+
+        GridCoord p = Warhead::ComputeGridCoord(pos.GetPositionX(), pos.GetPositionY());
+        _gridPreloadQueued.erase(p.x_coord * MAX_NUMBER_OF_GRIDS + p.y_coord);
+
+        // only count grids actually loaded, a player may have reached it first
+        if (EnsureGridLoaded(Cell(pos.GetPositionX(), pos.GetPositionY())))
+            --budget;
+    }
+}
+
+void Map::PreloadGridsAhead(Player* player)
+{
+    // taxi flights preload along their known path, see FlightPathMovementGenerator
+    if (!player->isMoving() || player->IsInFlight())
+        return;
+
+    float lookahead = CONF_GET_FLOAT("GridLoader.Preload.Lookahead");
+    if (lookahead <= 0.0f)
+        return;
+
+    // walking players never outrun the visibility range, only fast travel is predicted
+    if (!player->IsMounted() && !player->IsFlying())
+        return;
+
+    float distance = player->GetSpeed(player->IsFlying() ? MOVE_FLIGHT : MOVE_RUN) * lookahead;
+    float x = player->GetPositionX() + std::cos(player->GetOrientation()) * distance;
+    float y = player->GetPositionY() + std::sin(player->GetOrientation()) * distance;
+
+    if (Warhead::ComputeGridCoord(x, y) == Warhead::ComputeGridCoord(player->GetPositionX(), player->GetPositionY()))
+        return;
+
+    PreloadGrid(x, y);
+}
+
 void Map::LoadMapAndVMap(int gx, int gy)
 {
     LoadMap(gx, gy);
@@ -236,7 +337,8 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
     m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
     _instanceResetPeriod(0), m_activeNonPlayersIter(m_activeNonPlayers.end()),
-    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
+    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id)),
+    _lineOfSightCacheHits(0), _lineOfSightCacheMisses(0)
 {
     m_parentMap = (_parent ? _parent : this);
     for (unsigned int idx = 0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
@@ -455,6 +557,7 @@ void Map::EnsureGridCreated_i(const GridCoord& p)
 
         if (!GridMaps[gx][gy])
         {
+            METRIC_TIMER("map_grid_load_time", METRIC_TAG("map_id", std::to_string(GetId())), METRIC_TAG("stage", "terrain"));
             LoadMapAndVMap(gx, gy);
         }
 
@@ -478,10 +581,24 @@ bool Map::EnsureGridLoaded(const Cell& cell)
 
         setGridObjectDataLoaded(true, cell.GridX(), cell.GridY());
 
-        ObjectGridLoader loader(*grid, this, cell);
-        loader.LoadN();
+        {
+            METRIC_TIMER("map_grid_load_time", METRIC_TAG("map_id", std::to_string(GetId())), METRIC_TAG("stage", "objects"));
+
+            ObjectGridLoader loader(*grid, this, cell);
+            loader.LoadN();
+        }
+
+        {
+            METRIC_TIMER("map_grid_load_time", METRIC_TAG("map_id", std::to_string(GetId())), METRIC_TAG("stage", "balance"));
+            Balance();
+        }
+
+        // whoever walked into this grid is likely to reach one of its neighbours next
+        for (int32 dx = -1; dx <= 1; ++dx)
+            for (int32 dy = -1; dy <= 1; ++dy)
+                if (dx || dy)
+                    PrepareGridTerrain(GridCoord(cell.GridX() + dx, cell.GridY() + dy));
 
-        Balance();
         return true;
         //}
     }
@@ -658,7 +775,7 @@ bool Map::IsGridLoaded(const GridCoord& p) const
     return (getNGrid(p.x_coord, p.y_coord) && isGridObjectDataLoaded(p.x_coord, p.y_coord));
 }
 
-void Map::VisitNearbyCellsOfPlayer(Player* player, TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& gridVisitor,
+void Map::VisitNearbyCellsOfPlayer(Player* player, float range, TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& gridVisitor,
                                    TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& worldVisitor,
                                    TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& largeGridVisitor,
                                    TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& largeWorldVisitor)
@@ -667,8 +784,8 @@ void Map::VisitNearbyCellsOfPlayer(Player* player, TypeContainerVisitor<Warhead:
     if (!player->IsPositionValid())
         return;
 
-    // check normal grid activation range of the player
-    VisitNearbyCellsOf(player, gridVisitor, worldVisitor, largeGridVisitor, largeWorldVisitor);
+    // check normal grid activation range of the player (or the near range when creature updates are throttled)
+    VisitNearbyCellsOf(player, range, gridVisitor, worldVisitor, largeGridVisitor, largeWorldVisitor);
 
     // check maximum visibility distance for large creatures
     CellArea area = Cell::CalculateCellArea(player->GetPositionX(), player->GetPositionY(), MAX_VISIBILITY_DISTANCE);
@@ -697,16 +814,24 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Warhead::Obj
                              TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& worldVisitor,
                              TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& largeGridVisitor,
                              TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& largeWorldVisitor)
+{
+    VisitNearbyCellsOf(obj, obj->GetGridActivationRange(), gridVisitor, worldVisitor, largeGridVisitor, largeWorldVisitor);
+}
+
+void Map::VisitNearbyCellsOf(WorldObject* obj, float range, TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& gridVisitor,
+                             TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& worldVisitor,
+                             TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& largeGridVisitor,
+                             TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& largeWorldVisitor)
 {
     // Check for valid position
     if (!obj->IsPositionValid())
         return;
 
-    if (obj->GetGridActivationRange() <= 0.0f) // pussywizard: gameobjects for example are on active lists, but range is equal to 0 (they just prevent grid unloading)
+    if (range <= 0.0f) // pussywizard: gameobjects for example are on active lists, but range is equal to 0 (they just prevent grid unloading)
         return;
 
     // Update mobs/objects in ALL visible cells around object!
-    CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), obj->GetGridActivationRange());
+    CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), range);
 
     for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
     {
@@ -736,8 +861,14 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Warhead::Obj
     }
 }
 
+static GameConfigOption<uint32> const creatureUpdateThrottleInterval("Creature.UpdateThrottle.Interval", 0);
+static GameConfigOption<float> const creatureUpdateNearDistance("Creature.UpdateThrottle.NearDistance", 40.0f);
+
 void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 {
+    // Units have moved since the previous update, cached rays are stale
+    InvalidateLineOfSightCache();
+
     if (t_diff)
         _dynamicTree.update(t_diff);
 
@@ -754,6 +885,31 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
     }
 
+    // every movement opcode of this update is handled, send the coalesced relays together
+    if (WorldSession::IsMovementCoalesced())
+    {
+        WorldSession::MovementFlushStats movementStats;
+        for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
+        {
+            WorldSession::MovementFlushStats stats = m_mapRefIter->GetSource()->GetSession()->FlushMovementPackets();
+            movementStats.Sent += stats.Sent;
+            movementStats.Merged += stats.Merged;
+            movementStats.Interrupted += stats.Interrupted;
+        }
+
+        METRIC_VALUE("map_movement_relays", uint64(movementStats.Sent),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_movement_relays_merged", uint64(movementStats.Merged),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_movement_relays_interrupted", uint64(movementStats.Interrupted),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+    }
+
     if (!t_diff)
     {
         for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
@@ -768,9 +924,13 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
 
         HandleDelayedVisibility();
+        FlushCombatLogPackets();
         return;
     }
 
+    /// load grids requested ahead of fast travelling players
+    UpdateGridPreloads();
+
     /// update active cells around players and active objects
     resetMarkedCells();
     resetMarkedCellsLarge();
@@ -791,6 +951,10 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     std::vector<Creature*> updateList;
     updateList.reserve(10);
 
+    // on continents only the cells near players are updated at full rate in the player loop,
+    // creatures in the rest of their activation range are updated with a throttle afterwards
+    uint32 creatureThrottleInterval = Instanceable() ? 0 : creatureUpdateThrottleInterval.Get();
+
     // non-player active objects, increasing iterator in the loop in case of object removal
     for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
     {
@@ -815,7 +979,14 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         // update players at tick
         player->Update(s_diff);
 
-        VisitNearbyCellsOfPlayer(player, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
+        if (!Instanceable())
+            PreloadGridsAhead(player);
+
+        float updateRange = player->GetGridActivationRange();
+        if (creatureThrottleInterval)
+            updateRange = std::min(updateRange, creatureUpdateNearDistance.Get());
+
+        VisitNearbyCellsOfPlayer(player, updateRange, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
 
         // If player is using far sight, visit that object too
         if (WorldObject* viewPoint = player->GetViewpoint())
@@ -850,6 +1021,36 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
     }
 
+    // cells visited above are skipped, everything left is out of the near range of all players
+    Warhead::ObjectUpdater farObjectUpdater(t_diff, false, creatureThrottleInterval);
+    if (creatureThrottleInterval)
+    {
+        TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer  > grid_far_object_update(farObjectUpdater);
+        TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer > world_far_object_update(farObjectUpdater);
+
+        for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
+        {
+            Player* player = m_mapRefIter->GetSource();
+
+            if (!player || !player->IsInWorld())
+                continue;
+
+            VisitNearbyCellsOf(player, grid_far_object_update, world_far_object_update, grid_large_object_update, world_large_object_update);
+        }
+    }
+
+    METRIC_VALUE("map_creatures_near", uint64(updater.i_creatureUpdates + largeObjectUpdater.i_creatureUpdates),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_creatures_far", uint64(farObjectUpdater.i_creatureUpdates + farObjectUpdater.i_creatureUpdatesDeferred),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_creatures_far_deferred", uint64(farObjectUpdater.i_creatureUpdatesDeferred),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
     for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();) // pussywizard: transports updated after VisitNearbyCellsOf, grids around are loaded, everything ok
     {
         MotionTransport* transport = *_transportsUpdateIter;
@@ -879,6 +1080,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
+    FlushCombatLogPackets();
+
     METRIC_VALUE("map_creatures", uint64(GetObjectsStore().Size<Creature>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
@@ -886,6 +1089,46 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_los_cache_hits", uint64(_lineOfSightCacheHits),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_los_cache_misses", uint64(_lineOfSightCacheMisses),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    _lineOfSightCacheHits = 0;
+    _lineOfSightCacheMisses = 0;
+}
+
+void Map::FlushCombatLogPackets()
+{
+    if (!WorldSession::IsCombatLogAggregated())
+        return;
+
+    // the combat of this update goes out together
+    WorldSession::CombatLogFlushStats combatLogStats;
+    for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
+    {
+        WorldSession::CombatLogFlushStats stats = m_mapRefIter->GetSource()->GetSession()->FlushCombatLogPackets();
+        combatLogStats.Sent += stats.Sent;
+        combatLogStats.Merged += stats.Merged;
+        combatLogStats.Trimmed += stats.Trimmed;
+        combatLogStats.BytesSaved += stats.BytesSaved;
+    }
+
+    METRIC_VALUE("map_combat_log_packets", uint64(combatLogStats.Sent),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_combat_log_packets_saved", uint64(combatLogStats.Merged + combatLogStats.Trimmed),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_combat_log_bytes_saved", combatLogStats.BytesSaved,
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
 }
 
 void Map::HandleDelayedVisibility()
@@ -2443,14 +2686,80 @@ float Map::GetWaterLevel(float x, float y) const
         return 0;
 }
 
+static GameConfigOption<bool> const checkGameObjectLoS("CheckGameObjectLoS");
+static GameConfigOption<bool> const lineOfSightCacheEnable("LineOfSight.Cache.Enable");
+static GameConfigOption<uint32> const lineOfSightCacheMaxEntries("LineOfSight.Cache.MaxEntries");
+
+bool Map::IsLineOfSightCacheEnabled()
+{
+    return lineOfSightCacheEnable.Get();
+}
+
 bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    bool checkGameObjects = checkGameObjectLoS.Get();
+
+    if (!lineOfSightCacheEnable.Get())
+        return CalculateLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, checks, ignoreFlags, checkGameObjects);
+
+    return GetCachedLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, checks, ignoreFlags, checkGameObjects, lineOfSightCacheMaxEntries.Get());
+}
+
+void Map::isInLineOfSight(std::vector<LineOfSightQuery>& queries, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    // Options are resolved once for the whole batch, identical rays are answered by the cache
+    bool checkGameObjects = checkGameObjectLoS.Get();
+    bool useCache = lineOfSightCacheEnable.Get();
+    uint32 maxEntries = lineOfSightCacheMaxEntries.Get();
+
+    for (LineOfSightQuery& query : queries)
+    {
+        if (useCache)
+            query.Result = GetCachedLineOfSight(query.X1, query.Y1, query.Z1, query.X2, query.Y2, query.Z2, query.PhaseMask, checks, ignoreFlags, checkGameObjects, maxEntries);
+        else
+            query.Result = CalculateLineOfSight(query.X1, query.Y1, query.Z1, query.X2, query.Y2, query.Z2, query.PhaseMask, checks, ignoreFlags, checkGameObjects);
+    }
+}
+
+bool Map::GetCachedLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, bool checkGameObjects, uint32 maxEntries) const
+{
+    auto Quantize = [](float coord) -> int32
+    {
+        return int32(std::lround(coord * LOS_CACHE_GRID_STEPS_PER_YARD));
+    };
+
+    LineOfSightCacheKey key;
+    key.Coords = { Quantize(x1), Quantize(y1), Quantize(z1), Quantize(x2), Quantize(y2), Quantize(z2) };
+    key.PhaseMask = phasemask;
+    key.Flags = uint32(checks) | (uint32(ignoreFlags) << 8);
+
+    auto itr = _lineOfSightCache.find(key);
+    if (itr != _lineOfSightCache.end())
+    {
+        ++_lineOfSightCacheHits;
+        return itr->second;
+    }
+
+    ++_lineOfSightCacheMisses;
+
+    bool result = CalculateLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, checks, ignoreFlags, checkGameObjects);
+
+    // hard cap for crowded maps, cheaper than any eviction policy for a memo that only lives one tick
+    if (_lineOfSightCache.size() >= maxEntries)
+        _lineOfSightCache.clear();
+
+    _lineOfSightCache.emplace(key, result);
+    return result;
+}
+
+bool Map::CalculateLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, bool checkGameObjects) const
 {
     if ((checks & LINEOFSIGHT_CHECK_VMAP) && !VMAP::VMapFactory::createOrGetVMapMgr()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags))
     {
         return false;
     }
 
-    if (CONF_GET_BOOL("CheckGameObjectLoS") && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL))
+    if (checkGameObjects && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL))
     {
         ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
         if (!(checks & LINEOFSIGHT_CHECK_GOBJECT_M2))
@@ -24,6 +24,7 @@
 #include "Define.h"
 #include "DynamicTree.h"
 #include "GameObjectModel.h"
+#include "GridTerrainLoader.h"
 #include "GridDefines.h"
 #include "GridRefMgr.h"
 #include "MapRefMgr.h"
@@ -33,11 +34,14 @@
 #include "Position.h"
 #include "SharedDefines.h"
 #include "Timer.h"
+#include <array>
 #include <bitset>
+#include <deque>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 
 class Unit;
 class WorldPacket;
@@ -197,6 +201,46 @@ enum LineOfSightChecks
     LINEOFSIGHT_ALL_CHECKS          = LINEOFSIGHT_CHECK_VMAP | LINEOFSIGHT_CHECK_GOBJECT_ALL
 };
 
+// Single ray for the batched Map::isInLineOfSight overload, Result is filled by the map
+struct LineOfSightQuery
+{
+    LineOfSightQuery(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phaseMask) :
+        X1(x1), Y1(y1), Z1(z1), X2(x2), Y2(y2), Z2(z2), PhaseMask(phaseMask) { }
+
+    float X1, Y1, Z1;
+    float X2, Y2, Z2;
+    uint32 PhaseMask;
+    bool Result{ true };
+};
+
+// Key of the per-tick line of sight memo: quantized endpoints, phase mask and check flags
+struct LineOfSightCacheKey
+{
+    std::array<int32, 6> Coords;
+    uint32 PhaseMask;
+    uint32 Flags;
+
+    bool operator==(LineOfSightCacheKey const& right) const
+    {
+        return Coords == right.Coords && PhaseMask == right.PhaseMask && Flags == right.Flags;
+    }
+};
+
+struct LineOfSightCacheKeyHash
+{
+    std::size_t operator()(LineOfSightCacheKey const& key) const
+    {
+        std::size_t hash = std::hash<uint32>()(key.PhaseMask) ^ (std::size_t(key.Flags) << 1);
+
+        for (int32 coord : key.Coords)
+            hash ^= std::hash<int32>()(coord) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+        return hash;
+    }
+};
+
+typedef std::unordered_map<LineOfSightCacheKey, bool, LineOfSightCacheKeyHash> LineOfSightCache;
+
 class WH_GAME_API GridMap
 {
     uint32  _flags;
@@ -339,7 +383,11 @@ public:
                             TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& worldVisitor,
                             TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& largeGridVisitor,
                             TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& largeWorldVisitor);
-    void VisitNearbyCellsOfPlayer(Player* player, TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& gridVisitor,
+    void VisitNearbyCellsOf(WorldObject* obj, float range, TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& gridVisitor,
+                            TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& worldVisitor,
+                            TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& largeGridVisitor,
+                            TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& largeWorldVisitor);
+    void VisitNearbyCellsOfPlayer(Player* player, float range, TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& gridVisitor,
                                   TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& worldVisitor,
                                   TypeContainerVisitor<Warhead::ObjectUpdater, GridTypeMapContainer>& largeGridVisitor,
                                   TypeContainerVisitor<Warhead::ObjectUpdater, WorldTypeMapContainer>& largeWorldVisitor);
@@ -378,6 +426,7 @@ public:
 
     static bool ExistMap(uint32 mapid, int gx, int gy);
     static bool ExistVMap(uint32 mapid, int gx, int gy);
+    static std::string GetGridMapFileName(uint32 mapid, int gx, int gy);
 
     [[nodiscard]] Map const* GetParent() const { return m_parentMap; }
 
@@ -386,6 +435,7 @@ public:
     // pussywizard:
     std::unordered_set<Unit*> i_objectsForDelayedVisibility;
     void HandleDelayedVisibility();
+    void FlushCombatLogPackets();
 
     // some calls like isInWater should not use vmaps due to processor power
     // can return INVALID_HEIGHT if under z+2 z coord not found height
@@ -548,13 +598,16 @@ public:
     float GetWaterOrGroundLevel(uint32 phasemask, float x, float y, float z, float* ground = nullptr, bool swim = false, float collisionHeight = DEFAULT_COLLISION_HEIGHT) const;
     [[nodiscard]] float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
     [[nodiscard]] bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+    void isInLineOfSight(std::vector<LineOfSightQuery>& queries, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+    void InvalidateLineOfSightCache() { _lineOfSightCache.clear(); }
+    [[nodiscard]] static bool IsLineOfSightCacheEnabled();
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, PathGenerator *path, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CheckCollisionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true) const;
-    void Balance() { _dynamicTree.balance(); }
-    void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); }
-    void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
+    void Balance() { _dynamicTree.balance(); InvalidateLineOfSightCache(); }
+    void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); InvalidateLineOfSightCache(); }
+    void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); InvalidateLineOfSightCache(); }
     [[nodiscard]] bool ContainsGameObjectModel(const GameObjectModel& model) const { return _dynamicTree.contains(model);}
     [[nodiscard]] DynamicMapTree const& GetDynamicMapTree() const { return _dynamicTree; }
     bool GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist);
@@ -620,6 +673,9 @@ public:
 
     GridMap* GetGrid(float x, float y);
     void EnsureGridCreated(const GridCoord&);
+    void PrepareGridTerrain(GridCoord const& p, GridLoadPriority priority = GridLoadPriority::Normal);
+    // Queue loading of the grid at x, y ahead of a player, loaded with a per update budget
+    void PreloadGrid(float x, float y);
     [[nodiscard]] bool AllTransportsEmpty() const; // pussywizard
     void AllTransportsRemovePassengers(); // pussywizard
     [[nodiscard]] TransportsContainer const& GetAllTransports() const { return _transports; }
@@ -688,8 +744,14 @@ private:
 
     void UpdateActiveCells(const float& x, const float& y, const uint32 t_diff);
 
+    void UpdateGridPreloads();
+    void PreloadGridsAhead(Player* player);
+
     void SendObjectUpdates();
 
+    [[nodiscard]] bool CalculateLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, bool checkGameObjects) const;
+    [[nodiscard]] bool GetCachedLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags, bool checkGameObjects, uint32 maxEntries) const;
+
 protected:
     std::mutex Lock;
     std::mutex GridLock;
@@ -775,6 +837,14 @@ private:
     ZoneDynamicInfoMap _zoneDynamicInfo;
     uint32 _defaultLight;
 
+    std::deque<Position> _gridPreloadQueue;
+    std::unordered_set<uint32 /*gridId*/> _gridPreloadQueued;
+
+    // Results are only valid within one map update, see Map::Update
+    mutable LineOfSightCache _lineOfSightCache;
+    mutable uint32 _lineOfSightCacheHits;
+    mutable uint32 _lineOfSightCacheMisses;
+
     template<HighGuid high>
     inline ObjectGuidGeneratorBase& GetGuidSequenceGenerator()
     {
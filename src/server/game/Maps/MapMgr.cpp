@@ -61,6 +61,11 @@ void MapMgr::Initialize()
     // Start mtmaps if needed
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    // Background terrain preparation for grids about to be loaded
+    int32 gridLoaderThreads = CONF_GET_INT("GridLoader.Threads");
+    if (gridLoaderThreads > 0)
+        m_gridTerrainLoader.Activate(gridLoaderThreads, CONF_GET_UINT("GridLoader.MaxPreparedGrids"));
 }
 
 void MapMgr::InitializeVisibilityDistanceInfo()
@@ -335,6 +340,8 @@ void MapMgr::UnloadAll()
 
     if (m_updater.activated())
         m_updater.deactivate();
+
+    m_gridTerrainLoader.Deactivate();
 }
 
 void MapMgr::GetNumInstances(uint32& dungeons, uint32& battlegrounds, uint32& arenas)
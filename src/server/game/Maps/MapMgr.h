@@ -20,6 +20,7 @@
 
 #include "Common.h"
 #include "Define.h"
+#include "GridTerrainLoader.h"
 #include "Map.h"
 #include "MapInstanced.h"
 #include "MapUpdater.h"
@@ -143,6 +144,7 @@ public:
     uint32 GenerateInstanceId();
 
     MapUpdater* GetMapUpdater() { return &m_updater; }
+    GridTerrainLoader* GetGridTerrainLoader() { return &m_gridTerrainLoader; }
 
     template<typename Worker>
     void DoForAllMaps(Worker&& worker);
@@ -173,6 +175,7 @@ private:
     InstanceIds _instanceIds;
     uint32 _nextInstanceId;
     MapUpdater m_updater;
+    GridTerrainLoader m_gridTerrainLoader;
 
     // atomic op counter for active scripts amount
     std::atomic<uint32> _scheduledScripts;
@@ -308,6 +308,9 @@ void FlightPathMovementGenerator::DoInitialize(Player* player)
 {
     Reset(player);
     InitEndGridInfo();
+
+    _preloadedAheadNode = GetCurrentNode();
+    PreloadGridsAhead(player);
 }
 
 void FlightPathMovementGenerator::DoFinalize(Player* player)
@@ -406,6 +409,8 @@ bool FlightPathMovementGenerator::DoUpdate(Player* player, uint32 /*diff*/)
             i_currentNode += (uint32)departureEvent;
             departureEvent = !departureEvent;
 
+            PreloadGridsAhead(player);
+
             // xinef: map should be switched, do not rely on client packets QQ
             if (i_currentNode + 1 < i_path.size() && i_path[i_currentNode + 1]->mapid != player->GetMapId())
             {
@@ -479,6 +484,20 @@ void FlightPathMovementGenerator::InitEndGridInfo()
     _endGridY = i_path[nodeCount - 1]->y;
 }
 
+void FlightPathMovementGenerator::PreloadGridsAhead(Player* player)
+{
+    // the whole path is known, request grids a few nodes ahead so the map loads them with its preload budget
+    uint32 lookahead = CONF_GET_UINT("GridLoader.Preload.TaxiNodes");
+    if (!lookahead)
+        return;
+
+    uint32 end = std::min<uint32>(GetPathAtMapEnd(), i_currentNode + lookahead);
+    for (uint32 i = std::max<uint32>(_preloadedAheadNode, i_currentNode); i < end; ++i)
+        player->GetMap()->PreloadGrid(i_path[i]->x, i_path[i]->y);
+
+    _preloadedAheadNode = std::max<uint32>(_preloadedAheadNode, end);
+}
+
 void FlightPathMovementGenerator::PreloadEndGrid()
 {
     // used to preload the final grid where the flightmaster is
@@ -109,6 +109,7 @@ public:
         _endGridY = 0.0f;
         _endMapId = 0;
         _preloadTargetNode = 0;
+        _preloadedAheadNode = 0;
         _mapSwitch = false;
     }
     void LoadPath(Player* player);
@@ -127,12 +128,14 @@ public:
 
     void InitEndGridInfo();
     void PreloadEndGrid();
+    void PreloadGridsAhead(Player* player);
 
 private:
     float _endGridX;                //! X coord of last node location
     float _endGridY;                //! Y coord of last node location
     uint32 _endMapId;               //! map Id of last node location
     uint32 _preloadTargetNode;      //! node index where preloading starts
+    uint32 _preloadedAheadNode;     //! first node index whose grid was not requested yet
     bool _mapSwitch;
 
     std::deque<uint32> _pointsForPathSwitch;    //! node indexes and costs where TaxiPath changes
@@ -22,7 +22,7 @@ void ScriptMgr::OnCreatureAddWorld(Creature* creature)
 {
     ASSERT(creature);
 
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
+    ExecuteScript<AllCreatureScript>(ALLCREATUREHOOK_ON_CREATURE_ADD_WORLD, [&](AllCreatureScript* script)
     {
         script->OnCreatureAddWorld(creature);
     });
@@ -32,7 +32,7 @@ void ScriptMgr::OnCreatureRemoveWorld(Creature* creature)
 {
     ASSERT(creature);
 
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
+    ExecuteScript<AllCreatureScript>(ALLCREATUREHOOK_ON_CREATURE_REMOVE_WORLD, [&](AllCreatureScript* script)
     {
         script->OnCreatureRemoveWorld(creature);
     });
@@ -40,7 +40,7 @@ void ScriptMgr::OnCreatureRemoveWorld(Creature* creature)
 
 void ScriptMgr::Creature_SelectLevel(const CreatureTemplate* cinfo, Creature* creature)
 {
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
+    ExecuteScript<AllCreatureScript>(ALLCREATUREHOOK_CREATURE_SELECT_LEVEL, [&](AllCreatureScript* script)
     {
         script->Creature_SelectLevel(cinfo, creature);
     });
@@ -48,7 +48,7 @@ void ScriptMgr::Creature_SelectLevel(const CreatureTemplate* cinfo, Creature* cr
 
 bool ScriptMgr::CanCreatureSendListInventory(Player* player, Creature* creature, uint32 vendorEntry)
 {
-    auto ret = IsValidBoolScript<AllCreatureScript>([&](AllCreatureScript* script)
+    auto ret = IsValidBoolScript<AllCreatureScript>(ALLCREATUREHOOK_CAN_CREATURE_SEND_LIST_INVENTORY, [&](AllCreatureScript* script)
     {
         return !script->CanCreatureSendListInventory(player, creature, vendorEntry);
     });
@@ -22,7 +22,7 @@ void ScriptMgr::OnGameObjectAddWorld(GameObject* go)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    ExecuteScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_ADD_WORLD, [&](AllGameObjectScript* script)
     {
         script->OnGameObjectAddWorld(go);
     });
@@ -32,7 +32,7 @@ void ScriptMgr::OnGameObjectRemoveWorld(GameObject* go)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    ExecuteScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_REMOVE_WORLD, [&](AllGameObjectScript* script)
     {
         script->OnGameObjectRemoveWorld(go);
     });
@@ -145,7 +145,7 @@ void ScriptMgr::OnCreateMap(Map* map)
 {
     ASSERT(map);
 
-    ExecuteScript<AllMapScript>([&](AllMapScript* script)
+    ExecuteScript<AllMapScript>(ALLMAPHOOK_ON_CREATE_MAP, [&](AllMapScript* script)
     {
         script->OnCreateMap(map);
     });
@@ -173,7 +173,7 @@ void ScriptMgr::OnDestroyMap(Map* map)
 {
     ASSERT(map);
 
-    ExecuteScript<AllMapScript>([&](AllMapScript* script)
+    ExecuteScript<AllMapScript>(ALLMAPHOOK_ON_DESTROY_MAP, [&](AllMapScript* script)
     {
         script->OnDestroyMap(map);
     });
@@ -250,12 +250,12 @@ void ScriptMgr::OnPlayerEnterMap(Map* map, Player* player)
     ASSERT(map);
     ASSERT(player);
 
-    ExecuteScript<AllMapScript>([&](AllMapScript* script)
+    ExecuteScript<AllMapScript>(ALLMAPHOOK_ON_PLAYER_ENTER_ALL, [&](AllMapScript* script)
     {
         script->OnPlayerEnterAll(map, player);
     });
 
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_MAP_CHANGED, [&](PlayerScript* script)
     {
         script->OnMapChanged(player);
     });
@@ -284,7 +284,7 @@ void ScriptMgr::OnPlayerLeaveMap(Map* map, Player* player)
     ASSERT(map);
     ASSERT(player);
 
-    ExecuteScript<AllMapScript>([&](AllMapScript* script)
+    ExecuteScript<AllMapScript>(ALLMAPHOOK_ON_PLAYER_LEAVE_ALL, [&](AllMapScript* script)
     {
         script->OnPlayerLeaveAll(map, player);
     });
@@ -312,7 +312,7 @@ void ScriptMgr::OnMapUpdate(Map* map, uint32 diff)
 {
     ASSERT(map);
 
-    ExecuteScript<AllMapScript>([&](AllMapScript* script)
+    ExecuteScript<AllMapScript>(ALLMAPHOOK_ON_MAP_UPDATE, [&](AllMapScript* script)
     {
         script->OnMapUpdate(map, diff);
     });
@@ -338,7 +338,7 @@ void ScriptMgr::OnMapUpdate(Map* map, uint32 diff)
 
 void ScriptMgr::OnBeforeCreateInstanceScript(InstanceMap* instanceMap, InstanceScript* instanceData, bool load, std::string data, uint32 completedEncounterMask)
 {
-    ExecuteScript<AllMapScript>([&](AllMapScript* script)
+    ExecuteScript<AllMapScript>(ALLMAPHOOK_ON_BEFORE_CREATE_INSTANCE_SCRIPT, [&](AllMapScript* script)
     {
         script->OnBeforeCreateInstanceScript(instanceMap, instanceData, load, data, completedEncounterMask);
     });
@@ -346,7 +346,7 @@ void ScriptMgr::OnBeforeCreateInstanceScript(InstanceMap* instanceMap, InstanceS
 
 void ScriptMgr::OnDestroyInstance(MapInstanced* mapInstanced, Map* map)
 {
-    ExecuteScript<AllMapScript>([&](AllMapScript* script)
+    ExecuteScript<AllMapScript>(ALLMAPHOOK_ON_DESTROY_INSTANCE, [&](AllMapScript* script)
     {
         script->OnDestroyInstance(mapInstanced, map);
     });
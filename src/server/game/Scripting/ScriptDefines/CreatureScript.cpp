@@ -24,7 +24,7 @@ bool ScriptMgr::OnGossipHello(Player* player, Creature* creature)
     ASSERT(player);
     ASSERT(creature);
 
-    auto ret = IsValidBoolScript<AllCreatureScript>([&](AllCreatureScript* script)
+    auto ret = IsValidBoolScript<AllCreatureScript>(ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_HELLO, [&](AllCreatureScript* script)
     {
         return script->CanCreatureGossipHello(player, creature);
     });
@@ -44,7 +44,7 @@ bool ScriptMgr::OnGossipSelect(Player* player, Creature* creature, uint32 sender
     ASSERT(player);
     ASSERT(creature);
 
-    auto ret = IsValidBoolScript<AllCreatureScript>([&](AllCreatureScript* script)
+    auto ret = IsValidBoolScript<AllCreatureScript>(ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_SELECT, [&](AllCreatureScript* script)
     {
         return script->CanCreatureGossipSelect(player, creature, sender, action);
     });
@@ -64,7 +64,7 @@ bool ScriptMgr::OnGossipSelectCode(Player* player, Creature* creature, uint32 se
     ASSERT(creature);
     ASSERT(code);
 
-    auto ret = IsValidBoolScript<AllCreatureScript>([&](AllCreatureScript* script)
+    auto ret = IsValidBoolScript<AllCreatureScript>(ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_SELECT_CODE, [&](AllCreatureScript* script)
     {
         return script->CanCreatureGossipSelectCode(player, creature, sender, action, code);
     });
@@ -84,7 +84,7 @@ bool ScriptMgr::OnQuestAccept(Player* player, Creature* creature, Quest const* q
     ASSERT(creature);
     ASSERT(quest);
 
-    auto ret = IsValidBoolScript<AllCreatureScript>([&](AllCreatureScript* script)
+    auto ret = IsValidBoolScript<AllCreatureScript>(ALLCREATUREHOOK_CAN_CREATURE_QUEST_ACCEPT, [&](AllCreatureScript* script)
     {
         return script->CanCreatureQuestAccept(player, creature, quest);
     });
@@ -127,7 +127,7 @@ bool ScriptMgr::OnQuestReward(Player* player, Creature* creature, Quest const* q
     ASSERT(creature);
     ASSERT(quest);
 
-    auto ret = IsValidBoolScript<AllCreatureScript>([&](AllCreatureScript* script)
+    auto ret = IsValidBoolScript<AllCreatureScript>(ALLCREATUREHOOK_CAN_CREATURE_QUEST_REWARD, [&](AllCreatureScript* script)
     {
         return script->CanCreatureQuestReward(player, creature, quest, opt);
     });
@@ -156,7 +156,7 @@ CreatureAI* ScriptMgr::GetCreatureAI(Creature* creature)
 {
     ASSERT(creature);
 
-    auto retAI = GetReturnAIScript<AllCreatureScript, CreatureAI>([creature](AllCreatureScript* script)
+    auto retAI = GetReturnAIScript<AllCreatureScript, CreatureAI>(ALLCREATUREHOOK_GET_CREATURE_AI, [creature](AllCreatureScript* script)
     {
         return script->GetCreatureAI(creature);
     });
@@ -174,7 +174,7 @@ void ScriptMgr::OnCreatureUpdate(Creature* creature, uint32 diff)
 {
     ASSERT(creature);
 
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
+    ExecuteScript<AllCreatureScript>(ALLCREATUREHOOK_ON_ALL_CREATURE_UPDATE, [&](AllCreatureScript* script)
     {
         script->OnAllCreatureUpdate(creature, diff);
     });
@@ -24,7 +24,7 @@ bool ScriptMgr::OnGossipHello(Player* player, GameObject* go)
     ASSERT(player);
     ASSERT(go);
 
-    auto ret = IsValidBoolScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    auto ret = IsValidBoolScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_GOSSIP_HELLO, [&](AllGameObjectScript* script)
     {
         return script->CanGameObjectGossipHello(player, go);
     });
@@ -44,7 +44,7 @@ bool ScriptMgr::OnGossipSelect(Player* player, GameObject* go, uint32 sender, ui
     ASSERT(player);
     ASSERT(go);
 
-    auto ret = IsValidBoolScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    auto ret = IsValidBoolScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_GOSSIP_SELECT, [&](AllGameObjectScript* script)
     {
         return script->CanGameObjectGossipSelect(player, go, sender, action);
     });
@@ -64,7 +64,7 @@ bool ScriptMgr::OnGossipSelectCode(Player* player, GameObject* go, uint32 sender
     ASSERT(go);
     ASSERT(code);
 
-    auto ret = IsValidBoolScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    auto ret = IsValidBoolScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_GOSSIP_SELECT_CODE, [&](AllGameObjectScript* script)
     {
         return script->CanGameObjectGossipSelectCode(player, go, sender, action, code);
     });
@@ -84,7 +84,7 @@ bool ScriptMgr::OnQuestAccept(Player* player, GameObject* go, Quest const* quest
     ASSERT(go);
     ASSERT(quest);
 
-    auto ret = IsValidBoolScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    auto ret = IsValidBoolScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_QUEST_ACCEPT, [&](AllGameObjectScript* script)
     {
         return script->CanGameObjectQuestAccept(player, go, quest);
     });
@@ -105,7 +105,7 @@ bool ScriptMgr::OnQuestReward(Player* player, GameObject* go, Quest const* quest
     ASSERT(go);
     ASSERT(quest);
 
-    auto ret = IsValidBoolScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    auto ret = IsValidBoolScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_QUEST_REWARD, [&](AllGameObjectScript* script)
     {
         return script->CanGameObjectQuestReward(player, go, quest, opt);
     });
@@ -134,7 +134,7 @@ void ScriptMgr::OnGameObjectDestroyed(GameObject* go, Player* player)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    ExecuteScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_DESTROYED, [&](AllGameObjectScript* script)
     {
         script->OnGameObjectDestroyed(go, player);
     });
@@ -149,7 +149,7 @@ void ScriptMgr::OnGameObjectDamaged(GameObject* go, Player* player)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    ExecuteScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_DAMAGED, [&](AllGameObjectScript* script)
     {
         script->OnGameObjectDamaged(go, player);
     });
@@ -164,7 +164,7 @@ void ScriptMgr::OnGameObjectLootStateChanged(GameObject* go, uint32 state, Unit*
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    ExecuteScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_LOOT_STATE_CHANGED, [&](AllGameObjectScript* script)
     {
         script->OnGameObjectLootStateChanged(go, state, unit);
     });
@@ -179,7 +179,7 @@ void ScriptMgr::OnGameObjectStateChanged(GameObject* go, uint32 state)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    ExecuteScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_STATE_CHANGED, [&](AllGameObjectScript* script)
     {
         script->OnGameObjectStateChanged(go, state);
     });
@@ -194,7 +194,7 @@ void ScriptMgr::OnGameObjectUpdate(GameObject* go, uint32 diff)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    ExecuteScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_UPDATE, [&](AllGameObjectScript* script)
     {
         script->OnGameObjectUpdate(go, diff);
     });
@@ -209,7 +209,7 @@ GameObjectAI* ScriptMgr::GetGameObjectAI(GameObject* go)
 {
     ASSERT(go);
 
-    auto retAI = GetReturnAIScript<AllGameObjectScript, GameObjectAI>([go](AllGameObjectScript* script)
+    auto retAI = GetReturnAIScript<AllGameObjectScript, GameObjectAI>(ALLGAMEOBJECTHOOK_GET_GAME_OBJECT_AI, [go](AllGameObjectScript* script)
     {
         return script->GetGameObjectAI(go);
     });
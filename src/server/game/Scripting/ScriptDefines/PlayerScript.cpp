@@ -20,7 +20,7 @@
 
 void ScriptMgr::OnBeforePlayerDurabilityRepair(Player* player, ObjectGuid npcGUID, ObjectGuid itemGUID, float& discountMod, uint8 guildBank)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_DURABILITY_REPAIR, [&](PlayerScript* script)
     {
         script->OnBeforeDurabilityRepair(player, npcGUID, itemGUID, discountMod, guildBank);
     });
@@ -28,7 +28,7 @@ void ScriptMgr::OnBeforePlayerDurabilityRepair(Player* player, ObjectGuid npcGUI
 
 void ScriptMgr::OnGossipSelect(Player* player, uint32 menu_id, uint32 sender, uint32 action)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_GOSSIP_SELECT, [&](PlayerScript* script)
     {
         script->OnGossipSelect(player, menu_id, sender, action);
     });
@@ -36,7 +36,7 @@ void ScriptMgr::OnGossipSelect(Player* player, uint32 menu_id, uint32 sender, ui
 
 void ScriptMgr::OnGossipSelectCode(Player* player, uint32 menu_id, uint32 sender, uint32 action, const char* code)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_GOSSIP_SELECT_CODE, [&](PlayerScript* script)
     {
         script->OnGossipSelectCode(player, menu_id, sender, action, code);
     });
@@ -44,7 +44,7 @@ void ScriptMgr::OnGossipSelectCode(Player* player, uint32 menu_id, uint32 sender
 
 void ScriptMgr::OnPlayerCompleteQuest(Player* player, Quest const* quest)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_PLAYER_COMPLETE_QUEST, [&](PlayerScript* script)
     {
         script->OnPlayerCompleteQuest(player, quest);
     });
@@ -52,7 +52,7 @@ void ScriptMgr::OnPlayerCompleteQuest(Player* player, Quest const* quest)
 
 void ScriptMgr::OnSendInitialPacketsBeforeAddToMap(Player* player, WorldPacket& data)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_SEND_INITIAL_PACKETS_BEFORE_ADD_TO_MAP, [&](PlayerScript* script)
     {
         script->OnSendInitialPacketsBeforeAddToMap(player, data);
     });
@@ -60,7 +60,7 @@ void ScriptMgr::OnSendInitialPacketsBeforeAddToMap(Player* player, WorldPacket&
 
 void ScriptMgr::OnBattlegroundDesertion(Player* player, BattlegroundDesertionType const desertionType)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BATTLEGROUND_DESERTION, [&](PlayerScript* script)
     {
         script->OnBattlegroundDesertion(player, desertionType);
     });
@@ -68,7 +68,7 @@ void ScriptMgr::OnBattlegroundDesertion(Player* player, BattlegroundDesertionTyp
 
 void ScriptMgr::OnPlayerReleasedGhost(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_PLAYER_RELEASED_GHOST, [&](PlayerScript* script)
     {
         script->OnPlayerReleasedGhost(player);
     });
@@ -76,7 +76,7 @@ void ScriptMgr::OnPlayerReleasedGhost(Player* player)
 
 void ScriptMgr::OnPVPKill(Player* killer, Player* killed)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_PVP_KILL, [&](PlayerScript* script)
     {
         script->OnPVPKill(killer, killed);
     });
@@ -84,7 +84,7 @@ void ScriptMgr::OnPVPKill(Player* killer, Player* killed)
 
 void ScriptMgr::OnPlayerPVPFlagChange(Player* player, bool state)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_PLAYER_PVP_FLAG_CHANGE, [&](PlayerScript* script)
     {
         script->OnPlayerPVPFlagChange(player, state);
     });
@@ -92,7 +92,7 @@ void ScriptMgr::OnPlayerPVPFlagChange(Player* player, bool state)
 
 void ScriptMgr::OnCreatureKill(Player* killer, Creature* killed)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CREATURE_KILL, [&](PlayerScript* script)
     {
         script->OnCreatureKill(killer, killed);
     });
@@ -100,7 +100,7 @@ void ScriptMgr::OnCreatureKill(Player* killer, Creature* killed)
 
 void ScriptMgr::OnCreatureKilledByPet(Player* petOwner, Creature* killed)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CREATURE_KILLED_BY_PET, [&](PlayerScript* script)
     {
         script->OnCreatureKilledByPet(petOwner, killed);
     });
@@ -108,7 +108,7 @@ void ScriptMgr::OnCreatureKilledByPet(Player* petOwner, Creature* killed)
 
 void ScriptMgr::OnPlayerKilledByCreature(Creature* killer, Player* killed)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_PLAYER_KILLED_BY_CREATURE, [&](PlayerScript* script)
     {
         script->OnPlayerKilledByCreature(killer, killed);
     });
@@ -116,7 +116,7 @@ void ScriptMgr::OnPlayerKilledByCreature(Creature* killer, Player* killed)
 
 void ScriptMgr::OnPlayerLevelChanged(Player* player, uint8 oldLevel)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_LEVEL_CHANGED, [&](PlayerScript* script)
     {
         script->OnLevelChanged(player, oldLevel);
     });
@@ -124,7 +124,7 @@ void ScriptMgr::OnPlayerLevelChanged(Player* player, uint8 oldLevel)
 
 void ScriptMgr::OnPlayerFreeTalentPointsChanged(Player* player, uint32 points)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_FREE_TALENT_POINTS_CHANGED, [&](PlayerScript* script)
     {
         script->OnFreeTalentPointsChanged(player, points);
     });
@@ -132,7 +132,7 @@ void ScriptMgr::OnPlayerFreeTalentPointsChanged(Player* player, uint32 points)
 
 void ScriptMgr::OnPlayerTalentsReset(Player* player, bool noCost)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_TALENTS_RESET, [&](PlayerScript* script)
     {
         script->OnTalentsReset(player, noCost);
     });
@@ -140,7 +140,7 @@ void ScriptMgr::OnPlayerTalentsReset(Player* player, bool noCost)
 
 void ScriptMgr::OnPlayerMoneyChanged(Player* player, int32& amount)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_MONEY_CHANGED, [&](PlayerScript* script)
     {
         script->OnMoneyChanged(player, amount);
     });
@@ -148,7 +148,7 @@ void ScriptMgr::OnPlayerMoneyChanged(Player* player, int32& amount)
 
 void ScriptMgr::OnGivePlayerXP(Player* player, uint32& amount, Unit* victim)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_GIVE_XP, [&](PlayerScript* script)
     {
         script->OnGiveXP(player, amount, victim);
     });
@@ -156,7 +156,7 @@ void ScriptMgr::OnGivePlayerXP(Player* player, uint32& amount, Unit* victim)
 
 bool ScriptMgr::OnPlayerReputationChange(Player* player, uint32 factionID, int32& standing, bool incremental)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_ON_REPUTATION_CHANGE, [&](PlayerScript* script)
         {
             return !script->OnReputationChange(player, factionID, standing, incremental);
         });
@@ -171,7 +171,7 @@ bool ScriptMgr::OnPlayerReputationChange(Player* player, uint32 factionID, int32
 
 void ScriptMgr::OnPlayerReputationRankChange(Player* player, uint32 factionID, ReputationRank newRank, ReputationRank oldRank, bool increased)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_REPUTATION_RANK_CHANGE, [&](PlayerScript* script)
     {
         script->OnReputationRankChange(player, factionID, newRank, oldRank, increased);
     });
@@ -179,7 +179,7 @@ void ScriptMgr::OnPlayerReputationRankChange(Player* player, uint32 factionID, R
 
 void ScriptMgr::OnPlayerLearnSpell(Player* player, uint32 spellID)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_LEARN_SPELL, [&](PlayerScript* script)
     {
         script->OnLearnSpell(player, spellID);
     });
@@ -187,7 +187,7 @@ void ScriptMgr::OnPlayerLearnSpell(Player* player, uint32 spellID)
 
 void ScriptMgr::OnPlayerForgotSpell(Player* player, uint32 spellID)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_FORGOT_SPELL, [&](PlayerScript* script)
     {
         script->OnForgotSpell(player, spellID);
     });
@@ -195,7 +195,7 @@ void ScriptMgr::OnPlayerForgotSpell(Player* player, uint32 spellID)
 
 void ScriptMgr::OnPlayerDuelRequest(Player* target, Player* challenger)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_DUEL_REQUEST, [&](PlayerScript* script)
     {
         script->OnDuelRequest(target, challenger);
     });
@@ -203,7 +203,7 @@ void ScriptMgr::OnPlayerDuelRequest(Player* target, Player* challenger)
 
 void ScriptMgr::OnPlayerDuelStart(Player* player1, Player* player2)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_DUEL_START, [&](PlayerScript* script)
     {
         script->OnDuelStart(player1, player2);
     });
@@ -211,7 +211,7 @@ void ScriptMgr::OnPlayerDuelStart(Player* player1, Player* player2)
 
 void ScriptMgr::OnPlayerDuelEnd(Player* winner, Player* loser, DuelCompleteType type)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_DUEL_END, [&](PlayerScript* script)
     {
         script->OnDuelEnd(winner, loser, type);
     });
@@ -219,7 +219,7 @@ void ScriptMgr::OnPlayerDuelEnd(Player* winner, Player* loser, DuelCompleteType
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CHAT, [&](PlayerScript* script)
     {
         script->OnChat(player, type, lang, msg);
     });
@@ -227,7 +227,7 @@ void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::stri
 
 void ScriptMgr::OnBeforeSendChatMessage(Player* player, uint32& type, uint32& lang, std::string& msg)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_SEND_CHAT_MESSAGE, [&](PlayerScript* script)
     {
         script->OnBeforeSendChatMessage(player, type, lang, msg);
     });
@@ -235,7 +235,7 @@ void ScriptMgr::OnBeforeSendChatMessage(Player* player, uint32& type, uint32& la
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Player* receiver)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CHAT, [&](PlayerScript* script)
     {
         script->OnChat(player, type, lang, msg, receiver);
     });
@@ -243,7 +243,7 @@ void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::stri
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Group* group)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CHAT, [&](PlayerScript* script)
     {
         script->OnChat(player, type, lang, msg, group);
     });
@@ -251,7 +251,7 @@ void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::stri
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Guild* guild)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CHAT, [&](PlayerScript* script)
     {
         script->OnChat(player, type, lang, msg, guild);
     });
@@ -259,7 +259,7 @@ void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::stri
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Channel* channel)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CHAT, [&](PlayerScript* script)
     {
         script->OnChat(player, type, lang, msg, channel);
     });
@@ -267,7 +267,7 @@ void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::stri
 
 void ScriptMgr::OnPlayerEmote(Player* player, uint32 emote)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_EMOTE, [&](PlayerScript* script)
     {
         script->OnEmote(player, emote);
     });
@@ -275,7 +275,7 @@ void ScriptMgr::OnPlayerEmote(Player* player, uint32 emote)
 
 void ScriptMgr::OnPlayerTextEmote(Player* player, uint32 textEmote, uint32 emoteNum, ObjectGuid guid)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_TEXT_EMOTE, [&](PlayerScript* script)
     {
         script->OnTextEmote(player, textEmote, emoteNum, guid);
     });
@@ -283,7 +283,7 @@ void ScriptMgr::OnPlayerTextEmote(Player* player, uint32 textEmote, uint32 emote
 
 void ScriptMgr::OnPlayerSpellCast(Player* player, Spell* spell, bool skipCheck)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_SPELL_CAST, [&](PlayerScript* script)
     {
         script->OnSpellCast(player, spell, skipCheck);
     });
@@ -291,7 +291,7 @@ void ScriptMgr::OnPlayerSpellCast(Player* player, Spell* spell, bool skipCheck)
 
 void ScriptMgr::OnBeforePlayerUpdate(Player* player, uint32 p_time)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_UPDATE, [&](PlayerScript* script)
     {
         script->OnBeforeUpdate(player, p_time);
     });
@@ -299,7 +299,7 @@ void ScriptMgr::OnBeforePlayerUpdate(Player* player, uint32 p_time)
 
 void ScriptMgr::OnPlayerUpdate(Player* player, uint32 p_time)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_UPDATE, [&](PlayerScript* script)
     {
         script->OnUpdate(player, p_time);
     });
@@ -307,7 +307,7 @@ void ScriptMgr::OnPlayerUpdate(Player* player, uint32 p_time)
 
 void ScriptMgr::OnPlayerLogin(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_LOGIN, [&](PlayerScript* script)
     {
         script->OnLogin(player);
     });
@@ -315,7 +315,7 @@ void ScriptMgr::OnPlayerLogin(Player* player)
 
 void ScriptMgr::OnPlayerLoadFromDB(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_LOAD_FROM_DB, [&](PlayerScript* script)
     {
         script->OnLoadFromDB(player);
     });
@@ -323,7 +323,7 @@ void ScriptMgr::OnPlayerLoadFromDB(Player* player)
 
 void ScriptMgr::OnPlayerLogout(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_LOGOUT, [&](PlayerScript* script)
     {
         script->OnLogout(player);
     });
@@ -331,7 +331,7 @@ void ScriptMgr::OnPlayerLogout(Player* player)
 
 void ScriptMgr::OnPlayerCreate(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CREATE, [&](PlayerScript* script)
     {
         script->OnCreate(player);
     });
@@ -339,7 +339,7 @@ void ScriptMgr::OnPlayerCreate(Player* player)
 
 void ScriptMgr::OnPlayerSave(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_SAVE, [&](PlayerScript* script)
     {
         script->OnSave(player);
     });
@@ -347,7 +347,7 @@ void ScriptMgr::OnPlayerSave(Player* player)
 
 void ScriptMgr::OnPlayerDelete(ObjectGuid guid, uint32 accountId)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_DELETE, [&](PlayerScript* script)
     {
         script->OnDelete(guid, accountId);
     });
@@ -355,7 +355,7 @@ void ScriptMgr::OnPlayerDelete(ObjectGuid guid, uint32 accountId)
 
 void ScriptMgr::OnPlayerFailedDelete(ObjectGuid guid, uint32 accountId)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_FAILED_DELETE, [&](PlayerScript* script)
     {
         script->OnFailedDelete(guid, accountId);
     });
@@ -363,7 +363,7 @@ void ScriptMgr::OnPlayerFailedDelete(ObjectGuid guid, uint32 accountId)
 
 void ScriptMgr::OnPlayerBindToInstance(Player* player, Difficulty difficulty, uint32 mapid, bool permanent)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BIND_TO_INSTANCE, [&](PlayerScript* script)
     {
         script->OnBindToInstance(player, difficulty, mapid, permanent);
     });
@@ -371,7 +371,7 @@ void ScriptMgr::OnPlayerBindToInstance(Player* player, Difficulty difficulty, ui
 
 void ScriptMgr::OnPlayerUpdateZone(Player* player, uint32 newZone, uint32 newArea)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_UPDATE_ZONE, [&](PlayerScript* script)
     {
         script->OnUpdateZone(player, newZone, newArea);
     });
@@ -379,7 +379,7 @@ void ScriptMgr::OnPlayerUpdateZone(Player* player, uint32 newZone, uint32 newAre
 
 void ScriptMgr::OnPlayerUpdateArea(Player* player, uint32 oldArea, uint32 newArea)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_UPDATE_AREA, [&](PlayerScript* script)
     {
         script->OnUpdateArea(player, oldArea, newArea);
     });
@@ -387,7 +387,7 @@ void ScriptMgr::OnPlayerUpdateArea(Player* player, uint32 oldArea, uint32 newAre
 
 bool ScriptMgr::OnBeforePlayerTeleport(Player* player, uint32 mapid, float x, float y, float z, float orientation, uint32 options, Unit* target)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_TELEPORT, [&](PlayerScript* script)
     {
         return !script->OnBeforeTeleport(player, mapid, x, y, z, orientation, options, target);
     });
@@ -402,7 +402,7 @@ bool ScriptMgr::OnBeforePlayerTeleport(Player* player, uint32 mapid, float x, fl
 
 void ScriptMgr::OnPlayerUpdateFaction(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_UPDATE_FACTION, [&](PlayerScript* script)
     {
         script->OnUpdateFaction(player);
     });
@@ -410,7 +410,7 @@ void ScriptMgr::OnPlayerUpdateFaction(Player* player)
 
 void ScriptMgr::OnPlayerAddToBattleground(Player* player, Battleground* bg)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_ADD_TO_BATTLEGROUND, [&](PlayerScript* script)
     {
         script->OnAddToBattleground(player, bg);
     });
@@ -418,7 +418,7 @@ void ScriptMgr::OnPlayerAddToBattleground(Player* player, Battleground* bg)
 
 void ScriptMgr::OnPlayerQueueRandomDungeon(Player* player, uint32 & rDungeonId)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_QUEUE_RANDOM_DUNGEON, [&](PlayerScript* script)
     {
         script->OnQueueRandomDungeon(player, rDungeonId);
     });
@@ -426,7 +426,7 @@ void ScriptMgr::OnPlayerQueueRandomDungeon(Player* player, uint32 & rDungeonId)
 
 void ScriptMgr::OnPlayerRemoveFromBattleground(Player* player, Battleground* bg)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_REMOVE_FROM_BATTLEGROUND, [&](PlayerScript* script)
     {
         script->OnRemoveFromBattleground(player, bg);
     });
@@ -434,7 +434,7 @@ void ScriptMgr::OnPlayerRemoveFromBattleground(Player* player, Battleground* bg)
 
 bool ScriptMgr::OnBeforeAchievementComplete(Player* player, AchievementEntry const* achievement)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_ACHI_COMPLETE, [&](PlayerScript* script)
     {
         return !script->OnBeforeAchiComplete(player, achievement);
     });
@@ -449,7 +449,7 @@ bool ScriptMgr::OnBeforeAchievementComplete(Player* player, AchievementEntry con
 
 void ScriptMgr::OnAchievementComplete(Player* player, AchievementEntry const* achievement)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_ACHI_COMPLETE, [&](PlayerScript* script)
     {
         script->OnAchiComplete(player, achievement);
     });
@@ -457,7 +457,7 @@ void ScriptMgr::OnAchievementComplete(Player* player, AchievementEntry const* ac
 
 bool ScriptMgr::OnBeforeCriteriaProgress(Player* player, AchievementCriteriaEntry const* criteria)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_CRITERIA_PROGRESS, [&](PlayerScript* script)
     {
         return !script->OnBeforeCriteriaProgress(player, criteria);
     });
@@ -472,7 +472,7 @@ bool ScriptMgr::OnBeforeCriteriaProgress(Player* player, AchievementCriteriaEntr
 
 void ScriptMgr::OnCriteriaProgress(Player* player, AchievementCriteriaEntry const* criteria)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CRITERIA_PROGRESS, [&](PlayerScript* script)
     {
         script->OnCriteriaProgress(player, criteria);
     });
@@ -480,7 +480,7 @@ void ScriptMgr::OnCriteriaProgress(Player* player, AchievementCriteriaEntry cons
 
 void ScriptMgr::OnAchievementSave(CharacterDatabaseTransaction trans, Player* player, uint16 achiId, CompletedAchievementData achiData)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_ACHI_SAVE, [&](PlayerScript* script)
     {
         script->OnAchiSave(trans, player, achiId, achiData);
     });
@@ -488,7 +488,7 @@ void ScriptMgr::OnAchievementSave(CharacterDatabaseTransaction trans, Player* pl
 
 void ScriptMgr::OnCriteriaSave(CharacterDatabaseTransaction trans, Player* player, uint16 critId, CriteriaProgress criteriaData)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CRITERIA_SAVE, [&](PlayerScript* script)
     {
         script->OnCriteriaSave(trans, player, critId, criteriaData);
     });
@@ -496,7 +496,7 @@ void ScriptMgr::OnCriteriaSave(CharacterDatabaseTransaction trans, Player* playe
 
 void ScriptMgr::OnPlayerBeingCharmed(Player* player, Unit* charmer, uint32 oldFactionId, uint32 newFactionId)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BEING_CHARMED, [&](PlayerScript* script)
     {
         script->OnBeingCharmed(player, charmer, oldFactionId, newFactionId);
     });
@@ -504,7 +504,7 @@ void ScriptMgr::OnPlayerBeingCharmed(Player* player, Unit* charmer, uint32 oldFa
 
 void ScriptMgr::OnAfterPlayerSetVisibleItemSlot(Player* player, uint8 slot, Item* item)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_AFTER_SET_VISIBLE_ITEM_SLOT, [&](PlayerScript* script)
     {
         script->OnAfterSetVisibleItemSlot(player, slot, item);
     });
@@ -512,7 +512,7 @@ void ScriptMgr::OnAfterPlayerSetVisibleItemSlot(Player* player, uint8 slot, Item
 
 void ScriptMgr::OnAfterPlayerMoveItemFromInventory(Player* player, Item* it, uint8 bag, uint8 slot, bool update)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_AFTER_MOVE_ITEM_FROM_INVENTORY, [&](PlayerScript* script)
     {
         script->OnAfterMoveItemFromInventory(player, it, bag, slot, update);
     });
@@ -520,7 +520,7 @@ void ScriptMgr::OnAfterPlayerMoveItemFromInventory(Player* player, Item* it, uin
 
 void ScriptMgr::OnEquip(Player* player, Item* it, uint8 bag, uint8 slot, bool update)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_EQUIP, [&](PlayerScript* script)
     {
         script->OnEquip(player, it, bag, slot, update);
     });
@@ -528,7 +528,7 @@ void ScriptMgr::OnEquip(Player* player, Item* it, uint8 bag, uint8 slot, bool up
 
 void ScriptMgr::OnPlayerJoinBG(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_PLAYER_JOIN_BG, [&](PlayerScript* script)
     {
         script->OnPlayerJoinBG(player);
     });
@@ -536,7 +536,7 @@ void ScriptMgr::OnPlayerJoinBG(Player* player)
 
 void ScriptMgr::OnPlayerJoinArena(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_PLAYER_JOIN_ARENA, [&](PlayerScript* script)
     {
         script->OnPlayerJoinArena(player);
     });
@@ -544,7 +544,7 @@ void ScriptMgr::OnPlayerJoinArena(Player* player)
 
 void ScriptMgr::GetCustomGetArenaTeamId(Player const* player, uint8 slot, uint32& teamID) const
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_GET_CUSTOM_GET_ARENA_TEAM_ID, [&](PlayerScript* script)
     {
         script->GetCustomGetArenaTeamId(player, slot, teamID);
     });
@@ -552,7 +552,7 @@ void ScriptMgr::GetCustomGetArenaTeamId(Player const* player, uint8 slot, uint32
 
 void ScriptMgr::GetCustomArenaPersonalRating(Player const* player, uint8 slot, uint32& rating) const
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_GET_CUSTOM_ARENA_PERSONAL_RATING, [&](PlayerScript* script)
     {
         script->GetCustomArenaPersonalRating(player, slot, rating);
     });
@@ -560,7 +560,7 @@ void ScriptMgr::GetCustomArenaPersonalRating(Player const* player, uint8 slot, u
 
 void ScriptMgr::OnGetMaxPersonalArenaRatingRequirement(Player const* player, uint32 minSlot, uint32& maxArenaRating) const
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_GET_MAX_PERSONAL_ARENA_RATING_REQUIREMENT, [&](PlayerScript* script)
     {
         script->OnGetMaxPersonalArenaRatingRequirement(player, minSlot, maxArenaRating);
     });
@@ -568,7 +568,7 @@ void ScriptMgr::OnGetMaxPersonalArenaRatingRequirement(Player const* player, uin
 
 void ScriptMgr::OnLootItem(Player* player, Item* item, uint32 count, ObjectGuid lootguid)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_LOOT_ITEM, [&](PlayerScript* script)
     {
         script->OnLootItem(player, item, count, lootguid);
     });
@@ -576,7 +576,7 @@ void ScriptMgr::OnLootItem(Player* player, Item* item, uint32 count, ObjectGuid
 
 void ScriptMgr::OnCreateItem(Player* player, Item* item, uint32 count)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CREATE_ITEM, [&](PlayerScript* script)
     {
         script->OnCreateItem(player, item, count);
     });
@@ -584,7 +584,7 @@ void ScriptMgr::OnCreateItem(Player* player, Item* item, uint32 count)
 
 void ScriptMgr::OnQuestRewardItem(Player* player, Item* item, uint32 count)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_QUEST_REWARD_ITEM, [&](PlayerScript* script)
     {
         script->OnQuestRewardItem(player, item, count);
     });
@@ -592,7 +592,7 @@ void ScriptMgr::OnQuestRewardItem(Player* player, Item* item, uint32 count)
 
 void ScriptMgr::OnFirstLogin(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_FIRST_LOGIN, [&](PlayerScript* script)
     {
         script->OnFirstLogin(player);
     });
@@ -600,7 +600,7 @@ void ScriptMgr::OnFirstLogin(Player* player)
 
 bool ScriptMgr::CanJoinInBattlegroundQueue(Player* player, ObjectGuid BattlemasterGuid, BattlegroundTypeId BGTypeID, uint8 joinAsGroup, GroupJoinBattlegroundResult& err)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_JOIN_IN_BATTLEGROUND_QUEUE, [&](PlayerScript* script)
     {
         return !script->CanJoinInBattlegroundQueue(player, BattlemasterGuid, BGTypeID, joinAsGroup, err);
     });
@@ -615,7 +615,7 @@ bool ScriptMgr::CanJoinInBattlegroundQueue(Player* player, ObjectGuid Battlemast
 
 bool ScriptMgr::ShouldBeRewardedWithMoneyInsteadOfExp(Player* player)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_SHOULD_BE_REWARDED_WITH_MONEY_INSTEAD_OF_EXP, [&](PlayerScript* script)
     {
         return script->ShouldBeRewardedWithMoneyInsteadOfExp(player);
     });
@@ -630,7 +630,7 @@ bool ScriptMgr::ShouldBeRewardedWithMoneyInsteadOfExp(Player* player)
 
 void ScriptMgr::OnBeforeTempSummonInitStats(Player* player, TempSummon* tempSummon, uint32& duration)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_TEMP_SUMMON_INIT_STATS, [&](PlayerScript* script)
     {
         script->OnBeforeTempSummonInitStats(player, tempSummon, duration);
     });
@@ -638,7 +638,7 @@ void ScriptMgr::OnBeforeTempSummonInitStats(Player* player, TempSummon* tempSumm
 
 void ScriptMgr::OnBeforeGuardianInitStatsForLevel(Player* player, Guardian* guardian, CreatureTemplate const* cinfo, PetType& petType)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_GUARDIAN_INIT_STATS_FOR_LEVEL, [&](PlayerScript* script)
     {
         script->OnBeforeGuardianInitStatsForLevel(player, guardian, cinfo, petType);
     });
@@ -646,7 +646,7 @@ void ScriptMgr::OnBeforeGuardianInitStatsForLevel(Player* player, Guardian* guar
 
 void ScriptMgr::OnAfterGuardianInitStatsForLevel(Player* player, Guardian* guardian)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_AFTER_GUARDIAN_INIT_STATS_FOR_LEVEL, [&](PlayerScript* script)
     {
         script->OnAfterGuardianInitStatsForLevel(player, guardian);
     });
@@ -654,7 +654,7 @@ void ScriptMgr::OnAfterGuardianInitStatsForLevel(Player* player, Guardian* guard
 
 void ScriptMgr::OnBeforeLoadPetFromDB(Player* player, uint32& petentry, uint32& petnumber, bool& current, bool& forceLoadFromDB)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_LOAD_PET_FROM_DB, [&](PlayerScript* script)
     {
         script->OnBeforeLoadPetFromDB(player, petentry, petnumber, current, forceLoadFromDB);
     });
@@ -662,7 +662,7 @@ void ScriptMgr::OnBeforeLoadPetFromDB(Player* player, uint32& petentry, uint32&
 
 void ScriptMgr::OnBeforeBuyItemFromVendor(Player* player, ObjectGuid vendorguid, uint32 vendorslot, uint32& item, uint8 count, uint8 bag, uint8 slot)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_BUY_ITEM_FROM_VENDOR, [&](PlayerScript* script)
     {
         script->OnBeforeBuyItemFromVendor(player, vendorguid, vendorslot, item, count, bag, slot);
     });
@@ -670,7 +670,7 @@ void ScriptMgr::OnBeforeBuyItemFromVendor(Player* player, ObjectGuid vendorguid,
 
 void ScriptMgr::OnAfterStoreOrEquipNewItem(Player* player, uint32 vendorslot, Item* item, uint8 count, uint8 bag, uint8 slot, ItemTemplate const* pProto, Creature* pVendor, VendorItem const* crItem, bool bStore)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_AFTER_STORE_OR_EQUIP_NEW_ITEM, [&](PlayerScript* script)
     {
         script->OnAfterStoreOrEquipNewItem(player, vendorslot, item, count, bag, slot, pProto, pVendor, crItem, bStore);
     });
@@ -678,7 +678,7 @@ void ScriptMgr::OnAfterStoreOrEquipNewItem(Player* player, uint32 vendorslot, It
 
 void ScriptMgr::OnAfterUpdateMaxPower(Player* player, Powers& power, float& value)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_AFTER_UPDATE_MAX_POWER, [&](PlayerScript* script)
     {
         script->OnAfterUpdateMaxPower(player, power, value);
     });
@@ -686,7 +686,7 @@ void ScriptMgr::OnAfterUpdateMaxPower(Player* player, Powers& power, float& valu
 
 void ScriptMgr::OnAfterUpdateMaxHealth(Player* player, float& value)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_AFTER_UPDATE_MAX_HEALTH, [&](PlayerScript* script)
     {
         script->OnAfterUpdateMaxHealth(player, value);
     });
@@ -694,7 +694,7 @@ void ScriptMgr::OnAfterUpdateMaxHealth(Player* player, float& value)
 
 void ScriptMgr::OnBeforeUpdateAttackPowerAndDamage(Player* player, float& level, float& val2, bool ranged)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_UPDATE_ATTACK_POWER_AND_DAMAGE, [&](PlayerScript* script)
     {
         script->OnBeforeUpdateAttackPowerAndDamage(player, level, val2, ranged);
     });
@@ -702,7 +702,7 @@ void ScriptMgr::OnBeforeUpdateAttackPowerAndDamage(Player* player, float& level,
 
 void ScriptMgr::OnAfterUpdateAttackPowerAndDamage(Player* player, float& level, float& base_attPower, float& attPowerMod, float& attPowerMultiplier, bool ranged)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_AFTER_UPDATE_ATTACK_POWER_AND_DAMAGE, [&](PlayerScript* script)
     {
         script->OnAfterUpdateAttackPowerAndDamage(player, level, base_attPower, attPowerMod, attPowerMultiplier, ranged);
     });
@@ -710,14 +710,14 @@ void ScriptMgr::OnAfterUpdateAttackPowerAndDamage(Player* player, float& level,
 
 void ScriptMgr::OnBeforeInitTalentForLevel(Player* player, uint8& level, uint32& talentPointsForLevel)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_INIT_TALENT_FOR_LEVEL, [&](PlayerScript* script)
     {
         script->OnBeforeInitTalentForLevel(player, level, talentPointsForLevel);
     });
 }
 bool ScriptMgr::OnBeforePlayerQuestComplete(Player* player, uint32 quest_id)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_QUEST_COMPLETE, [&](PlayerScript* script)
     {
         return !script->OnBeforeQuestComplete(player, quest_id);
     });
@@ -731,7 +731,7 @@ bool ScriptMgr::OnBeforePlayerQuestComplete(Player* player, uint32 quest_id)
 }
 void ScriptMgr::OnQuestComputeXP(Player* player, Quest const* quest, uint32& xpValue)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_QUEST_COMPUTE_XP, [&](PlayerScript* script)
     {
         script->OnQuestComputeXP(player, quest, xpValue);
     });
@@ -739,7 +739,7 @@ void ScriptMgr::OnQuestComputeXP(Player* player, Quest const* quest, uint32& xpV
 
 void ScriptMgr::OnBeforeStoreOrEquipNewItem(Player* player, uint32 vendorslot, uint32& item, uint8 count, uint8 bag, uint8 slot, ItemTemplate const* pProto, Creature* pVendor, VendorItem const* crItem, bool bStore)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_BEFORE_STORE_OR_EQUIP_NEW_ITEM, [&](PlayerScript* script)
     {
         script->OnBeforeStoreOrEquipNewItem(player, vendorslot, item, count, bag, slot, pProto, pVendor, crItem, bStore);
     });
@@ -747,7 +747,7 @@ void ScriptMgr::OnBeforeStoreOrEquipNewItem(Player* player, uint32 vendorslot, u
 
 bool ScriptMgr::CanJoinInArenaQueue(Player* player, ObjectGuid BattlemasterGuid, uint8 arenaslot, BattlegroundTypeId BGTypeID, uint8 joinAsGroup, uint8 IsRated, GroupJoinBattlegroundResult& err)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_JOIN_IN_ARENA_QUEUE, [&](PlayerScript* script)
     {
         return !script->CanJoinInArenaQueue(player, BattlemasterGuid, arenaslot, BGTypeID, joinAsGroup, IsRated, err);
     });
@@ -762,7 +762,7 @@ bool ScriptMgr::CanJoinInArenaQueue(Player* player, ObjectGuid BattlemasterGuid,
 
 bool ScriptMgr::CanBattleFieldPort(Player* player, uint8 arenaType, BattlegroundTypeId BGTypeID, uint8 action)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_BATTLE_FIELD_PORT, [&](PlayerScript* script)
     {
         return !script->CanBattleFieldPort(player, arenaType, BGTypeID, action);
     });
@@ -777,7 +777,7 @@ bool ScriptMgr::CanBattleFieldPort(Player* player, uint8 arenaType, Battleground
 
 bool ScriptMgr::CanGroupInvite(Player* player, std::string& membername)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_GROUP_INVITE, [&](PlayerScript* script)
     {
         return !script->CanGroupInvite(player, membername);
     });
@@ -792,7 +792,7 @@ bool ScriptMgr::CanGroupInvite(Player* player, std::string& membername)
 
 bool ScriptMgr::CanGroupAccept(Player* player, Group* group)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_GROUP_ACCEPT, [&](PlayerScript* script)
     {
         return !script->CanGroupAccept(player, group);
     });
@@ -807,7 +807,7 @@ bool ScriptMgr::CanGroupAccept(Player* player, Group* group)
 
 bool ScriptMgr::CanSellItem(Player* player, Item* item, Creature* creature)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_SELL_ITEM, [&](PlayerScript* script)
     {
         return !script->CanSellItem(player, item, creature);
     });
@@ -822,7 +822,7 @@ bool ScriptMgr::CanSellItem(Player* player, Item* item, Creature* creature)
 
 bool ScriptMgr::CanSendMail(Player* player, ObjectGuid receiverGuid, ObjectGuid mailbox, std::string& subject, std::string& body, uint32 money, uint32 COD, Item* item)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_SEND_MAIL, [&](PlayerScript* script)
     {
         return !script->CanSendMail(player, receiverGuid, mailbox, subject, body, money, COD, item);
     });
@@ -837,7 +837,7 @@ bool ScriptMgr::CanSendMail(Player* player, ObjectGuid receiverGuid, ObjectGuid
 
 void ScriptMgr::PetitionBuy(Player* player, Creature* creature, uint32& charterid, uint32& cost, uint32& type)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_PETITION_BUY, [&](PlayerScript* script)
     {
         script->PetitionBuy(player, creature, charterid, cost, type);
     });
@@ -845,7 +845,7 @@ void ScriptMgr::PetitionBuy(Player* player, Creature* creature, uint32& charteri
 
 void ScriptMgr::PetitionShowList(Player* player, Creature* creature, uint32& CharterEntry, uint32& CharterDispayID, uint32& CharterCost)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_PETITION_SHOW_LIST, [&](PlayerScript* script)
     {
         script->PetitionShowList(player, creature, CharterEntry, CharterDispayID, CharterCost);
     });
@@ -853,7 +853,7 @@ void ScriptMgr::PetitionShowList(Player* player, Creature* creature, uint32& Cha
 
 void ScriptMgr::OnRewardKillRewarder(Player* player, bool isDungeon, float& rate)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_REWARD_KILL_REWARDER, [&](PlayerScript* script)
     {
         script->OnRewardKillRewarder(player, isDungeon, rate);
     });
@@ -861,7 +861,7 @@ void ScriptMgr::OnRewardKillRewarder(Player* player, bool isDungeon, float& rate
 
 bool ScriptMgr::CanGiveMailRewardAtGiveLevel(Player* player, uint8 level)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_GIVE_MAIL_REWARD_AT_GIVE_LEVEL, [&](PlayerScript* script)
     {
         return !script->CanGiveMailRewardAtGiveLevel(player, level);
     });
@@ -876,7 +876,7 @@ bool ScriptMgr::CanGiveMailRewardAtGiveLevel(Player* player, uint8 level)
 
 void ScriptMgr::OnDeleteFromDB(CharacterDatabaseTransaction trans, uint32 guid)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_DELETE_FROM_DB, [&](PlayerScript* script)
     {
         script->OnDeleteFromDB(trans, guid);
     });
@@ -884,7 +884,7 @@ void ScriptMgr::OnDeleteFromDB(CharacterDatabaseTransaction trans, uint32 guid)
 
 bool ScriptMgr::CanRepopAtGraveyard(Player* player)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_REPOP_AT_GRAVEYARD, [&](PlayerScript* script)
     {
         return !script->CanRepopAtGraveyard(player);
     });
@@ -899,7 +899,7 @@ bool ScriptMgr::CanRepopAtGraveyard(Player* player)
 
 void ScriptMgr::OnGetMaxSkillValue(Player* player, uint32 skill, int32& result, bool IsPure)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_GET_MAX_SKILL_VALUE, [&](PlayerScript* script)
     {
         script->OnGetMaxSkillValue(player, skill, result, IsPure);
     });
@@ -907,7 +907,7 @@ void ScriptMgr::OnGetMaxSkillValue(Player* player, uint32 skill, int32& result,
 
 bool ScriptMgr::CanAreaExploreAndOutdoor(Player* player)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_AREA_EXPLORE_AND_OUTDOOR, [&](PlayerScript* script)
     {
         return !script->CanAreaExploreAndOutdoor(player);
     });
@@ -922,7 +922,7 @@ bool ScriptMgr::CanAreaExploreAndOutdoor(Player* player)
 
 void ScriptMgr::OnVictimRewardBefore(Player* player, Player* victim, uint32& killer_title, uint32& victim_title)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_VICTIM_REWARD_BEFORE, [&](PlayerScript* script)
     {
         script->OnVictimRewardBefore(player, victim, killer_title, victim_title);
     });
@@ -930,7 +930,7 @@ void ScriptMgr::OnVictimRewardBefore(Player* player, Player* victim, uint32& kil
 
 void ScriptMgr::OnVictimRewardAfter(Player* player, Player* victim, uint32& killer_title, uint32& victim_rank, float& honor_f)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_VICTIM_REWARD_AFTER, [&](PlayerScript* script)
     {
         script->OnVictimRewardAfter(player, victim, killer_title, victim_rank, honor_f);
     });
@@ -938,7 +938,7 @@ void ScriptMgr::OnVictimRewardAfter(Player* player, Player* victim, uint32& kill
 
 void ScriptMgr::OnCustomScalingStatValueBefore(Player* player, ItemTemplate const* proto, uint8 slot, bool apply, uint32& CustomScalingStatValue)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CUSTOM_SCALING_STAT_VALUE_BEFORE, [&](PlayerScript* script)
     {
         script->OnCustomScalingStatValueBefore(player, proto, slot, apply, CustomScalingStatValue);
     });
@@ -946,7 +946,7 @@ void ScriptMgr::OnCustomScalingStatValueBefore(Player* player, ItemTemplate cons
 
 void ScriptMgr::OnCustomScalingStatValue(Player* player, ItemTemplate const* proto, uint32& statType, int32& val, uint8 itemProtoStatNumber, uint32 ScalingStatValue, ScalingStatValuesEntry const* ssv)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_CUSTOM_SCALING_STAT_VALUE, [&](PlayerScript* script)
     {
         script->OnCustomScalingStatValue(player, proto, statType, val, itemProtoStatNumber, ScalingStatValue, ssv);
     });
@@ -954,7 +954,7 @@ void ScriptMgr::OnCustomScalingStatValue(Player* player, ItemTemplate const* pro
 
 bool ScriptMgr::CanArmorDamageModifier(Player* player)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_ARMOR_DAMAGE_MODIFIER, [&](PlayerScript* script)
     {
         return !script->CanArmorDamageModifier(player);
     });
@@ -969,7 +969,7 @@ bool ScriptMgr::CanArmorDamageModifier(Player* player)
 
 void ScriptMgr::OnGetFeralApBonus(Player* player, int32& feral_bonus, int32 dpsMod, ItemTemplate const* proto, ScalingStatValuesEntry const* ssv)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_GET_FERAL_AP_BONUS, [&](PlayerScript* script)
     {
         script->OnGetFeralApBonus(player, feral_bonus, dpsMod, proto, ssv);
     });
@@ -977,7 +977,7 @@ void ScriptMgr::OnGetFeralApBonus(Player* player, int32& feral_bonus, int32 dpsM
 
 bool ScriptMgr::CanApplyWeaponDependentAuraDamageMod(Player* player, Item* item, WeaponAttackType attackType, AuraEffect const* aura, bool apply)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_APPLY_WEAPON_DEPENDENT_AURA_DAMAGE_MOD, [&](PlayerScript* script)
     {
         return !script->CanApplyWeaponDependentAuraDamageMod(player, item, attackType, aura, apply);
     });
@@ -992,7 +992,7 @@ bool ScriptMgr::CanApplyWeaponDependentAuraDamageMod(Player* player, Item* item,
 
 bool ScriptMgr::CanApplyEquipSpell(Player* player, SpellInfo const* spellInfo, Item* item, bool apply, bool form_change)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_APPLY_EQUIP_SPELL, [&](PlayerScript* script)
     {
         return !script->CanApplyEquipSpell(player, spellInfo, item, apply, form_change);
     });
@@ -1007,7 +1007,7 @@ bool ScriptMgr::CanApplyEquipSpell(Player* player, SpellInfo const* spellInfo, I
 
 bool ScriptMgr::CanApplyEquipSpellsItemSet(Player* player, ItemSetEffect* eff)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_APPLY_EQUIP_SPELLS_ITEM_SET, [&](PlayerScript* script)
     {
         return !script->CanApplyEquipSpellsItemSet(player, eff);
     });
@@ -1022,7 +1022,7 @@ bool ScriptMgr::CanApplyEquipSpellsItemSet(Player* player, ItemSetEffect* eff)
 
 bool ScriptMgr::CanCastItemCombatSpell(Player* player, Unit* target, WeaponAttackType attType, uint32 procVictim, uint32 procEx, Item* item, ItemTemplate const* proto)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_CAST_ITEM_COMBAT_SPELL, [&](PlayerScript* script)
     {
         return !script->CanCastItemCombatSpell(player, target, attType, procVictim, procEx, item, proto);
     });
@@ -1037,7 +1037,7 @@ bool ScriptMgr::CanCastItemCombatSpell(Player* player, Unit* target, WeaponAttac
 
 bool ScriptMgr::CanCastItemUseSpell(Player* player, Item* item, SpellCastTargets const& targets, uint8 cast_count, uint32 glyphIndex)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_CAST_ITEM_USE_SPELL, [&](PlayerScript* script)
     {
         return !script->CanCastItemUseSpell(player, item, targets, cast_count, glyphIndex);
     });
@@ -1052,7 +1052,7 @@ bool ScriptMgr::CanCastItemUseSpell(Player* player, Item* item, SpellCastTargets
 
 void ScriptMgr::OnApplyAmmoBonuses(Player* player, ItemTemplate const* proto, float& currentAmmoDPS)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_APPLY_AMMO_BONUSES, [&](PlayerScript* script)
     {
         script->OnApplyAmmoBonuses(player, proto, currentAmmoDPS);
     });
@@ -1060,7 +1060,7 @@ void ScriptMgr::OnApplyAmmoBonuses(Player* player, ItemTemplate const* proto, fl
 
 bool ScriptMgr::CanEquipItem(Player* player, uint8 slot, uint16& dest, Item* pItem, bool swap, bool not_loading)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_EQUIP_ITEM, [&](PlayerScript* script)
     {
         return !script->CanEquipItem(player, slot, dest, pItem, swap, not_loading);
     });
@@ -1075,7 +1075,7 @@ bool ScriptMgr::CanEquipItem(Player* player, uint8 slot, uint16& dest, Item* pIt
 
 bool ScriptMgr::CanUnequipItem(Player* player, uint16 pos, bool swap)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_UNEQUIP_ITEM, [&](PlayerScript* script)
     {
         return !script->CanUnequipItem(player, pos, swap);
     });
@@ -1090,7 +1090,7 @@ bool ScriptMgr::CanUnequipItem(Player* player, uint16 pos, bool swap)
 
 bool ScriptMgr::CanUseItem(Player* player, ItemTemplate const* proto, InventoryResult& result)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_USE_ITEM, [&](PlayerScript* script)
     {
         return !script->CanUseItem(player, proto, result);
     });
@@ -1105,7 +1105,7 @@ bool ScriptMgr::CanUseItem(Player* player, ItemTemplate const* proto, InventoryR
 
 bool ScriptMgr::CanSaveEquipNewItem(Player* player, Item* item, uint16 pos, bool update)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_SAVE_EQUIP_NEW_ITEM, [&](PlayerScript* script)
     {
         return !script->CanSaveEquipNewItem(player, item, pos, update);
     });
@@ -1120,7 +1120,7 @@ bool ScriptMgr::CanSaveEquipNewItem(Player* player, Item* item, uint16 pos, bool
 
 bool ScriptMgr::CanApplyEnchantment(Player* player, Item* item, EnchantmentSlot slot, bool apply, bool apply_dur, bool ignore_condition)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_APPLY_ENCHANTMENT, [&](PlayerScript* script)
     {
         return !script->CanApplyEnchantment(player, item, slot, apply, apply_dur, ignore_condition);
     });
@@ -1135,7 +1135,7 @@ bool ScriptMgr::CanApplyEnchantment(Player* player, Item* item, EnchantmentSlot
 
 void ScriptMgr::OnGetQuestRate(Player* player, float& result)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_GET_QUEST_RATE, [&](PlayerScript* script)
     {
         script->OnGetQuestRate(player, result);
     });
@@ -1143,7 +1143,7 @@ void ScriptMgr::OnGetQuestRate(Player* player, float& result)
 
 bool ScriptMgr::PassedQuestKilledMonsterCredit(Player* player, Quest const* qinfo, uint32 entry, uint32 real_entry, ObjectGuid guid)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_PASSED_QUEST_KILLED_MONSTER_CREDIT, [&](PlayerScript* script)
     {
         return !script->PassedQuestKilledMonsterCredit(player, qinfo, entry, real_entry, guid);
     });
@@ -1158,7 +1158,7 @@ bool ScriptMgr::PassedQuestKilledMonsterCredit(Player* player, Quest const* qinf
 
 bool ScriptMgr::CheckItemInSlotAtLoadInventory(Player* player, Item* item, uint8 slot, uint8& err, uint16& dest)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CHECK_ITEM_IN_SLOT_AT_LOAD_INVENTORY, [&](PlayerScript* script)
     {
         return !script->CheckItemInSlotAtLoadInventory(player, item, slot, err, dest);
     });
@@ -1173,7 +1173,7 @@ bool ScriptMgr::CheckItemInSlotAtLoadInventory(Player* player, Item* item, uint8
 
 bool ScriptMgr::NotAvoidSatisfy(Player* player, DungeonProgressionRequirements const* ar, uint32 target_map, bool report)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_NOT_AVOID_SATISFY, [&](PlayerScript* script)
     {
         return !script->NotAvoidSatisfy(player, ar, target_map, report);
     });
@@ -1188,7 +1188,7 @@ bool ScriptMgr::NotAvoidSatisfy(Player* player, DungeonProgressionRequirements c
 
 bool ScriptMgr::NotVisibleGloballyFor(Player* player, Player const* u)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_NOT_VISIBLE_GLOBALLY_FOR, [&](PlayerScript* script)
     {
         return !script->NotVisibleGloballyFor(player, u);
     });
@@ -1203,7 +1203,7 @@ bool ScriptMgr::NotVisibleGloballyFor(Player* player, Player const* u)
 
 void ScriptMgr::OnGetArenaPersonalRating(Player* player, uint8 slot, uint32& result)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_GET_ARENA_PERSONAL_RATING, [&](PlayerScript* script)
     {
         script->OnGetArenaPersonalRating(player, slot, result);
     });
@@ -1211,7 +1211,7 @@ void ScriptMgr::OnGetArenaPersonalRating(Player* player, uint8 slot, uint32& res
 
 void ScriptMgr::OnGetArenaTeamId(Player* player, uint8 slot, uint32& result)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_GET_ARENA_TEAM_ID, [&](PlayerScript* script)
     {
         script->OnGetArenaTeamId(player, slot, result);
     });
@@ -1219,7 +1219,7 @@ void ScriptMgr::OnGetArenaTeamId(Player* player, uint8 slot, uint32& result)
 
 void ScriptMgr::OnIsFFAPvP(Player* player, bool& result)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_IS_FFA_PVP, [&](PlayerScript* script)
     {
         script->OnIsFFAPvP(player, result);
     });
@@ -1227,7 +1227,7 @@ void ScriptMgr::OnIsFFAPvP(Player* player, bool& result)
 
 void ScriptMgr::OnIsPvP(Player* player, bool& result)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_IS_PVP, [&](PlayerScript* script)
     {
         script->OnIsPvP(player, result);
     });
@@ -1235,7 +1235,7 @@ void ScriptMgr::OnIsPvP(Player* player, bool& result)
 
 void ScriptMgr::OnGetMaxSkillValueForLevel(Player* player, uint16& result)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_GET_MAX_SKILL_VALUE_FOR_LEVEL, [&](PlayerScript* script)
     {
         script->OnGetMaxSkillValueForLevel(player, result);
     });
@@ -1243,7 +1243,7 @@ void ScriptMgr::OnGetMaxSkillValueForLevel(Player* player, uint16& result)
 
 bool ScriptMgr::NotSetArenaTeamInfoField(Player* player, uint8 slot, ArenaTeamInfoType type, uint32 value)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_NOT_SET_ARENA_TEAM_INFO_FIELD, [&](PlayerScript* script)
     {
         return !script->NotSetArenaTeamInfoField(player, slot, type, value);
     });
@@ -1258,7 +1258,7 @@ bool ScriptMgr::NotSetArenaTeamInfoField(Player* player, uint8 slot, ArenaTeamIn
 
 bool ScriptMgr::CanJoinLfg(Player* player, uint8 roles, lfg::LfgDungeonSet& dungeons, const std::string& comment)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_JOIN_LFG, [&](PlayerScript* script)
     {
         return !script->CanJoinLfg(player, roles, dungeons, comment);
     });
@@ -1273,7 +1273,7 @@ bool ScriptMgr::CanJoinLfg(Player* player, uint8 roles, lfg::LfgDungeonSet& dung
 
 bool ScriptMgr::CanEnterMap(Player* player, MapEntry const* entry, InstanceTemplate const* instance, MapDifficulty const* mapDiff, bool loginCheck)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_ENTER_MAP, [&](PlayerScript* script)
     {
         return !script->CanEnterMap(player, entry, instance, mapDiff, loginCheck);
     });
@@ -1288,7 +1288,7 @@ bool ScriptMgr::CanEnterMap(Player* player, MapEntry const* entry, InstanceTempl
 
 bool ScriptMgr::CanInitTrade(Player* player, Player* target)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_INIT_TRADE, [&](PlayerScript* script)
     {
         return !script->CanInitTrade(player, target);
     });
@@ -1303,7 +1303,7 @@ bool ScriptMgr::CanInitTrade(Player* player, Player* target)
 
 void ScriptMgr::OnSetServerSideVisibility(Player* player, ServerSideVisibilityType& type, AccountTypes& sec)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_SET_SERVER_SIDE_VISIBILITY, [&](PlayerScript* script)
     {
         script->OnSetServerSideVisibility(player, type, sec);
     });
@@ -1311,7 +1311,7 @@ void ScriptMgr::OnSetServerSideVisibility(Player* player, ServerSideVisibilityTy
 
 void ScriptMgr::OnSetServerSideVisibilityDetect(Player* player, ServerSideVisibilityType& type, AccountTypes& sec)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_SET_SERVER_SIDE_VISIBILITY_DETECT, [&](PlayerScript* script)
     {
         script->OnSetServerSideVisibilityDetect(player, type, sec);
     });
@@ -1319,7 +1319,7 @@ void ScriptMgr::OnSetServerSideVisibilityDetect(Player* player, ServerSideVisibi
 
 void ScriptMgr::OnGiveHonorPoints(Player* player, float& honor, Unit* victim)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_GIVE_HONOR_POINTS, [&](PlayerScript* script)
     {
         script->OnGiveHonorPoints(player, honor, victim);
     });
@@ -1327,7 +1327,7 @@ void ScriptMgr::OnGiveHonorPoints(Player* player, float& honor, Unit* victim)
 
 void ScriptMgr::OnAfterResurrect(Player* player, float restore_percent, bool applySickness)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_AFTER_RESURRECT, [&](PlayerScript* script)
     {
         script->OnAfterResurrect(player, restore_percent, applySickness);
     });
@@ -1335,7 +1335,7 @@ void ScriptMgr::OnAfterResurrect(Player* player, float restore_percent, bool app
 
 void ScriptMgr::OnPlayerResurrect(Player* player, float restore_percent, bool applySickness)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_PLAYER_RESURRECT, [&](PlayerScript* script)
     {
         script->OnPlayerResurrect(player, restore_percent, applySickness);
     });
@@ -1343,7 +1343,7 @@ void ScriptMgr::OnPlayerResurrect(Player* player, float restore_percent, bool ap
 
 bool ScriptMgr::CanPlayerUseChat(Player* player, uint32 type, uint32 language, std::string& msg)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_PLAYER_USE_CHAT, [&](PlayerScript* script)
     {
         return !script->CanPlayerUseChat(player, type, language, msg);
     });
@@ -1358,7 +1358,7 @@ bool ScriptMgr::CanPlayerUseChat(Player* player, uint32 type, uint32 language, s
 
 bool ScriptMgr::CanPlayerUseChat(Player* player, uint32 type, uint32 language, std::string& msg, Player* receiver)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_PLAYER_USE_CHAT, [&](PlayerScript* script)
     {
         return !script->CanPlayerUseChat(player, type, language, msg, receiver);
     });
@@ -1373,7 +1373,7 @@ bool ScriptMgr::CanPlayerUseChat(Player* player, uint32 type, uint32 language, s
 
 bool ScriptMgr::CanPlayerUseChat(Player* player, uint32 type, uint32 language, std::string& msg, Group* group)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_PLAYER_USE_CHAT, [&](PlayerScript* script)
     {
         return !script->CanPlayerUseChat(player, type, language, msg, group);
     });
@@ -1388,7 +1388,7 @@ bool ScriptMgr::CanPlayerUseChat(Player* player, uint32 type, uint32 language, s
 
 bool ScriptMgr::CanPlayerUseChat(Player* player, uint32 type, uint32 language, std::string& msg, Guild* guild)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_PLAYER_USE_CHAT, [&](PlayerScript* script)
     {
         return !script->CanPlayerUseChat(player, type, language, msg, guild);
     });
@@ -1403,7 +1403,7 @@ bool ScriptMgr::CanPlayerUseChat(Player* player, uint32 type, uint32 language, s
 
 bool ScriptMgr::CanPlayerUseChat(Player* player, uint32 type, uint32 language, std::string& msg, Channel* channel)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_CAN_PLAYER_USE_CHAT, [&](PlayerScript* script)
     {
         return !script->CanPlayerUseChat(player, type, language, msg, channel);
     });
@@ -1418,7 +1418,7 @@ bool ScriptMgr::CanPlayerUseChat(Player* player, uint32 type, uint32 language, s
 
 void ScriptMgr::OnPlayerLearnTalents(Player* player, uint32 talentId, uint32 talentRank, uint32 spellid)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_PLAYER_LEARN_TALENTS, [&](PlayerScript* script)
     {
         script->OnPlayerLearnTalents(player, talentId, talentRank, spellid);
     });
@@ -1426,7 +1426,7 @@ void ScriptMgr::OnPlayerLearnTalents(Player* player, uint32 talentId, uint32 tal
 
 void ScriptMgr::OnPlayerEnterCombat(Player* player, Unit* enemy)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_PLAYER_ENTER_COMBAT, [&](PlayerScript* script)
     {
         script->OnPlayerEnterCombat(player, enemy);
     });
@@ -1434,7 +1434,7 @@ void ScriptMgr::OnPlayerEnterCombat(Player* player, Unit* enemy)
 
 void ScriptMgr::OnPlayerLeaveCombat(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_PLAYER_LEAVE_COMBAT, [&](PlayerScript* script)
     {
         script->OnPlayerLeaveCombat(player);
     });
@@ -1442,7 +1442,7 @@ void ScriptMgr::OnPlayerLeaveCombat(Player* player)
 
 void ScriptMgr::OnQuestAbandon(Player* player, uint32 questId)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ON_QUEST_ABANDON, [&](PlayerScript* script)
     {
         script->OnQuestAbandon(player, questId);
     });
@@ -1451,7 +1451,7 @@ void ScriptMgr::OnQuestAbandon(Player* player, uint32 questId)
 // Player anti cheat
 void ScriptMgr::AnticheatSetSkipOnePacketForASH(Player* player, bool apply)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ANTICHEAT_SET_SKIP_ONE_PACKET_FOR_ASH, [&](PlayerScript* script)
     {
         script->AnticheatSetSkipOnePacketForASH(player, apply);
     });
@@ -1459,7 +1459,7 @@ void ScriptMgr::AnticheatSetSkipOnePacketForASH(Player* player, bool apply)
 
 void ScriptMgr::AnticheatSetCanFlybyServer(Player* player, bool apply)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ANTICHEAT_SET_CAN_FLYBY_SERVER, [&](PlayerScript* script)
     {
         script->AnticheatSetCanFlybyServer(player, apply);
     });
@@ -1467,7 +1467,7 @@ void ScriptMgr::AnticheatSetCanFlybyServer(Player* player, bool apply)
 
 void ScriptMgr::AnticheatSetUnderACKmount(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ANTICHEAT_SET_UNDER_AC_KMOUNT, [&](PlayerScript* script)
     {
         script->AnticheatSetUnderACKmount(player);
     });
@@ -1475,7 +1475,7 @@ void ScriptMgr::AnticheatSetUnderACKmount(Player* player)
 
 void ScriptMgr::AnticheatSetRootACKUpd(Player* player)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ANTICHEAT_SET_ROOT_ACK_UPD, [&](PlayerScript* script)
     {
         script->AnticheatSetRootACKUpd(player);
     });
@@ -1483,7 +1483,7 @@ void ScriptMgr::AnticheatSetRootACKUpd(Player* player)
 
 void ScriptMgr::AnticheatSetJumpingbyOpcode(Player* player, bool jump)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ANTICHEAT_SET_JUMPINGBY_OPCODE, [&](PlayerScript* script)
     {
         script->AnticheatSetJumpingbyOpcode(player, jump);
     });
@@ -1491,7 +1491,7 @@ void ScriptMgr::AnticheatSetJumpingbyOpcode(Player* player, bool jump)
 
 void ScriptMgr::AnticheatUpdateMovementInfo(Player* player, MovementInfo const& movementInfo)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteScript<PlayerScript>(PLAYERHOOK_ANTICHEAT_UPDATE_MOVEMENT_INFO, [&](PlayerScript* script)
     {
         script->AnticheatUpdateMovementInfo(player, movementInfo);
     });
@@ -1499,7 +1499,7 @@ void ScriptMgr::AnticheatUpdateMovementInfo(Player* player, MovementInfo const&
 
 bool ScriptMgr::AnticheatHandleDoubleJump(Player* player, Unit* mover)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_ANTICHEAT_HANDLE_DOUBLE_JUMP, [&](PlayerScript* script)
     {
         return !script->AnticheatHandleDoubleJump(player, mover);
     });
@@ -1514,7 +1514,7 @@ bool ScriptMgr::AnticheatHandleDoubleJump(Player* player, Unit* mover)
 
 bool ScriptMgr::AnticheatCheckMovementInfo(Player* player, MovementInfo const& movementInfo, Unit* mover, bool jump)
 {
-    auto ret = IsValidBoolScript<PlayerScript>([&](PlayerScript* script)
+    auto ret = IsValidBoolScript<PlayerScript>(PLAYERHOOK_ANTICHEAT_CHECK_MOVEMENT_INFO, [&](PlayerScript* script)
     {
         return !script->AnticheatCheckMovementInfo(player, movementInfo, mover, jump);
     });
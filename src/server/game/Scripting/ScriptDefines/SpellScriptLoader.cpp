@@ -15,12 +15,24 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "GameConfig.h"
 #include "ScriptMgr.h"
 #include "SpellScript.h"
 
+namespace
+{
+    uint64 GetSpellScriptHooksKey(uint32 spellId, uint32 scriptId)
+    {
+        return (uint64(spellId) << 32) | scriptId;
+    }
+}
+
+static GameConfigOption<bool> const spellScriptShareHooks("Spells.ShareScriptHooks", true);
+
 void ScriptMgr::CreateSpellScripts(uint32 spellId, std::list<SpellScript*>& scriptVector)
 {
     SpellScriptsBounds bounds = sObjectMgr->GetSpellScriptsBounds(spellId);
+    bool shareHooks = spellScriptShareHooks.Get();
 
     for (SpellScriptsContainer::iterator itr = bounds.first; itr != bounds.second; ++itr)
     {
@@ -35,6 +47,13 @@ void ScriptMgr::CreateSpellScripts(uint32 spellId, std::list<SpellScript*>& scri
 
         script->_Init(&tempScript->GetName(), spellId);
 
+        if (shareHooks)
+        {
+            auto hooks = _spellScriptHooks.find(GetSpellScriptHooksKey(spellId, itr->second));
+            if (hooks != _spellScriptHooks.end())
+                script->_ShareHooks(*hooks->second);
+        }
+
         scriptVector.push_back(script);
     }
 }
@@ -42,6 +61,7 @@ void ScriptMgr::CreateSpellScripts(uint32 spellId, std::list<SpellScript*>& scri
 void ScriptMgr::CreateAuraScripts(uint32 spellId, std::list<AuraScript*>& scriptVector)
 {
     SpellScriptsBounds bounds = sObjectMgr->GetSpellScriptsBounds(spellId);
+    bool shareHooks = spellScriptShareHooks.Get();
 
     for (SpellScriptsContainer::iterator itr = bounds.first; itr != bounds.second; ++itr)
     {
@@ -56,6 +76,13 @@ void ScriptMgr::CreateAuraScripts(uint32 spellId, std::list<AuraScript*>& script
 
         script->_Init(&tempScript->GetName(), spellId);
 
+        if (shareHooks)
+        {
+            auto hooks = _auraScriptHooks.find(GetSpellScriptHooksKey(spellId, itr->second));
+            if (hooks != _auraScriptHooks.end())
+                script->_ShareHooks(*hooks->second);
+        }
+
         scriptVector.push_back(script);
     }
 }
@@ -74,3 +101,34 @@ void ScriptMgr::CreateSpellScriptLoaders(uint32 spellId, std::vector<std::pair<S
         scriptVector.emplace_back(tempScript, itr);
     }
 }
+
+void ScriptMgr::AddSpellScriptHooks(uint32 spellId, uint32 scriptId, SpellScript* spellScript, AuraScript* auraScript)
+{
+    uint64 key = GetSpellScriptHooksKey(spellId, scriptId);
+
+    if (spellScript)
+    {
+        SpellScript*& hooks = _spellScriptHooks[key];
+        delete hooks;
+        hooks = spellScript;
+    }
+
+    if (auraScript)
+    {
+        AuraScript*& hooks = _auraScriptHooks[key];
+        delete hooks;
+        hooks = auraScript;
+    }
+}
+
+void ScriptMgr::UnloadSpellScriptHooks()
+{
+    for (auto const& [key, script] : _spellScriptHooks)
+        delete script;
+
+    for (auto const& [key, script] : _auraScriptHooks)
+        delete script;
+
+    _spellScriptHooks.clear();
+    _auraScriptHooks.clear();
+}
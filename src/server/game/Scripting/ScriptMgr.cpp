@@ -33,6 +33,9 @@ namespace
         }
 
         ScriptRegistry<T>::ScriptPointerList.clear();
+
+        for (auto& subscribers : ScriptRegistry<T>::EnabledHooks)
+            subscribers.clear();
     }
 }
 
@@ -74,6 +77,8 @@ void ScriptMgr::Initialize()
 
 void ScriptMgr::Unload()
 {
+    UnloadSpellScriptHooks();
+
     SCR_CLEAR<AccountScript>();
     SCR_CLEAR<AchievementCriteriaScript>();
     SCR_CLEAR<AchievementScript>();
@@ -294,23 +299,23 @@ void ScriptMgr::FillSpellSummary()
 }
 
 ///-
-AllMapScript::AllMapScript(const char* name)
+AllMapScript::AllMapScript(const char* name, std::vector<uint16> enabledHooks)
     : ScriptObject(name)
 {
-    ScriptRegistry<AllMapScript>::AddScript(this);
+    ScriptRegistry<AllMapScript>::AddScript(this, enabledHooks);
 }
 
-AllCreatureScript::AllCreatureScript(const char* name)
+AllCreatureScript::AllCreatureScript(const char* name, std::vector<uint16> enabledHooks)
     : ScriptObject(name)
 {
-    ScriptRegistry<AllCreatureScript>::AddScript(this);
+    ScriptRegistry<AllCreatureScript>::AddScript(this, enabledHooks);
 }
 
-UnitScript::UnitScript(const char* name, bool addToScripts)
+UnitScript::UnitScript(const char* name, bool addToScripts, std::vector<uint16> enabledHooks)
     : ScriptObject(name)
 {
     if (addToScripts)
-        ScriptRegistry<UnitScript>::AddScript(this);
+        ScriptRegistry<UnitScript>::AddScript(this, enabledHooks);
 }
 
 MovementHandlerScript::MovementHandlerScript(const char* name)
@@ -477,10 +482,10 @@ AchievementCriteriaScript::AchievementCriteriaScript(const char* name)
     ScriptRegistry<AchievementCriteriaScript>::AddScript(this);
 }
 
-PlayerScript::PlayerScript(const char* name)
+PlayerScript::PlayerScript(const char* name, std::vector<uint16> enabledHooks)
     : ScriptObject(name)
 {
-    ScriptRegistry<PlayerScript>::AddScript(this);
+    ScriptRegistry<PlayerScript>::AddScript(this, enabledHooks);
 }
 
 AccountScript::AccountScript(const char* name)
@@ -598,9 +603,9 @@ AllItemScript::AllItemScript(const char* name) : ScriptObject(name)
     ScriptRegistry<AllItemScript>::AddScript(this);
 }
 
-AllGameObjectScript::AllGameObjectScript(const char* name) : ScriptObject(name)
+AllGameObjectScript::AllGameObjectScript(const char* name, std::vector<uint16> enabledHooks) : ScriptObject(name)
 {
-    ScriptRegistry<AllGameObjectScript>::AddScript(this);
+    ScriptRegistry<AllGameObjectScript>::AddScript(this, enabledHooks);
 }
 
 // Specialize for each script type class like so:
@@ -35,7 +35,10 @@
 #include "Types.h"
 #include "Weather.h"
 #include "World.h"
+#include <array>
 #include <atomic>
+#include <type_traits>
+#include <unordered_map>
 
 class AuctionHouseObject;
 class AuraScript;
@@ -422,10 +425,37 @@ public:
     virtual void OnGossipSelectCode(Player* /*player*/, Item* /*item*/, uint32 /*sender*/, uint32 /*action*/, const char* /*code*/) { }
 };
 
+enum UnitHook
+{
+    UNITHOOK_ON_HEAL,
+    UNITHOOK_ON_DAMAGE,
+    UNITHOOK_MODIFY_PERIODIC_DAMAGE_AURAS_TICK,
+    UNITHOOK_MODIFY_MELEE_DAMAGE,
+    UNITHOOK_MODIFY_SPELL_DAMAGE_TAKEN,
+    UNITHOOK_MODIFY_HEAL_RECIEVED,
+    UNITHOOK_DEAL_DAMAGE,
+    UNITHOOK_ON_BEFORE_ROLL_MELEE_OUTCOME_AGAINST,
+    UNITHOOK_ON_AURA_REMOVE,
+    UNITHOOK_IF_NORMAL_REACTION,
+    UNITHOOK_IS_NEED_MOD_SPELL_DAMAGE_PERCENT,
+    UNITHOOK_IS_NEED_MOD_MELEE_DAMAGE_PERCENT,
+    UNITHOOK_IS_NEED_MOD_HEAL_PERCENT,
+    UNITHOOK_CAN_SET_PHASE_MASK,
+    UNITHOOK_IS_CUSTOM_BUILD_VALUES_UPDATE,
+    UNITHOOK_ON_BUILD_VALUES_UPDATE,
+    UNITHOOK_ON_UNIT_UPDATE,
+    UNITHOOK_END
+};
+
 class WH_GAME_API UnitScript : public ScriptObject
 {
 protected:
-    UnitScript(const char* name, bool addToScripts = true);
+    UnitScript(const char* name, bool addToScripts = true, std::vector<uint16> enabledHooks = std::vector<uint16>());
+
+    // Hooks overridden by Script, pass them from the constructor of Script so its subscriptions follow its overrides.
+    // A script that overrides none of them gets an empty list, which subscribes it to every hook
+    template<class Script>
+    static std::vector<uint16> GetOverriddenHooks();
 
 public:
     // Called when a unit deals healing to another unit
@@ -487,10 +517,27 @@ public:
     virtual void OnPlayerMove(Player* /*player*/, MovementInfo /*movementInfo*/, uint32 /*opcode*/) { }
 };
 
+enum AllMapHook
+{
+    ALLMAPHOOK_ON_PLAYER_ENTER_ALL,
+    ALLMAPHOOK_ON_PLAYER_LEAVE_ALL,
+    ALLMAPHOOK_ON_BEFORE_CREATE_INSTANCE_SCRIPT,
+    ALLMAPHOOK_ON_DESTROY_INSTANCE,
+    ALLMAPHOOK_ON_CREATE_MAP,
+    ALLMAPHOOK_ON_DESTROY_MAP,
+    ALLMAPHOOK_ON_MAP_UPDATE,
+    ALLMAPHOOK_END
+};
+
 class WH_GAME_API AllMapScript : public ScriptObject
 {
 protected:
-    AllMapScript(const char* name);
+    AllMapScript(const char* name, std::vector<uint16> enabledHooks = std::vector<uint16>());
+
+    // Hooks overridden by Script, pass them from the constructor of Script so its subscriptions follow its overrides.
+    // A script that overrides none of them gets an empty list, which subscribes it to every hook
+    template<class Script>
+    static std::vector<uint16> GetOverriddenHooks();
 
 public:
     /**
@@ -551,10 +598,31 @@ public:
     virtual void OnMapUpdate(Map* /*map*/, uint32 /*diff*/) { }
 };
 
+enum AllCreatureHook
+{
+    ALLCREATUREHOOK_ON_ALL_CREATURE_UPDATE,
+    ALLCREATUREHOOK_CREATURE_SELECT_LEVEL,
+    ALLCREATUREHOOK_ON_CREATURE_ADD_WORLD,
+    ALLCREATUREHOOK_ON_CREATURE_REMOVE_WORLD,
+    ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_HELLO,
+    ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_SELECT,
+    ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_SELECT_CODE,
+    ALLCREATUREHOOK_CAN_CREATURE_QUEST_ACCEPT,
+    ALLCREATUREHOOK_CAN_CREATURE_QUEST_REWARD,
+    ALLCREATUREHOOK_GET_CREATURE_AI,
+    ALLCREATUREHOOK_CAN_CREATURE_SEND_LIST_INVENTORY,
+    ALLCREATUREHOOK_END
+};
+
 class WH_GAME_API AllCreatureScript : public ScriptObject
 {
 protected:
-    AllCreatureScript(const char* name);
+    AllCreatureScript(const char* name, std::vector<uint16> enabledHooks = std::vector<uint16>());
+
+    // Hooks overridden by Script, pass them from the constructor of Script so its subscriptions follow its overrides.
+    // A script that overrides none of them gets an empty list, which subscribes it to every hook
+    template<class Script>
+    static std::vector<uint16> GetOverriddenHooks();
 
 public:
     // Called from End of Creature Update.
@@ -650,10 +718,33 @@ public:
     virtual void OnItemGossipSelectCode(Player* /*player*/, Item* /*item*/, uint32 /*sender*/, uint32 /*action*/, const char* /*code*/) { }
 };
 
+enum AllGameObjectHook
+{
+    ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_ADD_WORLD,
+    ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_REMOVE_WORLD,
+    ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_UPDATE,
+    ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_GOSSIP_HELLO,
+    ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_GOSSIP_SELECT,
+    ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_GOSSIP_SELECT_CODE,
+    ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_QUEST_ACCEPT,
+    ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_QUEST_REWARD,
+    ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_DESTROYED,
+    ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_DAMAGED,
+    ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_LOOT_STATE_CHANGED,
+    ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_STATE_CHANGED,
+    ALLGAMEOBJECTHOOK_GET_GAME_OBJECT_AI,
+    ALLGAMEOBJECTHOOK_END
+};
+
 class WH_GAME_API AllGameObjectScript : public ScriptObject
 {
 protected:
-    AllGameObjectScript(const char* name);
+    AllGameObjectScript(const char* name, std::vector<uint16> enabledHooks = std::vector<uint16>());
+
+    // Hooks overridden by Script, pass them from the constructor of Script so its subscriptions follow its overrides.
+    // A script that overrides none of them gets an empty list, which subscribes it to every hook
+    template<class Script>
+    static std::vector<uint16> GetOverriddenHooks();
 
 public:
     /**
@@ -972,10 +1063,165 @@ public:
     [[nodiscard]] virtual bool OnCheck(Player* /*source*/, Unit* /*target*/, uint32 /*criteria_id*/) { return true; };
 };
 
+enum PlayerHook
+{
+    PLAYERHOOK_ON_PLAYER_RELEASED_GHOST,
+    PLAYERHOOK_ON_SEND_INITIAL_PACKETS_BEFORE_ADD_TO_MAP,
+    PLAYERHOOK_ON_BATTLEGROUND_DESERTION,
+    PLAYERHOOK_ON_PLAYER_COMPLETE_QUEST,
+    PLAYERHOOK_ON_PVP_KILL,
+    PLAYERHOOK_ON_PLAYER_PVP_FLAG_CHANGE,
+    PLAYERHOOK_ON_CREATURE_KILL,
+    PLAYERHOOK_ON_CREATURE_KILLED_BY_PET,
+    PLAYERHOOK_ON_PLAYER_KILLED_BY_CREATURE,
+    PLAYERHOOK_ON_LEVEL_CHANGED,
+    PLAYERHOOK_ON_FREE_TALENT_POINTS_CHANGED,
+    PLAYERHOOK_ON_TALENTS_RESET,
+    PLAYERHOOK_ON_BEFORE_UPDATE,
+    PLAYERHOOK_ON_UPDATE,
+    PLAYERHOOK_ON_MONEY_CHANGED,
+    PLAYERHOOK_ON_GIVE_XP,
+    PLAYERHOOK_ON_REPUTATION_CHANGE,
+    PLAYERHOOK_ON_REPUTATION_RANK_CHANGE,
+    PLAYERHOOK_ON_LEARN_SPELL,
+    PLAYERHOOK_ON_FORGOT_SPELL,
+    PLAYERHOOK_ON_DUEL_REQUEST,
+    PLAYERHOOK_ON_DUEL_START,
+    PLAYERHOOK_ON_DUEL_END,
+    PLAYERHOOK_ON_CHAT,
+    PLAYERHOOK_ON_BEFORE_SEND_CHAT_MESSAGE,
+    PLAYERHOOK_ON_EMOTE,
+    PLAYERHOOK_ON_TEXT_EMOTE,
+    PLAYERHOOK_ON_SPELL_CAST,
+    PLAYERHOOK_ON_LOAD_FROM_DB,
+    PLAYERHOOK_ON_LOGIN,
+    PLAYERHOOK_ON_LOGOUT,
+    PLAYERHOOK_ON_CREATE,
+    PLAYERHOOK_ON_DELETE,
+    PLAYERHOOK_ON_FAILED_DELETE,
+    PLAYERHOOK_ON_SAVE,
+    PLAYERHOOK_ON_BIND_TO_INSTANCE,
+    PLAYERHOOK_ON_UPDATE_ZONE,
+    PLAYERHOOK_ON_UPDATE_AREA,
+    PLAYERHOOK_ON_MAP_CHANGED,
+    PLAYERHOOK_ON_BEFORE_TELEPORT,
+    PLAYERHOOK_ON_UPDATE_FACTION,
+    PLAYERHOOK_ON_ADD_TO_BATTLEGROUND,
+    PLAYERHOOK_ON_QUEUE_RANDOM_DUNGEON,
+    PLAYERHOOK_ON_REMOVE_FROM_BATTLEGROUND,
+    PLAYERHOOK_ON_ACHI_COMPLETE,
+    PLAYERHOOK_ON_BEFORE_ACHI_COMPLETE,
+    PLAYERHOOK_ON_CRITERIA_PROGRESS,
+    PLAYERHOOK_ON_BEFORE_CRITERIA_PROGRESS,
+    PLAYERHOOK_ON_ACHI_SAVE,
+    PLAYERHOOK_ON_CRITERIA_SAVE,
+    PLAYERHOOK_ON_GOSSIP_SELECT,
+    PLAYERHOOK_ON_GOSSIP_SELECT_CODE,
+    PLAYERHOOK_ON_BEING_CHARMED,
+    PLAYERHOOK_ON_AFTER_SET_VISIBLE_ITEM_SLOT,
+    PLAYERHOOK_ON_AFTER_MOVE_ITEM_FROM_INVENTORY,
+    PLAYERHOOK_ON_EQUIP,
+    PLAYERHOOK_ON_PLAYER_JOIN_BG,
+    PLAYERHOOK_ON_PLAYER_JOIN_ARENA,
+    PLAYERHOOK_GET_CUSTOM_GET_ARENA_TEAM_ID,
+    PLAYERHOOK_GET_CUSTOM_ARENA_PERSONAL_RATING,
+    PLAYERHOOK_ON_GET_MAX_PERSONAL_ARENA_RATING_REQUIREMENT,
+    PLAYERHOOK_ON_LOOT_ITEM,
+    PLAYERHOOK_ON_CREATE_ITEM,
+    PLAYERHOOK_ON_QUEST_REWARD_ITEM,
+    PLAYERHOOK_ON_BEFORE_QUEST_COMPLETE,
+    PLAYERHOOK_ON_QUEST_COMPUTE_XP,
+    PLAYERHOOK_ON_BEFORE_DURABILITY_REPAIR,
+    PLAYERHOOK_ON_BEFORE_BUY_ITEM_FROM_VENDOR,
+    PLAYERHOOK_ON_BEFORE_STORE_OR_EQUIP_NEW_ITEM,
+    PLAYERHOOK_ON_AFTER_STORE_OR_EQUIP_NEW_ITEM,
+    PLAYERHOOK_ON_AFTER_UPDATE_MAX_POWER,
+    PLAYERHOOK_ON_AFTER_UPDATE_MAX_HEALTH,
+    PLAYERHOOK_ON_BEFORE_UPDATE_ATTACK_POWER_AND_DAMAGE,
+    PLAYERHOOK_ON_AFTER_UPDATE_ATTACK_POWER_AND_DAMAGE,
+    PLAYERHOOK_ON_BEFORE_INIT_TALENT_FOR_LEVEL,
+    PLAYERHOOK_ON_FIRST_LOGIN,
+    PLAYERHOOK_CAN_JOIN_IN_BATTLEGROUND_QUEUE,
+    PLAYERHOOK_SHOULD_BE_REWARDED_WITH_MONEY_INSTEAD_OF_EXP,
+    PLAYERHOOK_ON_BEFORE_TEMP_SUMMON_INIT_STATS,
+    PLAYERHOOK_ON_BEFORE_GUARDIAN_INIT_STATS_FOR_LEVEL,
+    PLAYERHOOK_ON_AFTER_GUARDIAN_INIT_STATS_FOR_LEVEL,
+    PLAYERHOOK_ON_BEFORE_LOAD_PET_FROM_DB,
+    PLAYERHOOK_CAN_JOIN_IN_ARENA_QUEUE,
+    PLAYERHOOK_CAN_BATTLE_FIELD_PORT,
+    PLAYERHOOK_CAN_GROUP_INVITE,
+    PLAYERHOOK_CAN_GROUP_ACCEPT,
+    PLAYERHOOK_CAN_SELL_ITEM,
+    PLAYERHOOK_CAN_SEND_MAIL,
+    PLAYERHOOK_PETITION_BUY,
+    PLAYERHOOK_PETITION_SHOW_LIST,
+    PLAYERHOOK_ON_REWARD_KILL_REWARDER,
+    PLAYERHOOK_CAN_GIVE_MAIL_REWARD_AT_GIVE_LEVEL,
+    PLAYERHOOK_ON_DELETE_FROM_DB,
+    PLAYERHOOK_CAN_REPOP_AT_GRAVEYARD,
+    PLAYERHOOK_ON_GET_MAX_SKILL_VALUE,
+    PLAYERHOOK_CAN_AREA_EXPLORE_AND_OUTDOOR,
+    PLAYERHOOK_ON_VICTIM_REWARD_BEFORE,
+    PLAYERHOOK_ON_VICTIM_REWARD_AFTER,
+    PLAYERHOOK_ON_CUSTOM_SCALING_STAT_VALUE_BEFORE,
+    PLAYERHOOK_ON_CUSTOM_SCALING_STAT_VALUE,
+    PLAYERHOOK_CAN_ARMOR_DAMAGE_MODIFIER,
+    PLAYERHOOK_ON_GET_FERAL_AP_BONUS,
+    PLAYERHOOK_CAN_APPLY_WEAPON_DEPENDENT_AURA_DAMAGE_MOD,
+    PLAYERHOOK_CAN_APPLY_EQUIP_SPELL,
+    PLAYERHOOK_CAN_APPLY_EQUIP_SPELLS_ITEM_SET,
+    PLAYERHOOK_CAN_CAST_ITEM_COMBAT_SPELL,
+    PLAYERHOOK_CAN_CAST_ITEM_USE_SPELL,
+    PLAYERHOOK_ON_APPLY_AMMO_BONUSES,
+    PLAYERHOOK_CAN_EQUIP_ITEM,
+    PLAYERHOOK_CAN_UNEQUIP_ITEM,
+    PLAYERHOOK_CAN_USE_ITEM,
+    PLAYERHOOK_CAN_SAVE_EQUIP_NEW_ITEM,
+    PLAYERHOOK_CAN_APPLY_ENCHANTMENT,
+    PLAYERHOOK_ON_GET_QUEST_RATE,
+    PLAYERHOOK_PASSED_QUEST_KILLED_MONSTER_CREDIT,
+    PLAYERHOOK_CHECK_ITEM_IN_SLOT_AT_LOAD_INVENTORY,
+    PLAYERHOOK_NOT_AVOID_SATISFY,
+    PLAYERHOOK_NOT_VISIBLE_GLOBALLY_FOR,
+    PLAYERHOOK_ON_GET_ARENA_PERSONAL_RATING,
+    PLAYERHOOK_ON_GET_ARENA_TEAM_ID,
+    PLAYERHOOK_ON_IS_FFA_PVP,
+    PLAYERHOOK_ON_IS_PVP,
+    PLAYERHOOK_ON_GET_MAX_SKILL_VALUE_FOR_LEVEL,
+    PLAYERHOOK_NOT_SET_ARENA_TEAM_INFO_FIELD,
+    PLAYERHOOK_CAN_JOIN_LFG,
+    PLAYERHOOK_CAN_ENTER_MAP,
+    PLAYERHOOK_CAN_INIT_TRADE,
+    PLAYERHOOK_ON_SET_SERVER_SIDE_VISIBILITY,
+    PLAYERHOOK_ON_SET_SERVER_SIDE_VISIBILITY_DETECT,
+    PLAYERHOOK_ON_GIVE_HONOR_POINTS,
+    PLAYERHOOK_ON_AFTER_RESURRECT,
+    PLAYERHOOK_ON_PLAYER_RESURRECT,
+    PLAYERHOOK_CAN_PLAYER_USE_CHAT,
+    PLAYERHOOK_ON_PLAYER_LEARN_TALENTS,
+    PLAYERHOOK_ON_PLAYER_ENTER_COMBAT,
+    PLAYERHOOK_ON_PLAYER_LEAVE_COMBAT,
+    PLAYERHOOK_ON_QUEST_ABANDON,
+    PLAYERHOOK_ANTICHEAT_SET_SKIP_ONE_PACKET_FOR_ASH,
+    PLAYERHOOK_ANTICHEAT_SET_CAN_FLYBY_SERVER,
+    PLAYERHOOK_ANTICHEAT_SET_UNDER_AC_KMOUNT,
+    PLAYERHOOK_ANTICHEAT_SET_ROOT_ACK_UPD,
+    PLAYERHOOK_ANTICHEAT_SET_JUMPINGBY_OPCODE,
+    PLAYERHOOK_ANTICHEAT_UPDATE_MOVEMENT_INFO,
+    PLAYERHOOK_ANTICHEAT_HANDLE_DOUBLE_JUMP,
+    PLAYERHOOK_ANTICHEAT_CHECK_MOVEMENT_INFO,
+    PLAYERHOOK_END
+};
+
 class WH_GAME_API PlayerScript : public ScriptObject
 {
 protected:
-    PlayerScript(const char* name);
+    PlayerScript(const char* name, std::vector<uint16> enabledHooks = std::vector<uint16>());
+
+    // Hooks overridden by Script, pass them from the constructor of Script so its subscriptions follow its overrides.
+    // A script that overrides none of them gets an empty list, which subscribes it to every hook
+    template<class Script>
+    static std::vector<uint16> GetOverriddenHooks();
 
 public:
     virtual void OnPlayerReleasedGhost(Player* /*player*/) { }
@@ -2049,6 +2295,10 @@ public: /* SpellScriptLoader */
     void CreateAuraScripts(uint32 spellId, std::list<AuraScript*>& scriptVector);
     void CreateSpellScriptLoaders(uint32 spellId, std::vector<std::pair<SpellScriptLoader*, std::multimap<uint32, uint32>::iterator> >& scriptVector);
 
+    // Keeps the scripts registered and validated at startup, later instances of the same script and spell share their hooks
+    void AddSpellScriptHooks(uint32 spellId, uint32 scriptId, SpellScript* spellScript, AuraScript* auraScript);
+    void UnloadSpellScriptHooks();
+
 public: /* ServerScript */
     void OnNetworkStart();
     void OnNetworkStop();
@@ -2385,7 +2635,7 @@ public: /* GlobalScript */
     void OnAfterRefCount(Player const* player, Loot& loot, bool canRate, uint16 lootMode, LootStoreItem* LootStoreItem, uint32& maxcount, LootStore const& store);
     void OnBeforeDropAddItem(Player const* player, Loot& loot, bool canRate, uint16 lootMode, LootStoreItem* LootStoreItem, LootStore const& store);
     bool OnItemRoll(Player const* player, LootStoreItem const* LootStoreItem, float& chance, Loot& loot, LootStore const& store);
-    bool OnBeforeLootEqualChanced(Player const* player, LootStoreItemList EqualChanced, Loot& loot, LootStore const& store);
+    bool OnBeforeLootEqualChanced(Player const* player, LootStoreItemList const& EqualChanced, Loot& loot, LootStore const& store);
     void OnInitializeLockedDungeons(Player* player, uint8& level, uint32& lockData, lfg::LFGDungeonData const* dungeon);
     void OnAfterInitializeLockedDungeons(Player* player);
     void OnAfterUpdateEncounterState(Map* map, EncounterCreditType type, uint32 creditEntry, Unit* source, Difficulty difficulty_fixed, DungeonEncounterList const* encounters, uint32 dungeonCompleted, bool updated);
@@ -2548,6 +2798,10 @@ private:
 
     ScriptLoaderCallbackType _script_loader_callback;
     ModulesLoaderCallbackType _modules_loader_callback;
+
+    // key is spell id << 32 | script id
+    std::unordered_map<uint64, SpellScript*> _spellScriptHooks;
+    std::unordered_map<uint64, AuraScript*> _auraScriptHooks;
 };
 
 namespace Warhead::SpellScripts
@@ -2641,6 +2895,296 @@ template <class AI, AI* (*AIFactory)(GameObject*)> class FactoryGameObjectScript
 
 #define sScriptMgr ScriptMgr::instance()
 
+// Number of hooks of a script type dispatched through per hook subscriber lists (ScriptRegistry::EnabledHooks).
+// Script types without a hook enum keep calling every registered script.
+template<class TScript> struct ScriptHookCount : std::integral_constant<uint16, 0> { };
+template<> struct ScriptHookCount<UnitScript> : std::integral_constant<uint16, UNITHOOK_END> { };
+template<> struct ScriptHookCount<AllMapScript> : std::integral_constant<uint16, ALLMAPHOOK_END> { };
+template<> struct ScriptHookCount<AllCreatureScript> : std::integral_constant<uint16, ALLCREATUREHOOK_END> { };
+template<> struct ScriptHookCount<AllGameObjectScript> : std::integral_constant<uint16, ALLGAMEOBJECTHOOK_END> { };
+template<> struct ScriptHookCount<PlayerScript> : std::integral_constant<uint16, PLAYERHOOK_END> { };
+
+// Hook, method and signature of every hook dispatched through ScriptRegistry::EnabledHooks. Overloaded methods
+// are listed once per overload. Used by GetOverriddenHooks() to derive the subscriptions of a script.
+
+#define WH_UNIT_SCRIPT_HOOKS(HOOK) \
+    HOOK(UNITHOOK_ON_HEAL, OnHeal, void(Unit*, Unit*, uint32&)) \
+    HOOK(UNITHOOK_ON_DAMAGE, OnDamage, void(Unit*, Unit*, uint32&)) \
+    HOOK(UNITHOOK_MODIFY_PERIODIC_DAMAGE_AURAS_TICK, ModifyPeriodicDamageAurasTick, void(Unit*, Unit*, uint32&)) \
+    HOOK(UNITHOOK_MODIFY_MELEE_DAMAGE, ModifyMeleeDamage, void(Unit*, Unit*, uint32&)) \
+    HOOK(UNITHOOK_MODIFY_SPELL_DAMAGE_TAKEN, ModifySpellDamageTaken, void(Unit*, Unit*, int32&)) \
+    HOOK(UNITHOOK_MODIFY_HEAL_RECIEVED, ModifyHealRecieved, void(Unit*, Unit*, uint32&)) \
+    HOOK(UNITHOOK_DEAL_DAMAGE, DealDamage, uint32(Unit*, Unit*, uint32, DamageEffectType)) \
+    HOOK(UNITHOOK_ON_BEFORE_ROLL_MELEE_OUTCOME_AGAINST, OnBeforeRollMeleeOutcomeAgainst, void(Unit const*, Unit const*, WeaponAttackType, int32&, int32&, int32&, int32&, int32&, int32&, int32&, int32&, int32&)) \
+    HOOK(UNITHOOK_ON_AURA_REMOVE, OnAuraRemove, void(Unit*, AuraApplication*, AuraRemoveMode)) \
+    HOOK(UNITHOOK_IF_NORMAL_REACTION, IfNormalReaction, bool(Unit const*, Unit const*, ReputationRank&)) \
+    HOOK(UNITHOOK_IS_NEED_MOD_SPELL_DAMAGE_PERCENT, IsNeedModSpellDamagePercent, bool(Unit const*, AuraEffect*, float&, SpellInfo const*)) \
+    HOOK(UNITHOOK_IS_NEED_MOD_MELEE_DAMAGE_PERCENT, IsNeedModMeleeDamagePercent, bool(Unit const*, AuraEffect*, float&, SpellInfo const*)) \
+    HOOK(UNITHOOK_IS_NEED_MOD_HEAL_PERCENT, IsNeedModHealPercent, bool(Unit const*, AuraEffect*, float&, SpellInfo const*)) \
+    HOOK(UNITHOOK_CAN_SET_PHASE_MASK, CanSetPhaseMask, bool(Unit const*, uint32, bool)) \
+    HOOK(UNITHOOK_IS_CUSTOM_BUILD_VALUES_UPDATE, IsCustomBuildValuesUpdate, bool(Unit const*, uint8, ByteBuffer&, Player const*, uint16)) \
+    HOOK(UNITHOOK_ON_BUILD_VALUES_UPDATE, OnBuildValuesUpdate, bool(Unit const*, uint8, ByteBuffer&, Player*, uint16)) \
+    HOOK(UNITHOOK_ON_UNIT_UPDATE, OnUnitUpdate, void(Unit*, uint32))
+
+#define WH_ALL_MAP_SCRIPT_HOOKS(HOOK) \
+    HOOK(ALLMAPHOOK_ON_PLAYER_ENTER_ALL, OnPlayerEnterAll, void(Map*, Player*)) \
+    HOOK(ALLMAPHOOK_ON_PLAYER_LEAVE_ALL, OnPlayerLeaveAll, void(Map*, Player*)) \
+    HOOK(ALLMAPHOOK_ON_BEFORE_CREATE_INSTANCE_SCRIPT, OnBeforeCreateInstanceScript, void(InstanceMap*, InstanceScript*, bool, std::string, uint32)) \
+    HOOK(ALLMAPHOOK_ON_DESTROY_INSTANCE, OnDestroyInstance, void(MapInstanced*, Map*)) \
+    HOOK(ALLMAPHOOK_ON_CREATE_MAP, OnCreateMap, void(Map*)) \
+    HOOK(ALLMAPHOOK_ON_DESTROY_MAP, OnDestroyMap, void(Map*)) \
+    HOOK(ALLMAPHOOK_ON_MAP_UPDATE, OnMapUpdate, void(Map*, uint32))
+
+#define WH_ALL_CREATURE_SCRIPT_HOOKS(HOOK) \
+    HOOK(ALLCREATUREHOOK_ON_ALL_CREATURE_UPDATE, OnAllCreatureUpdate, void(Creature*, uint32)) \
+    HOOK(ALLCREATUREHOOK_CREATURE_SELECT_LEVEL, Creature_SelectLevel, void(const CreatureTemplate*, Creature*)) \
+    HOOK(ALLCREATUREHOOK_ON_CREATURE_ADD_WORLD, OnCreatureAddWorld, void(Creature*)) \
+    HOOK(ALLCREATUREHOOK_ON_CREATURE_REMOVE_WORLD, OnCreatureRemoveWorld, void(Creature*)) \
+    HOOK(ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_HELLO, CanCreatureGossipHello, bool(Player*, Creature*)) \
+    HOOK(ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_SELECT, CanCreatureGossipSelect, bool(Player*, Creature*, uint32, uint32)) \
+    HOOK(ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_SELECT_CODE, CanCreatureGossipSelectCode, bool(Player*, Creature*, uint32, uint32, const char*)) \
+    HOOK(ALLCREATUREHOOK_CAN_CREATURE_QUEST_ACCEPT, CanCreatureQuestAccept, bool(Player*, Creature*, Quest const*)) \
+    HOOK(ALLCREATUREHOOK_CAN_CREATURE_QUEST_REWARD, CanCreatureQuestReward, bool(Player*, Creature*, Quest const*, uint32)) \
+    HOOK(ALLCREATUREHOOK_GET_CREATURE_AI, GetCreatureAI, CreatureAI*(Creature*) const) \
+    HOOK(ALLCREATUREHOOK_CAN_CREATURE_SEND_LIST_INVENTORY, CanCreatureSendListInventory, bool(Player*, Creature*, uint32))
+
+#define WH_ALL_GAME_OBJECT_SCRIPT_HOOKS(HOOK) \
+    HOOK(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_ADD_WORLD, OnGameObjectAddWorld, void(GameObject*)) \
+    HOOK(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_REMOVE_WORLD, OnGameObjectRemoveWorld, void(GameObject*)) \
+    HOOK(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_UPDATE, OnGameObjectUpdate, void(GameObject*, uint32)) \
+    HOOK(ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_GOSSIP_HELLO, CanGameObjectGossipHello, bool(Player*, GameObject*)) \
+    HOOK(ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_GOSSIP_SELECT, CanGameObjectGossipSelect, bool(Player*, GameObject*, uint32, uint32)) \
+    HOOK(ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_GOSSIP_SELECT_CODE, CanGameObjectGossipSelectCode, bool(Player*, GameObject*, uint32, uint32, const char*)) \
+    HOOK(ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_QUEST_ACCEPT, CanGameObjectQuestAccept, bool(Player*, GameObject*, Quest const*)) \
+    HOOK(ALLGAMEOBJECTHOOK_CAN_GAME_OBJECT_QUEST_REWARD, CanGameObjectQuestReward, bool(Player*, GameObject*, Quest const*, uint32)) \
+    HOOK(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_DESTROYED, OnGameObjectDestroyed, void(GameObject*, Player*)) \
+    HOOK(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_DAMAGED, OnGameObjectDamaged, void(GameObject*, Player*)) \
+    HOOK(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_LOOT_STATE_CHANGED, OnGameObjectLootStateChanged, void(GameObject*, uint32, Unit*)) \
+    HOOK(ALLGAMEOBJECTHOOK_ON_GAME_OBJECT_STATE_CHANGED, OnGameObjectStateChanged, void(GameObject*, uint32)) \
+    HOOK(ALLGAMEOBJECTHOOK_GET_GAME_OBJECT_AI, GetGameObjectAI, GameObjectAI*(GameObject*) const)
+
+#define WH_PLAYER_SCRIPT_HOOKS(HOOK) \
+    HOOK(PLAYERHOOK_ON_PLAYER_RELEASED_GHOST, OnPlayerReleasedGhost, void(Player*)) \
+    HOOK(PLAYERHOOK_ON_SEND_INITIAL_PACKETS_BEFORE_ADD_TO_MAP, OnSendInitialPacketsBeforeAddToMap, void(Player*, WorldPacket&)) \
+    HOOK(PLAYERHOOK_ON_BATTLEGROUND_DESERTION, OnBattlegroundDesertion, void(Player*, BattlegroundDesertionType)) \
+    HOOK(PLAYERHOOK_ON_PLAYER_COMPLETE_QUEST, OnPlayerCompleteQuest, void(Player*, Quest const*)) \
+    HOOK(PLAYERHOOK_ON_PVP_KILL, OnPVPKill, void(Player*, Player*)) \
+    HOOK(PLAYERHOOK_ON_PLAYER_PVP_FLAG_CHANGE, OnPlayerPVPFlagChange, void(Player*, bool)) \
+    HOOK(PLAYERHOOK_ON_CREATURE_KILL, OnCreatureKill, void(Player*, Creature*)) \
+    HOOK(PLAYERHOOK_ON_CREATURE_KILLED_BY_PET, OnCreatureKilledByPet, void(Player*, Creature*)) \
+    HOOK(PLAYERHOOK_ON_PLAYER_KILLED_BY_CREATURE, OnPlayerKilledByCreature, void(Creature*, Player*)) \
+    HOOK(PLAYERHOOK_ON_LEVEL_CHANGED, OnLevelChanged, void(Player*, uint8)) \
+    HOOK(PLAYERHOOK_ON_FREE_TALENT_POINTS_CHANGED, OnFreeTalentPointsChanged, void(Player*, uint32)) \
+    HOOK(PLAYERHOOK_ON_TALENTS_RESET, OnTalentsReset, void(Player*, bool)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_UPDATE, OnBeforeUpdate, void(Player*, uint32)) \
+    HOOK(PLAYERHOOK_ON_UPDATE, OnUpdate, void(Player*, uint32)) \
+    HOOK(PLAYERHOOK_ON_MONEY_CHANGED, OnMoneyChanged, void(Player*, int32&)) \
+    HOOK(PLAYERHOOK_ON_GIVE_XP, OnGiveXP, void(Player*, uint32&, Unit*)) \
+    HOOK(PLAYERHOOK_ON_REPUTATION_CHANGE, OnReputationChange, bool(Player*, uint32, int32&, bool)) \
+    HOOK(PLAYERHOOK_ON_REPUTATION_RANK_CHANGE, OnReputationRankChange, void(Player*, uint32, ReputationRank, ReputationRank, bool)) \
+    HOOK(PLAYERHOOK_ON_LEARN_SPELL, OnLearnSpell, void(Player*, uint32)) \
+    HOOK(PLAYERHOOK_ON_FORGOT_SPELL, OnForgotSpell, void(Player*, uint32)) \
+    HOOK(PLAYERHOOK_ON_DUEL_REQUEST, OnDuelRequest, void(Player*, Player*)) \
+    HOOK(PLAYERHOOK_ON_DUEL_START, OnDuelStart, void(Player*, Player*)) \
+    HOOK(PLAYERHOOK_ON_DUEL_END, OnDuelEnd, void(Player*, Player*, DuelCompleteType)) \
+    HOOK(PLAYERHOOK_ON_CHAT, OnChat, void(Player*, uint32, uint32, std::string&)) \
+    HOOK(PLAYERHOOK_ON_CHAT, OnChat, void(Player*, uint32, uint32, std::string&, Player*)) \
+    HOOK(PLAYERHOOK_ON_CHAT, OnChat, void(Player*, uint32, uint32, std::string&, Group*)) \
+    HOOK(PLAYERHOOK_ON_CHAT, OnChat, void(Player*, uint32, uint32, std::string&, Guild*)) \
+    HOOK(PLAYERHOOK_ON_CHAT, OnChat, void(Player*, uint32, uint32, std::string&, Channel*)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_SEND_CHAT_MESSAGE, OnBeforeSendChatMessage, void(Player*, uint32&, uint32&, std::string&)) \
+    HOOK(PLAYERHOOK_ON_EMOTE, OnEmote, void(Player*, uint32)) \
+    HOOK(PLAYERHOOK_ON_TEXT_EMOTE, OnTextEmote, void(Player*, uint32, uint32, ObjectGuid)) \
+    HOOK(PLAYERHOOK_ON_SPELL_CAST, OnSpellCast, void(Player*, Spell*, bool)) \
+    HOOK(PLAYERHOOK_ON_LOAD_FROM_DB, OnLoadFromDB, void(Player*)) \
+    HOOK(PLAYERHOOK_ON_LOGIN, OnLogin, void(Player*)) \
+    HOOK(PLAYERHOOK_ON_LOGOUT, OnLogout, void(Player*)) \
+    HOOK(PLAYERHOOK_ON_CREATE, OnCreate, void(Player*)) \
+    HOOK(PLAYERHOOK_ON_DELETE, OnDelete, void(ObjectGuid, uint32)) \
+    HOOK(PLAYERHOOK_ON_FAILED_DELETE, OnFailedDelete, void(ObjectGuid, uint32)) \
+    HOOK(PLAYERHOOK_ON_SAVE, OnSave, void(Player*)) \
+    HOOK(PLAYERHOOK_ON_BIND_TO_INSTANCE, OnBindToInstance, void(Player*, Difficulty, uint32, bool)) \
+    HOOK(PLAYERHOOK_ON_UPDATE_ZONE, OnUpdateZone, void(Player*, uint32, uint32)) \
+    HOOK(PLAYERHOOK_ON_UPDATE_AREA, OnUpdateArea, void(Player*, uint32, uint32)) \
+    HOOK(PLAYERHOOK_ON_MAP_CHANGED, OnMapChanged, void(Player*)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_TELEPORT, OnBeforeTeleport, bool(Player*, uint32, float, float, float, float, uint32, Unit*)) \
+    HOOK(PLAYERHOOK_ON_UPDATE_FACTION, OnUpdateFaction, void(Player*)) \
+    HOOK(PLAYERHOOK_ON_ADD_TO_BATTLEGROUND, OnAddToBattleground, void(Player*, Battleground*)) \
+    HOOK(PLAYERHOOK_ON_QUEUE_RANDOM_DUNGEON, OnQueueRandomDungeon, void(Player*, uint32&)) \
+    HOOK(PLAYERHOOK_ON_REMOVE_FROM_BATTLEGROUND, OnRemoveFromBattleground, void(Player*, Battleground*)) \
+    HOOK(PLAYERHOOK_ON_ACHI_COMPLETE, OnAchiComplete, void(Player*, AchievementEntry const*)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_ACHI_COMPLETE, OnBeforeAchiComplete, bool(Player*, AchievementEntry const*)) \
+    HOOK(PLAYERHOOK_ON_CRITERIA_PROGRESS, OnCriteriaProgress, void(Player*, AchievementCriteriaEntry const*)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_CRITERIA_PROGRESS, OnBeforeCriteriaProgress, bool(Player*, AchievementCriteriaEntry const*)) \
+    HOOK(PLAYERHOOK_ON_ACHI_SAVE, OnAchiSave, void(CharacterDatabaseTransaction, Player*, uint16, CompletedAchievementData)) \
+    HOOK(PLAYERHOOK_ON_CRITERIA_SAVE, OnCriteriaSave, void(CharacterDatabaseTransaction, Player*, uint16, CriteriaProgress)) \
+    HOOK(PLAYERHOOK_ON_GOSSIP_SELECT, OnGossipSelect, void(Player*, uint32, uint32, uint32)) \
+    HOOK(PLAYERHOOK_ON_GOSSIP_SELECT_CODE, OnGossipSelectCode, void(Player*, uint32, uint32, uint32, const char*)) \
+    HOOK(PLAYERHOOK_ON_BEING_CHARMED, OnBeingCharmed, void(Player*, Unit*, uint32, uint32)) \
+    HOOK(PLAYERHOOK_ON_AFTER_SET_VISIBLE_ITEM_SLOT, OnAfterSetVisibleItemSlot, void(Player*, uint8, Item*)) \
+    HOOK(PLAYERHOOK_ON_AFTER_MOVE_ITEM_FROM_INVENTORY, OnAfterMoveItemFromInventory, void(Player*, Item*, uint8, uint8, bool)) \
+    HOOK(PLAYERHOOK_ON_EQUIP, OnEquip, void(Player*, Item*, uint8, uint8, bool)) \
+    HOOK(PLAYERHOOK_ON_PLAYER_JOIN_BG, OnPlayerJoinBG, void(Player*)) \
+    HOOK(PLAYERHOOK_ON_PLAYER_JOIN_ARENA, OnPlayerJoinArena, void(Player*)) \
+    HOOK(PLAYERHOOK_GET_CUSTOM_GET_ARENA_TEAM_ID, GetCustomGetArenaTeamId, void(Player const*, uint8, uint32&) const) \
+    HOOK(PLAYERHOOK_GET_CUSTOM_ARENA_PERSONAL_RATING, GetCustomArenaPersonalRating, void(Player const*, uint8, uint32&) const) \
+    HOOK(PLAYERHOOK_ON_GET_MAX_PERSONAL_ARENA_RATING_REQUIREMENT, OnGetMaxPersonalArenaRatingRequirement, void(Player const*, uint32, uint32&) const) \
+    HOOK(PLAYERHOOK_ON_LOOT_ITEM, OnLootItem, void(Player*, Item*, uint32, ObjectGuid)) \
+    HOOK(PLAYERHOOK_ON_CREATE_ITEM, OnCreateItem, void(Player*, Item*, uint32)) \
+    HOOK(PLAYERHOOK_ON_QUEST_REWARD_ITEM, OnQuestRewardItem, void(Player*, Item*, uint32)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_QUEST_COMPLETE, OnBeforeQuestComplete, bool(Player*, uint32)) \
+    HOOK(PLAYERHOOK_ON_QUEST_COMPUTE_XP, OnQuestComputeXP, void(Player*, Quest const*, uint32&)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_DURABILITY_REPAIR, OnBeforeDurabilityRepair, void(Player*, ObjectGuid, ObjectGuid, float&, uint8)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_BUY_ITEM_FROM_VENDOR, OnBeforeBuyItemFromVendor, void(Player*, ObjectGuid, uint32, uint32&, uint8, uint8, uint8)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_STORE_OR_EQUIP_NEW_ITEM, OnBeforeStoreOrEquipNewItem, void(Player*, uint32, uint32&, uint8, uint8, uint8, ItemTemplate const*, Creature*, VendorItem const*, bool)) \
+    HOOK(PLAYERHOOK_ON_AFTER_STORE_OR_EQUIP_NEW_ITEM, OnAfterStoreOrEquipNewItem, void(Player*, uint32, Item*, uint8, uint8, uint8, ItemTemplate const*, Creature*, VendorItem const*, bool)) \
+    HOOK(PLAYERHOOK_ON_AFTER_UPDATE_MAX_POWER, OnAfterUpdateMaxPower, void(Player*, Powers&, float&)) \
+    HOOK(PLAYERHOOK_ON_AFTER_UPDATE_MAX_HEALTH, OnAfterUpdateMaxHealth, void(Player*, float&)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_UPDATE_ATTACK_POWER_AND_DAMAGE, OnBeforeUpdateAttackPowerAndDamage, void(Player*, float&, float&, bool)) \
+    HOOK(PLAYERHOOK_ON_AFTER_UPDATE_ATTACK_POWER_AND_DAMAGE, OnAfterUpdateAttackPowerAndDamage, void(Player*, float&, float&, float&, float&, bool)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_INIT_TALENT_FOR_LEVEL, OnBeforeInitTalentForLevel, void(Player*, uint8&, uint32&)) \
+    HOOK(PLAYERHOOK_ON_FIRST_LOGIN, OnFirstLogin, void(Player*)) \
+    HOOK(PLAYERHOOK_CAN_JOIN_IN_BATTLEGROUND_QUEUE, CanJoinInBattlegroundQueue, bool(Player*, ObjectGuid, BattlegroundTypeId, uint8, GroupJoinBattlegroundResult&)) \
+    HOOK(PLAYERHOOK_SHOULD_BE_REWARDED_WITH_MONEY_INSTEAD_OF_EXP, ShouldBeRewardedWithMoneyInsteadOfExp, bool(Player*)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_TEMP_SUMMON_INIT_STATS, OnBeforeTempSummonInitStats, void(Player*, TempSummon*, uint32&)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_GUARDIAN_INIT_STATS_FOR_LEVEL, OnBeforeGuardianInitStatsForLevel, void(Player*, Guardian*, CreatureTemplate const*, PetType&)) \
+    HOOK(PLAYERHOOK_ON_AFTER_GUARDIAN_INIT_STATS_FOR_LEVEL, OnAfterGuardianInitStatsForLevel, void(Player*, Guardian*)) \
+    HOOK(PLAYERHOOK_ON_BEFORE_LOAD_PET_FROM_DB, OnBeforeLoadPetFromDB, void(Player*, uint32&, uint32&, bool&, bool&)) \
+    HOOK(PLAYERHOOK_CAN_JOIN_IN_ARENA_QUEUE, CanJoinInArenaQueue, bool(Player*, ObjectGuid, uint8, BattlegroundTypeId, uint8, uint8, GroupJoinBattlegroundResult&)) \
+    HOOK(PLAYERHOOK_CAN_BATTLE_FIELD_PORT, CanBattleFieldPort, bool(Player*, uint8, BattlegroundTypeId, uint8)) \
+    HOOK(PLAYERHOOK_CAN_GROUP_INVITE, CanGroupInvite, bool(Player*, std::string&)) \
+    HOOK(PLAYERHOOK_CAN_GROUP_ACCEPT, CanGroupAccept, bool(Player*, Group*)) \
+    HOOK(PLAYERHOOK_CAN_SELL_ITEM, CanSellItem, bool(Player*, Item*, Creature*)) \
+    HOOK(PLAYERHOOK_CAN_SEND_MAIL, CanSendMail, bool(Player*, ObjectGuid, ObjectGuid, std::string&, std::string&, uint32, uint32, Item*)) \
+    HOOK(PLAYERHOOK_PETITION_BUY, PetitionBuy, void(Player*, Creature*, uint32&, uint32&, uint32&)) \
+    HOOK(PLAYERHOOK_PETITION_SHOW_LIST, PetitionShowList, void(Player*, Creature*, uint32&, uint32&, uint32&)) \
+    HOOK(PLAYERHOOK_ON_REWARD_KILL_REWARDER, OnRewardKillRewarder, void(Player*, bool, float&)) \
+    HOOK(PLAYERHOOK_CAN_GIVE_MAIL_REWARD_AT_GIVE_LEVEL, CanGiveMailRewardAtGiveLevel, bool(Player*, uint8)) \
+    HOOK(PLAYERHOOK_ON_DELETE_FROM_DB, OnDeleteFromDB, void(CharacterDatabaseTransaction, uint32)) \
+    HOOK(PLAYERHOOK_CAN_REPOP_AT_GRAVEYARD, CanRepopAtGraveyard, bool(Player*)) \
+    HOOK(PLAYERHOOK_ON_GET_MAX_SKILL_VALUE, OnGetMaxSkillValue, void(Player*, uint32, int32&, bool)) \
+    HOOK(PLAYERHOOK_CAN_AREA_EXPLORE_AND_OUTDOOR, CanAreaExploreAndOutdoor, bool(Player*)) \
+    HOOK(PLAYERHOOK_ON_VICTIM_REWARD_BEFORE, OnVictimRewardBefore, void(Player*, Player*, uint32&, uint32&)) \
+    HOOK(PLAYERHOOK_ON_VICTIM_REWARD_AFTER, OnVictimRewardAfter, void(Player*, Player*, uint32&, uint32&, float&)) \
+    HOOK(PLAYERHOOK_ON_CUSTOM_SCALING_STAT_VALUE_BEFORE, OnCustomScalingStatValueBefore, void(Player*, ItemTemplate const*, uint8, bool, uint32&)) \
+    HOOK(PLAYERHOOK_ON_CUSTOM_SCALING_STAT_VALUE, OnCustomScalingStatValue, void(Player*, ItemTemplate const*, uint32&, int32&, uint8, uint32, ScalingStatValuesEntry const*)) \
+    HOOK(PLAYERHOOK_CAN_ARMOR_DAMAGE_MODIFIER, CanArmorDamageModifier, bool(Player*)) \
+    HOOK(PLAYERHOOK_ON_GET_FERAL_AP_BONUS, OnGetFeralApBonus, void(Player*, int32&, int32, ItemTemplate const*, ScalingStatValuesEntry const*)) \
+    HOOK(PLAYERHOOK_CAN_APPLY_WEAPON_DEPENDENT_AURA_DAMAGE_MOD, CanApplyWeaponDependentAuraDamageMod, bool(Player*, Item*, WeaponAttackType, AuraEffect const*, bool)) \
+    HOOK(PLAYERHOOK_CAN_APPLY_EQUIP_SPELL, CanApplyEquipSpell, bool(Player*, SpellInfo const*, Item*, bool, bool)) \
+    HOOK(PLAYERHOOK_CAN_APPLY_EQUIP_SPELLS_ITEM_SET, CanApplyEquipSpellsItemSet, bool(Player*, ItemSetEffect*)) \
+    HOOK(PLAYERHOOK_CAN_CAST_ITEM_COMBAT_SPELL, CanCastItemCombatSpell, bool(Player*, Unit*, WeaponAttackType, uint32, uint32, Item*, ItemTemplate const*)) \
+    HOOK(PLAYERHOOK_CAN_CAST_ITEM_USE_SPELL, CanCastItemUseSpell, bool(Player*, Item*, SpellCastTargets const&, uint8, uint32)) \
+    HOOK(PLAYERHOOK_ON_APPLY_AMMO_BONUSES, OnApplyAmmoBonuses, void(Player*, ItemTemplate const*, float&)) \
+    HOOK(PLAYERHOOK_CAN_EQUIP_ITEM, CanEquipItem, bool(Player*, uint8, uint16&, Item*, bool, bool)) \
+    HOOK(PLAYERHOOK_CAN_UNEQUIP_ITEM, CanUnequipItem, bool(Player*, uint16, bool)) \
+    HOOK(PLAYERHOOK_CAN_USE_ITEM, CanUseItem, bool(Player*, ItemTemplate const*, InventoryResult&)) \
+    HOOK(PLAYERHOOK_CAN_SAVE_EQUIP_NEW_ITEM, CanSaveEquipNewItem, bool(Player*, Item*, uint16, bool)) \
+    HOOK(PLAYERHOOK_CAN_APPLY_ENCHANTMENT, CanApplyEnchantment, bool(Player*, Item*, EnchantmentSlot, bool, bool, bool)) \
+    HOOK(PLAYERHOOK_ON_GET_QUEST_RATE, OnGetQuestRate, void(Player*, float&)) \
+    HOOK(PLAYERHOOK_PASSED_QUEST_KILLED_MONSTER_CREDIT, PassedQuestKilledMonsterCredit, bool(Player*, Quest const*, uint32, uint32, ObjectGuid)) \
+    HOOK(PLAYERHOOK_CHECK_ITEM_IN_SLOT_AT_LOAD_INVENTORY, CheckItemInSlotAtLoadInventory, bool(Player*, Item*, uint8, uint8&, uint16&)) \
+    HOOK(PLAYERHOOK_NOT_AVOID_SATISFY, NotAvoidSatisfy, bool(Player*, DungeonProgressionRequirements const*, uint32, bool)) \
+    HOOK(PLAYERHOOK_NOT_VISIBLE_GLOBALLY_FOR, NotVisibleGloballyFor, bool(Player*, Player const*)) \
+    HOOK(PLAYERHOOK_ON_GET_ARENA_PERSONAL_RATING, OnGetArenaPersonalRating, void(Player*, uint8, uint32&)) \
+    HOOK(PLAYERHOOK_ON_GET_ARENA_TEAM_ID, OnGetArenaTeamId, void(Player*, uint8, uint32&)) \
+    HOOK(PLAYERHOOK_ON_IS_FFA_PVP, OnIsFFAPvP, void(Player*, bool&)) \
+    HOOK(PLAYERHOOK_ON_IS_PVP, OnIsPvP, void(Player*, bool&)) \
+    HOOK(PLAYERHOOK_ON_GET_MAX_SKILL_VALUE_FOR_LEVEL, OnGetMaxSkillValueForLevel, void(Player*, uint16&)) \
+    HOOK(PLAYERHOOK_NOT_SET_ARENA_TEAM_INFO_FIELD, NotSetArenaTeamInfoField, bool(Player*, uint8, ArenaTeamInfoType, uint32)) \
+    HOOK(PLAYERHOOK_CAN_JOIN_LFG, CanJoinLfg, bool(Player*, uint8, lfg::LfgDungeonSet&, const std::string&)) \
+    HOOK(PLAYERHOOK_CAN_ENTER_MAP, CanEnterMap, bool(Player*, MapEntry const*, InstanceTemplate const*, MapDifficulty const*, bool)) \
+    HOOK(PLAYERHOOK_CAN_INIT_TRADE, CanInitTrade, bool(Player*, Player*)) \
+    HOOK(PLAYERHOOK_ON_SET_SERVER_SIDE_VISIBILITY, OnSetServerSideVisibility, void(Player*, ServerSideVisibilityType&, AccountTypes&)) \
+    HOOK(PLAYERHOOK_ON_SET_SERVER_SIDE_VISIBILITY_DETECT, OnSetServerSideVisibilityDetect, void(Player*, ServerSideVisibilityType&, AccountTypes&)) \
+    HOOK(PLAYERHOOK_ON_GIVE_HONOR_POINTS, OnGiveHonorPoints, void(Player*, float&, Unit*)) \
+    HOOK(PLAYERHOOK_ON_AFTER_RESURRECT, OnAfterResurrect, void(Player*, float, bool)) \
+    HOOK(PLAYERHOOK_ON_PLAYER_RESURRECT, OnPlayerResurrect, void(Player*, float, bool)) \
+    HOOK(PLAYERHOOK_CAN_PLAYER_USE_CHAT, CanPlayerUseChat, bool(Player*, uint32, uint32, std::string&)) \
+    HOOK(PLAYERHOOK_CAN_PLAYER_USE_CHAT, CanPlayerUseChat, bool(Player*, uint32, uint32, std::string&, Player*)) \
+    HOOK(PLAYERHOOK_CAN_PLAYER_USE_CHAT, CanPlayerUseChat, bool(Player*, uint32, uint32, std::string&, Group*)) \
+    HOOK(PLAYERHOOK_CAN_PLAYER_USE_CHAT, CanPlayerUseChat, bool(Player*, uint32, uint32, std::string&, Guild*)) \
+    HOOK(PLAYERHOOK_CAN_PLAYER_USE_CHAT, CanPlayerUseChat, bool(Player*, uint32, uint32, std::string&, Channel*)) \
+    HOOK(PLAYERHOOK_ON_PLAYER_LEARN_TALENTS, OnPlayerLearnTalents, void(Player*, uint32, uint32, uint32)) \
+    HOOK(PLAYERHOOK_ON_PLAYER_ENTER_COMBAT, OnPlayerEnterCombat, void(Player*, Unit*)) \
+    HOOK(PLAYERHOOK_ON_PLAYER_LEAVE_COMBAT, OnPlayerLeaveCombat, void(Player*)) \
+    HOOK(PLAYERHOOK_ON_QUEST_ABANDON, OnQuestAbandon, void(Player*, uint32)) \
+    HOOK(PLAYERHOOK_ANTICHEAT_SET_SKIP_ONE_PACKET_FOR_ASH, AnticheatSetSkipOnePacketForASH, void(Player*, bool)) \
+    HOOK(PLAYERHOOK_ANTICHEAT_SET_CAN_FLYBY_SERVER, AnticheatSetCanFlybyServer, void(Player*, bool)) \
+    HOOK(PLAYERHOOK_ANTICHEAT_SET_UNDER_AC_KMOUNT, AnticheatSetUnderACKmount, void(Player*)) \
+    HOOK(PLAYERHOOK_ANTICHEAT_SET_ROOT_ACK_UPD, AnticheatSetRootACKUpd, void(Player*)) \
+    HOOK(PLAYERHOOK_ANTICHEAT_SET_JUMPINGBY_OPCODE, AnticheatSetJumpingbyOpcode, void(Player*, bool)) \
+    HOOK(PLAYERHOOK_ANTICHEAT_UPDATE_MOVEMENT_INFO, AnticheatUpdateMovementInfo, void(Player*, MovementInfo const&)) \
+    HOOK(PLAYERHOOK_ANTICHEAT_HANDLE_DOUBLE_JUMP, AnticheatHandleDoubleJump, bool(Player*, Unit*)) \
+    HOOK(PLAYERHOOK_ANTICHEAT_CHECK_MOVEMENT_INFO, AnticheatCheckMovementInfo, bool(Player*, MovementInfo const&, Unit*, bool))
+
+namespace Warhead::Impl
+{
+    template<class Signature, class Owner>
+    Owner* ScriptHookOwner(Signature Owner::*);
+
+    // False only if the method Script gets for the hook is the default one declared in Base. When Script
+    // declares other overloads of the method, the base one is hidden and the hook counts as overridden.
+    template<class Base, class Script, class OwnerProbe>
+    constexpr bool IsScriptHookOverridden(OwnerProbe)
+    {
+        if constexpr (std::is_invocable_v<OwnerProbe, Script*>)
+            return !std::is_same_v<std::invoke_result_t<OwnerProbe, Script*>, Base*>;
+        else
+            return true;
+    }
+}
+
+#define WH_ADD_SCRIPT_HOOK_IF_OVERRIDDEN(hook, method, ...) \
+    if (Warhead::Impl::IsScriptHookOverridden<Base, Script>([](auto* script) -> decltype(Warhead::Impl::ScriptHookOwner<__VA_ARGS__>(&std::remove_pointer_t<decltype(script)>::method)) { return nullptr; }) && \
+        (hooks.empty() || hooks.back() != hook)) \
+        hooks.push_back(hook);
+
+template<class Script>
+std::vector<uint16> UnitScript::GetOverriddenHooks()
+{
+    using Base = UnitScript;
+    std::vector<uint16> hooks;
+    WH_UNIT_SCRIPT_HOOKS(WH_ADD_SCRIPT_HOOK_IF_OVERRIDDEN)
+    return hooks;
+}
+
+template<class Script>
+std::vector<uint16> AllMapScript::GetOverriddenHooks()
+{
+    using Base = AllMapScript;
+    std::vector<uint16> hooks;
+    WH_ALL_MAP_SCRIPT_HOOKS(WH_ADD_SCRIPT_HOOK_IF_OVERRIDDEN)
+    return hooks;
+}
+
+template<class Script>
+std::vector<uint16> AllCreatureScript::GetOverriddenHooks()
+{
+    using Base = AllCreatureScript;
+    std::vector<uint16> hooks;
+    WH_ALL_CREATURE_SCRIPT_HOOKS(WH_ADD_SCRIPT_HOOK_IF_OVERRIDDEN)
+    return hooks;
+}
+
+template<class Script>
+std::vector<uint16> AllGameObjectScript::GetOverriddenHooks()
+{
+    using Base = AllGameObjectScript;
+    std::vector<uint16> hooks;
+    WH_ALL_GAME_OBJECT_SCRIPT_HOOKS(WH_ADD_SCRIPT_HOOK_IF_OVERRIDDEN)
+    return hooks;
+}
+
+template<class Script>
+std::vector<uint16> PlayerScript::GetOverriddenHooks()
+{
+    using Base = PlayerScript;
+    std::vector<uint16> hooks;
+    WH_PLAYER_SCRIPT_HOOKS(WH_ADD_SCRIPT_HOOK_IF_OVERRIDDEN)
+    return hooks;
+}
+
 template<class TScript>
 class ScriptRegistry
 {
@@ -2656,8 +3200,11 @@ public:
     static ScriptMap ScriptPointerList;
     // After database load scripts
     static ScriptVector ALScripts;
+    // Scripts implementing each hook, in registration order. Same lifetime rules as ScriptPointerList
+    static std::array<ScriptVector, ScriptHookCount<TScript>::value> EnabledHooks;
 
-    static void AddScript(TScript* const script)
+    // enabledHooks lists the hooks the script implements, empty subscribes it to every hook of its type
+    static void AddScript(TScript* const script, std::vector<uint16> const& enabledHooks = {})
     {
         ASSERT(script);
 
@@ -2675,6 +3222,8 @@ public:
             // We're dealing with a code-only script; just add it.
             ScriptPointerList[_scriptIdCounter++] = script;
             sScriptMgr->IncrementScriptCount();
+
+            _addToEnabledHooks(script, enabledHooks);
         }
     }
 
@@ -2774,6 +3323,23 @@ private:
         return true;
     }
 
+    static void _addToEnabledHooks(TScript* const script, std::vector<uint16> const& enabledHooks)
+    {
+        if (enabledHooks.empty())
+        {
+            for (ScriptVector& subscribers : EnabledHooks)
+                subscribers.push_back(script);
+
+            return;
+        }
+
+        for (uint16 hook : enabledHooks)
+        {
+            ASSERT(hook < EnabledHooks.size(), "Script '{}' enables unknown hook {}", script->GetName(), hook);
+            EnabledHooks[hook].push_back(script);
+        }
+    }
+
     // Counter used for code-only scripts.
     static uint32 _scriptIdCounter;
 };
@@ -2781,6 +3347,7 @@ private:
 // Instantiate static members of ScriptRegistry.
 template<class TScript> std::map<uint32, TScript*> ScriptRegistry<TScript>::ScriptPointerList;
 template<class TScript> std::vector<TScript*> ScriptRegistry<TScript>::ALScripts;
+template<class TScript> std::array<std::vector<TScript*>, ScriptHookCount<TScript>::value> ScriptRegistry<TScript>::EnabledHooks;
 template<class TScript> uint32 ScriptRegistry<TScript>::_scriptIdCounter = 0;
 
 #endif
@@ -20,8 +20,8 @@
 
 #include "ScriptMgr.h"
 
-template<typename ScriptName>
-inline Optional<bool> IsValidBoolScript(std::function<bool(ScriptName*)> executeHook)
+template<typename ScriptName, typename Callback>
+inline Optional<bool> IsValidBoolScript(Callback&& executeHook)
 {
     if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
         return {};
@@ -35,8 +35,25 @@ inline Optional<bool> IsValidBoolScript(std::function<bool(ScriptName*)> execute
     return false;
 }
 
-template<typename ScriptName, class T>
-inline T* GetReturnAIScript(std::function<T*(ScriptName*)> executeHook)
+// Same as above but only asks the scripts that enabled the hook
+template<typename ScriptName, typename Callback>
+inline Optional<bool> IsValidBoolScript(uint16 hook, Callback&& executeHook)
+{
+    auto const& subscribers = ScriptRegistry<ScriptName>::EnabledHooks[hook];
+    if (subscribers.empty())
+        return {};
+
+    for (ScriptName* script : subscribers)
+    {
+        if (executeHook(script))
+            return true;
+    }
+
+    return false;
+}
+
+template<typename ScriptName, class T, typename Callback>
+inline T* GetReturnAIScript(Callback&& executeHook)
 {
     if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
         return nullptr;
@@ -52,8 +69,22 @@ inline T* GetReturnAIScript(std::function<T*(ScriptName*)> executeHook)
     return nullptr;
 }
 
-template<typename ScriptName>
-inline void ExecuteScript(std::function<void(ScriptName*)> executeHook)
+template<typename ScriptName, class T, typename Callback>
+inline T* GetReturnAIScript(uint16 hook, Callback&& executeHook)
+{
+    for (ScriptName* script : ScriptRegistry<ScriptName>::EnabledHooks[hook])
+    {
+        if (T* scriptAI = executeHook(script))
+        {
+            return scriptAI;
+        }
+    }
+
+    return nullptr;
+}
+
+template<typename ScriptName, typename Callback>
+inline void ExecuteScript(Callback&& executeHook)
 {
     if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
         return;
@@ -64,6 +95,16 @@ inline void ExecuteScript(std::function<void(ScriptName*)> executeHook)
     }
 }
 
+// Calls the scripts that enabled the hook, a hook nobody implements costs one empty check
+template<typename ScriptName, typename Callback>
+inline void ExecuteScript(uint16 hook, Callback&& executeHook)
+{
+    for (ScriptName* script : ScriptRegistry<ScriptName>::EnabledHooks[hook])
+    {
+        executeHook(script);
+    }
+}
+
 inline bool ReturnValidBool(Optional<bool> ret, bool need = false)
 {
     return ret && *ret ? need : !need;
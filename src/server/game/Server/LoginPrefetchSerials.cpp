@@ -0,0 +1,69 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoginPrefetchSerials.h"
+
+namespace
+{
+    constexpr std::size_t PurgeThreshold = 1024;
+}
+
+uint32 LoginPrefetchSerials::GetSerial() const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _serial;
+}
+
+void LoginPrefetchSerials::Invalidate(ObjectGuid::LowType guid, time_t now, time_t maxAge)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _invalidated[guid] = { ++_serial, now };
+
+    if (_invalidated.size() <= PurgeThreshold)
+        return;
+
+    for (auto itr = _invalidated.begin(); itr != _invalidated.end();)
+    {
+        if (itr->second.second + maxAge < now)
+            itr = _invalidated.erase(itr);
+        else
+            ++itr;
+    }
+}
+
+void LoginPrefetchSerials::InvalidateAll()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _invalidatedAll = ++_serial;
+    _invalidated.clear();
+}
+
+bool LoginPrefetchSerials::IsChanged(ObjectGuid::LowType guid, uint32 serial) const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_invalidatedAll > serial)
+        return true;
+
+    auto itr = _invalidated.find(guid);
+    return itr != _invalidated.end() && itr->second.first > serial;
+}
+
+std::size_t LoginPrefetchSerials::GetSize() const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _invalidated.size();
+}
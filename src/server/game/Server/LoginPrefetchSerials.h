@@ -0,0 +1,51 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LOGIN_PREFETCH_SERIALS_H
+#define _LOGIN_PREFETCH_SERIALS_H
+
+#include "ObjectGuid.h"
+#include <mutex>
+#include <unordered_map>
+
+/*
+ * Tells whether login data prefetched for a character is still current. Every offline change of a
+ * character takes a new serial, a prefetch issued before the last change of its character (or of all
+ * characters) is stale. Thread safe.
+ */
+class WH_GAME_API LoginPrefetchSerials
+{
+public:
+    // Serial to remember when issuing a prefetch
+    [[nodiscard]] uint32 GetSerial() const;
+
+    // Changes older than maxAge are forgotten once enough characters changed, no usable prefetch is that old
+    void Invalidate(ObjectGuid::LowType guid, time_t now, time_t maxAge);
+    void InvalidateAll();
+
+    [[nodiscard]] bool IsChanged(ObjectGuid::LowType guid, uint32 serial) const;
+
+    [[nodiscard]] std::size_t GetSize() const;
+
+private:
+    mutable std::mutex _lock;
+    uint32 _serial{ 0 };
+    uint32 _invalidatedAll{ 0 };
+    std::unordered_map<ObjectGuid::LowType, std::pair<uint32 /*serial*/, time_t /*time*/>> _invalidated;
+};
+
+#endif
@@ -0,0 +1,53 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PacketBudget.h"
+
+void OpcodeCostEstimate::Record(Microseconds cost)
+{
+    uint32 sample = uint32(cost.count());
+    uint32 estimate = _estimate.load(std::memory_order_relaxed);
+    _estimate.store(estimate ? uint32((uint64(estimate) * 7 + sample) / 8) : sample, std::memory_order_relaxed);
+
+    std::size_t bucket = sample < 100 ? 0 : sample < 1000 ? 1 : sample < 10000 ? 2 : 3;
+    _histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+PacketBudget::PacketBudget(Microseconds sessionBudget, Microseconds timeBudget) : _budget(sessionBudget)
+{
+    if (timeBudget > 0us && (_budget == 0us || timeBudget < _budget))
+        _budget = timeBudget;
+}
+
+Microseconds PacketBudget::GetSessionTimeBudget(Microseconds globalBudget, Microseconds used)
+{
+    if (globalBudget == 0us)
+        return 0us;
+
+    if (used < globalBudget)
+        return globalBudget - used;
+
+    return 1us;
+}
+
+bool PacketBudget::Fits(Microseconds used, Microseconds expectedCost, uint32 processedPackets) const
+{
+    if (_budget == 0us || !processedPackets)
+        return true;
+
+    return used + expectedCost <= _budget;
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PACKET_BUDGET_H
+#define _PACKET_BUDGET_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <array>
+#include <atomic>
+
+/*
+ * Processing cost of an opcode, learned from the handled packets. Updated by the world and the map
+ * threads without a lock, a concurrent update only loses one sample.
+ */
+class WH_GAME_API OpcodeCostEstimate
+{
+public:
+    static constexpr std::size_t BucketCount = 4;                // <100us, <1ms, <10ms, >=10ms
+
+    // Moving average with weight 1/8 for the new sample, the first sample is taken as it is
+    void Record(Microseconds cost);
+
+    [[nodiscard]] Microseconds Get() const { return Microseconds(_estimate.load(std::memory_order_relaxed)); }
+
+    // Packets in a cost bucket since the last call
+    uint32 TakeBucketCount(std::size_t bucket) { return _histogram[bucket].exchange(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint32> _estimate{ 0 };                          // microseconds
+    std::array<std::atomic<uint32>, BucketCount> _histogram{};
+};
+
+/*
+ * Time a session may spend on its packets in one update: the PacketProcessing.SessionBudget limit, cut
+ * down to what is left of the world's PacketProcessing.GlobalBudget.
+ */
+class WH_GAME_API PacketBudget
+{
+public:
+    // 0 for either budget is no limit from that side
+    PacketBudget(Microseconds sessionBudget, Microseconds timeBudget);
+
+    // What a session gets once `used` of the global budget is spent: the rest of it, or a single
+    // packet when nothing is left. 0 when there is no global budget
+    static Microseconds GetSessionTimeBudget(Microseconds globalBudget, Microseconds used);
+
+    [[nodiscard]] Microseconds Get() const { return _budget; }
+
+    // Whether the next packet, expected to take expectedCost, is handled now or left for the next update.
+    // The first packet always is, so a session cannot starve
+    [[nodiscard]] bool Fits(Microseconds used, Microseconds expectedCost, uint32 processedPackets) const;
+
+private:
+    Microseconds _budget;
+};
+
+#endif
@@ -40,6 +40,7 @@
 #include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
+#include "PacketBudget.h"
 #include "PacketUtilities.h"
 #include "Pet.h"
 #include "Player.h"
@@ -53,11 +54,62 @@
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSocket.h"
+#include <array>
+#include <cstring>
 #include <zlib.h>
 
 namespace
 {
     std::string const DefaultPlayerName = "<none>";
+
+    GameConfigOption<uint32> const SessionPacketBudget("PacketProcessing.SessionBudget", 10000);
+    GameConfigOption<bool> const CoalesceMovement("Network.CoalesceMovement", false);
+    GameConfigOption<bool> const CombatLogAggregate("Network.CombatLog.Aggregate", false);
+
+    // Processing cost of every opcode, learned from the handled packets
+    std::array<OpcodeCostEstimate, NUM_OPCODE_HANDLERS> OpcodeCosts;
+    std::array<char const*, OpcodeCostEstimate::BucketCount> const OpcodeCostBucketNames = { "<100us", "<1ms", "<10ms", ">=10ms" };
+
+    // size and opcode in front of every server packet
+    constexpr uint32 ServerPacketHeaderSize = 4;
+
+    // Reads target guid, caster guid and spell id in front of the entry count of SMSG_PERIODICAURALOG,
+    // returns their size or 0 if malformed
+    std::size_t ReadPeriodicAuraLogHeader(WorldPacket const& packet, WorldSession::PeriodicAuraLogKey& key)
+    {
+        std::size_t size = 0;
+        for (uint64* guid : { &key.Target, &key.Caster })
+        {
+            if (size >= packet.size())
+                return 0;
+
+            // packed guid: mask byte followed by the non zero bytes
+            uint8 mask = packet.contents()[size++];
+            *guid = 0;
+            for (uint8 i = 0; i < 8; ++i)
+            {
+                if (!(mask & (1 << i)))
+                    continue;
+
+                if (size >= packet.size())
+                    return 0;
+
+                *guid |= uint64(packet.contents()[size++]) << (i * 8);
+            }
+        }
+
+        if (packet.size() < size + 4 + 4)
+            return 0;
+
+        key.SpellId = packet.read<uint32>(size);
+        return size + 4;
+    }
+}
+
+std::size_t WorldSession::PeriodicAuraLogKeyHash::operator()(PeriodicAuraLogKey const& key) const
+{
+    std::hash<uint64> hasher;
+    return hasher(key.Target) ^ (hasher(key.Caster) * 31) ^ (std::size_t(key.SpellId) * 0x9E3779B9);
 }
 
 bool MapSessionFilter::Process(WorldPacket* packet)
@@ -141,6 +193,11 @@ WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldS
     _kicked = false;
     _shouldSetOfflineInDB = true;
 
+    _hasPendingMovement = false;
+    _hasMovementStats = false;
+    _hasPendingCombatLog = false;
+    _packetsDeferred = false;
+
     _timeSyncNextCounter = 0;
     _timeSyncTimer = 0;
 
@@ -157,6 +214,8 @@ WorldSession::~WorldSession()
 {
     sScriptMgr->OnAccountLogout(GetAccountId());
 
+    DiscardLoginPrefetch();
+
     LoginDatabase.Execute("UPDATE account SET totaltime = {} WHERE id = {}", GetTotalTime(), GetAccountId());
 
     ///- unload player if not unloaded
@@ -218,6 +277,16 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     if (!m_Socket)
         return;
 
+    // keep the order of coalesced movement relays relative to everything else
+    if (_hasPendingMovement)
+    {
+        std::lock_guard<std::mutex> lock(_pendingMovementLock);
+        if (!_pendingMovement.empty())
+            ++_movementStats.Interrupted;
+
+        SendPendingMovementPackets();
+    }
+
 #if defined(ENABLE_EXTRAS) && defined(ENABLE_EXTRA_LOGS) && defined(WARHEAD_DEBUG)
     // Code for network use statistic
     static uint64 sendPacketCount = 0;
@@ -263,12 +332,157 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     m_Socket->SendPacket(*packet);
 }
 
+/// Queue a relayed movement packet of another unit until the next flush
+void WorldSession::SendMovementPacket(ObjectGuid moverGuid, WorldPacket const* packet)
+{
+    if (!m_Socket)
+        return;
+
+    std::lock_guard<std::mutex> lock(_pendingMovementLock);
+
+    // Heartbeats and facing/pitch updates only carry the mover state, any newer relay of the same mover replaces them
+    for (auto itr = _pendingMovement.begin(); itr != _pendingMovement.end(); ++itr)
+    {
+        if (itr->Mover != moverGuid)
+            continue;
+
+        uint16 opcode = itr->Packet.GetOpcode();
+        if (opcode == MSG_MOVE_HEARTBEAT || opcode == MSG_MOVE_SET_FACING || opcode == MSG_MOVE_SET_PITCH)
+        {
+            _pendingMovement.erase(itr);
+            ++_movementStats.Merged;
+        }
+
+        break;
+    }
+
+    _pendingMovement.push_back({ moverGuid, *packet });
+    _hasPendingMovement = true;
+    _hasMovementStats = true;
+}
+
+bool WorldSession::IsMovementCoalesced()
+{
+    return CoalesceMovement.Get();
+}
+
+/// Send all queued movement relays, they end up in the same socket write
+WorldSession::MovementFlushStats WorldSession::FlushMovementPackets()
+{
+    if (!_hasMovementStats)
+        return MovementFlushStats();
+
+    // the lock is held while sending so relays queued meanwhile by another thread cannot overtake these
+    std::lock_guard<std::mutex> lock(_pendingMovementLock);
+    _hasMovementStats = false;
+
+    SendPendingMovementPackets();
+
+    MovementFlushStats stats = _movementStats;
+    _movementStats = MovementFlushStats();
+    return stats;
+}
+
+// Must hold _pendingMovementLock
+void WorldSession::SendPendingMovementPackets()
+{
+    _hasPendingMovement = false;
+    _movementStats.Sent += _pendingMovement.size();
+
+    for (PendingMovementPacket const& pending : _pendingMovement)
+        SendPacket(&pending.Packet);
+
+    _pendingMovement.clear();
+}
+
+bool WorldSession::IsCombatLogAggregated()
+{
+    return CombatLogAggregate.Get();
+}
+
+void WorldSession::SendCombatLogPacket(WorldPacket const* packet)
+{
+    if (!m_Socket)
+        return;
+
+    std::lock_guard<std::mutex> lock(_pendingCombatLogLock);
+
+    // several periodic effects of one aura tick in the same update, the log has an entry count for that
+    if (packet->GetOpcode() == SMSG_PERIODICAURALOG)
+    {
+        PeriodicAuraLogKey key;
+        if (std::size_t headerSize = ReadPeriodicAuraLogHeader(*packet, key))
+        {
+            auto [itr, inserted] = _pendingPeriodicAuraLogs.emplace(key, PendingPeriodicAuraLog{ _pendingCombatLog.size(), headerSize });
+            if (!inserted && itr->second.HeaderSize == headerSize)
+            {
+                WorldPacket& pending = _pendingCombatLog[itr->second.Index];
+                pending.put<uint32>(headerSize, pending.read<uint32>(headerSize) + packet->read<uint32>(headerSize));
+                pending.append(packet->contents() + headerSize + 4, packet->size() - headerSize - 4);
+
+                ++_combatLogStats.Merged;
+                _combatLogStats.BytesSaved += headerSize + 4 + ServerPacketHeaderSize;
+                return;
+            }
+        }
+    }
+
+    _pendingCombatLog.push_back(*packet);
+    _hasPendingCombatLog = true;
+}
+
+void WorldSession::SkipCombatLogPacket(WorldPacket const* packet)
+{
+    std::lock_guard<std::mutex> lock(_pendingCombatLogLock);
+    ++_combatLogStats.Trimmed;
+    _combatLogStats.BytesSaved += packet->size() + ServerPacketHeaderSize;
+    _hasPendingCombatLog = true;
+}
+
+WorldSession::CombatLogFlushStats WorldSession::FlushCombatLogPackets()
+{
+    if (!_hasPendingCombatLog)
+        return CombatLogFlushStats();
+
+    std::lock_guard<std::mutex> lock(_pendingCombatLogLock);
+    _hasPendingCombatLog = false;
+
+    CombatLogFlushStats stats = _combatLogStats;
+    stats.Sent = _pendingCombatLog.size();
+    _combatLogStats = CombatLogFlushStats();
+
+    for (WorldPacket const& pending : _pendingCombatLog)
+        SendPacket(&pending);
+
+    _pendingCombatLog.clear();
+    _pendingPeriodicAuraLogs.clear();
+    return stats;
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
     _recvQueue.add(new_packet);
 }
 
+void WorldSession::ReportOpcodeCosts()
+{
+    for (uint16 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+    {
+        OpcodeCostEstimate& entry = OpcodeCosts[opcode];
+        for (std::size_t bucket = 0; bucket < OpcodeCostEstimate::BucketCount; ++bucket)
+        {
+            uint32 count = entry.TakeBucketCount(bucket);
+            if (!count)
+                continue;
+
+            METRIC_VALUE("worldsession_opcode_cost", uint64(count),
+                METRIC_TAG("opcode", opcodeTable[static_cast<OpcodeClient>(opcode)]->Name),
+                METRIC_TAG("bucket", OpcodeCostBucketNames[bucket]));
+        }
+    }
+}
+
 /// Logging helper for unexpected opcodes
 void WorldSession::LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char* reason)
 {
@@ -289,7 +503,7 @@ void WorldSession::LogUnprocessedTail(WorldPacket* packet)
 }
 
 /// Update the WorldSession (triggered by World update)
-bool WorldSession::Update(uint32 diff, PacketFilter& updater)
+bool WorldSession::Update(uint32 diff, PacketFilter& updater, Microseconds timeBudget)
 {
     ///- Before we process anything:
     /// If necessary, kick the player because the client didn't send anything for too long
@@ -298,8 +512,14 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         m_Socket->CloseSocket();
 
     if (updater.ProcessUnsafe())
+    {
         UpdateTimeOutTime(diff);
 
+        // relays left behind by a player that changed map during the last map update
+        FlushMovementPackets();
+        FlushCombatLogPackets();
+    }
+
     HandleTeleportTimeout(updater.ProcessUnsafe());
 
     ///- Retrieve packets from the receive queue and call the appropriate handlers
@@ -312,12 +532,31 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     uint32 processedPackets = 0;
     time_t currentTime = GameTime::GetGameTime().count();
 
+    PacketBudget const budget(Microseconds(SessionPacketBudget.Get()), timeBudget);
+
+    auto const updateStart = std::chrono::steady_clock::now();
+    _packetsDeferred = false;
+
     while (m_Socket && _recvQueue.next(packet, updater))
     {
         OpcodeClient opcode = static_cast<OpcodeClient>(packet->GetOpcode());
         ClientOpcodeHandler const* opHandle = opcodeTable[opcode];
 
+        // Leave the packet for the next update when its expected cost does not fit in the budget anymore.
+        // The first packet is always processed, so a session cannot starve.
+        if (budget.Get() > 0us && processedPackets)
+        {
+            Microseconds used = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - updateStart);
+            if (!budget.Fits(used, OpcodeCosts[opcode].Get(), processedPackets))
+            {
+                requeuePackets.push_back(packet);
+                _packetsDeferred = true;
+                break;
+            }
+        }
+
         METRIC_DETAILED_TIMER("worldsession_update_opcode_time", METRIC_TAG("opcode", opHandle->Name));
+        auto const packetStart = std::chrono::steady_clock::now();
 
         try
         {
@@ -425,6 +664,8 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             }
         }
 
+        OpcodeCosts[opcode].Record(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - packetStart));
+
         if (deletePacket)
             delete packet;
 
@@ -679,6 +920,8 @@ void WorldSession::LogoutPlayer(bool save)
         LOG_INFO("entities.player", "Account: {} (IP: {}) Logout Character:[{}] ({}) Level: {}",
             GetAccountId(), GetRemoteAddress(), _player->GetName(), _player->GetGUID().ToString(), _player->getLevel());
 
+        _lastLoggedOutGuid = _player->GetGUID();
+
         //! Remove the player from the world
         // the player may not be in the world when logging out
         // e.g if he got disconnected during a transfer to another map
@@ -701,6 +944,9 @@ void WorldSession::LogoutPlayer(bool save)
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ACCOUNT_ONLINE);
         stmt->SetData(0, GetAccountId());
         CharacterDatabase.Execute(stmt);
+
+        // everything written while leaving the map is newer than a prefetch issued before
+        InvalidateLoginPrefetch(_lastLoggedOutGuid.GetCounter());
     }
 
     m_playerLogout = false;
@@ -35,6 +35,7 @@
 #include "StringFormat.h"
 #include "World.h"
 #include <map>
+#include <mutex>
 #include <utility>
 
 class Creature;
@@ -346,6 +347,56 @@ public:
 
     void SendPacket(WorldPacket const* packet);
 
+    // Movement relays of other units, queued until FlushMovementPackets() (once per map update).
+    // Any other packet sent to the session flushes the queue first, so the packet order seen by the client is unchanged.
+    // Relays only merge while no other packet reaches the session, see MovementFlushStats::Interrupted.
+    void SendMovementPacket(ObjectGuid moverGuid, WorldPacket const* packet);
+    // Network.CoalesceMovement
+    static bool IsMovementCoalesced();
+
+    struct MovementFlushStats
+    {
+        uint32 Sent{ 0 };
+        uint32 Merged{ 0 };                             // relays dropped because a newer state of the same mover superseded them
+        uint32 Interrupted{ 0 };                        // queue flushes forced by another packet before the end of the map update
+    };
+
+    // Sends the queued relays and returns the stats gathered since the previous call
+    MovementFlushStats FlushMovementPackets();
+
+    // Combat log packets, queued until FlushCombatLogPackets() at the end of the map update so the combat
+    // of one update reaches the socket together. Unlike movement relays they may be overtaken by other packets.
+    void SendCombatLogPacket(WorldPacket const* packet);
+    // Network.CombatLog.Aggregate
+    static bool IsCombatLogAggregated();
+    // Accounts a combat log packet that was not sent because the player is far from the fight
+    void SkipCombatLogPacket(WorldPacket const* packet);
+
+    struct CombatLogFlushStats
+    {
+        uint32 Sent{ 0 };
+        uint32 Merged{ 0 };                             // periodic aura logs appended to a queued log of the same aura
+        uint32 Trimmed{ 0 };
+        uint64 BytesSaved{ 0 };
+    };
+
+    CombatLogFlushStats FlushCombatLogPackets();
+
+    // Identifies the SMSG_PERIODICAURALOG packets that can be merged into one
+    struct PeriodicAuraLogKey
+    {
+        uint64 Target{ 0 };
+        uint64 Caster{ 0 };
+        uint32 SpellId{ 0 };
+
+        bool operator==(PeriodicAuraLogKey const& right) const { return Target == right.Target && Caster == right.Caster && SpellId == right.SpellId; }
+    };
+
+    struct PeriodicAuraLogKeyHash
+    {
+        std::size_t operator()(PeriodicAuraLogKey const& key) const;
+    };
+
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
     void SendPartyResult(PartyOperation operation, std::string const& member, PartyResult res, uint32 val = 0);
 
@@ -405,7 +456,14 @@ public:
     bool DisallowHyperlinksAndMaybeKick(std::string_view str);
 
     void QueuePacket(WorldPacket* new_packet);
-    bool Update(uint32 diff, PacketFilter& updater);
+    // timeBudget limits the packet processing of this call (0 = only the PacketProcessing.SessionBudget limit)
+    bool Update(uint32 diff, PacketFilter& updater, Microseconds timeBudget = 0us);
+
+    // true if the last Update() left packets in the queue because its time budget was spent
+    bool HasDeferredPackets() const { return _packetsDeferred; }
+
+    // Sends the opcode processing cost histograms collected since the previous call
+    static void ReportOpcodeCosts();
 
     /// Handle the authentication waiting queue (to be completed)
     void SendAuthWaitQueue(uint32 position);
@@ -537,6 +595,9 @@ public:                                                 // opcodes handlers
     void HandlePlayerLoginOpcode(WorldPacket& recvPacket);
     void HandleCharEnum(PreparedQueryResult result);
     void HandlePlayerLoginFromDB(LoginQueryHolder const& holder);
+    void QueryPlayerLoginData(ObjectGuid playerGuid);
+    void PrefetchLoginData(ObjectGuid playerGuid);
+    void DiscardLoginPrefetch();
     void HandlePlayerLoginToCharInWorld(Player* pCurrChar);
     void HandlePlayerLoginToCharOutOfWorld(Player* pCurrChar);
     void HandleCharFactionOrRaceChange(WorldPacket& recvData);
@@ -1072,6 +1133,10 @@ public:                                                 // opcodes handlers
     TransactionCallback& AddTransactionCallback(TransactionCallback&& callback);
     SQLQueryHolderCallback& AddQueryHolderCallback(SQLQueryHolderCallback&& callback);
 
+    // Drops login data prefetched at the character screen once the character is changed while offline
+    static void InvalidateLoginPrefetch(ObjectGuid::LowType guid);
+    static void InvalidateAllLoginPrefetches();
+
 private:
     void ProcessQueryCallbacks();
 
@@ -1117,6 +1182,8 @@ private:
 
     bool recoveryItem(Item* pItem);
 
+    void SendPendingMovementPackets();
+
     // logging helper
     void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char* reason);
     void LogUnprocessedTail(WorldPacket* packet);
@@ -1131,6 +1198,46 @@ private:
     // characters who failed on Player::BuildEnumData shouldn't login
     GuidSet _legitCharacters;
 
+    // login data of the character most likely to be played next, loaded while the client shows the character screen
+    struct LoginPrefetch
+    {
+        std::shared_ptr<LoginQueryHolder> Holder;
+        ObjectGuid Guid;
+        uint32 Serial{ 0 };
+        time_t IssueTime{ 0 };
+        bool Ready{ false };
+        bool LoginPending{ false };
+    } _loginPrefetch;
+
+    ObjectGuid _lastLoggedOutGuid;
+
+    bool _packetsDeferred;
+
+    struct PendingMovementPacket
+    {
+        ObjectGuid Mover;
+        WorldPacket Packet;
+    };
+
+    // filled by the map thread of the player, can be flushed from any thread sending to this session
+    std::vector<PendingMovementPacket> _pendingMovement;
+    std::atomic<bool> _hasPendingMovement;
+    std::atomic<bool> _hasMovementStats;
+    MovementFlushStats _movementStats;
+    std::mutex _pendingMovementLock;
+
+    struct PendingPeriodicAuraLog
+    {
+        std::size_t Index;                              // in _pendingCombatLog
+        std::size_t HeaderSize;
+    };
+
+    std::vector<WorldPacket> _pendingCombatLog;
+    std::unordered_map<PeriodicAuraLogKey, PendingPeriodicAuraLog, PeriodicAuraLogKeyHash> _pendingPeriodicAuraLogs;
+    std::atomic<bool> _hasPendingCombatLog;
+    CombatLogFlushStats _combatLogStats;
+    std::mutex _pendingCombatLogLock;
+
     ObjectGuid::LowType m_GUIDLow;
     Player* _player;
     std::shared_ptr<WorldSocket> m_Socket;
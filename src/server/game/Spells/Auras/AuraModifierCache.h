@@ -0,0 +1,81 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _AURA_MODIFIER_CACHE_H
+#define _AURA_MODIFIER_CACHE_H
+
+#include "Define.h"
+#include "SpellAuraDefines.h"
+#include <unordered_map>
+#include <vector>
+
+enum class AuraModifierAggregate : uint8
+{
+    Total,
+    Multiplier,
+    MaxPositive,
+    MaxNegative,
+    TotalByMiscMask,
+    MultiplierByMiscMask,
+    MaxPositiveByMiscMask,
+    MaxNegativeByMiscMask,
+    TotalByMiscValue,
+    MultiplierByMiscValue,
+    MaxPositiveByMiscValue,
+    MaxNegativeByMiscValue
+};
+
+// Results of the GetTotalAuraModifier() family for long aura effect lists.
+// All entries of an aura type are dropped when an effect of that type is (un)registered or changes its amount.
+class AuraModifierCache
+{
+public:
+    double const* Find(AuraType type, AuraModifierAggregate aggregate, int32 misc) const
+    {
+        auto itr = _entries.find(type);
+        if (itr == _entries.end())
+            return nullptr;
+
+        for (Entry const& entry : itr->second)
+            if (entry.Aggregate == aggregate && entry.Misc == misc)
+                return &entry.Value;
+
+        return nullptr;
+    }
+
+    void Store(AuraType type, AuraModifierAggregate aggregate, int32 misc, double value) { _entries[type].push_back({ aggregate, misc, value }); }
+
+    // keeps the bucket allocated, the same aura types are queried again and again
+    void Invalidate(AuraType type)
+    {
+        auto itr = _entries.find(type);
+        if (itr != _entries.end())
+            itr->second.clear();
+    }
+
+private:
+    struct Entry
+    {
+        AuraModifierAggregate Aggregate;
+        int32 Misc;
+        double Value;                                       // holds every int32 and float result exactly
+    };
+
+    std::unordered_map<uint32, std::vector<Entry>> _entries;
+};
+
+#endif
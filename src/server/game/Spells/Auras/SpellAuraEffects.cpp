@@ -439,6 +439,12 @@ int32 AuraEffect::GetMiscValueB() const
     return m_spellInfo->Effects[m_effIndex].MiscValueB;
 }
 
+void AuraEffect::InvalidateTargetModifierCaches() const
+{
+    for (auto const& [guid, aurApp] : m_base->GetApplicationMap())
+        aurApp->GetTarget()->InvalidateAuraModifierCache(GetAuraType());
+}
+
 int32 AuraEffect::GetMiscValue() const
 {
     return m_spellInfo->Effects[m_effIndex].MiscValue;
@@ -721,7 +727,10 @@ void AuraEffect::ChangeAmount(int32 newAmount, bool mark, bool onStackOrReapply)
     if (handleMask & AURA_EFFECT_HANDLE_CHANGE_AMOUNT)
     {
         if (!mark)
+        {
             m_amount = newAmount;
+            InvalidateTargetModifierCaches();
+        }
         else
             SetAmount(newAmount);
         CalculateSpellMod();
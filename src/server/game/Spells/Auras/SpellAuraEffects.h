@@ -44,6 +44,8 @@ private:
     ~AuraEffect();
     explicit AuraEffect(Aura* base, uint8 effIndex, int32* baseAmount, Unit* caster);
 public:
+    WARHEAD_POOLED_OBJECT
+
     Unit* GetCaster() const { return GetBase()->GetCaster(); }
     ObjectGuid GetCasterGUID() const { return GetBase()->GetCasterGUID(); }
     Aura* GetBase() const { return m_base; }
@@ -62,7 +64,7 @@ public:
     AuraType GetAuraType() const;
     int32 GetAmount() const { return m_isAuraEnabled ? m_amount : 0; }
     int32 GetForcedAmount() const { return m_amount; }
-    void SetAmount(int32 amount) { m_amount = amount; m_canBeRecalculated = false;}
+    void SetAmount(int32 amount) { m_amount = amount; m_canBeRecalculated = false; InvalidateTargetModifierCaches(); }
 
     int32 GetPeriodicTimer() const { return m_periodicTimer; }
     void SetPeriodicTimer(int32 periodicTimer) { m_periodicTimer = periodicTimer; }
@@ -114,9 +116,12 @@ public:
     uint32 GetAuraGroup() const { return m_auraGroup; }
     int32 GetOldAmount() const { return m_oldAmount; }
     void SetOldAmount(int32 amount) { m_oldAmount = amount; }
-    void SetEnabled(bool enabled) { m_isAuraEnabled = enabled; }
+    void SetEnabled(bool enabled) { m_isAuraEnabled = enabled; InvalidateTargetModifierCaches(); }
 
 private:
+    // the amount used by the Unit::GetTotalAuraModifier() family changed
+    void InvalidateTargetModifierCaches() const;
+
     Aura* const m_base;
 
     SpellInfo const* const m_spellInfo;
@@ -2338,7 +2338,8 @@ void Aura::LoadScripts()
             continue;
         }
         LOG_DEBUG("spells.aura", "Aura::LoadScripts: Script `{}` for aura `{}` is loaded now", (*itr)->_GetScriptName()->c_str(), m_spellInfo->Id);
-        (*itr)->Register();
+        if (!(*itr)->_HasSharedHooks())
+            (*itr)->Register();
         ++itr;
     }
 }
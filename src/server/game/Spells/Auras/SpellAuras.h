@@ -18,6 +18,7 @@
 #ifndef WARHEAD_SPELLAURAS_H
 #define WARHEAD_SPELLAURAS_H
 
+#include "ObjectPool.h"
 #include "SpellAuraDefines.h"
 #include "Unit.h"
 
@@ -58,6 +59,8 @@ private:
     void _InitFlags(Unit* caster, uint8 effMask);
     void _HandleEffect(uint8 effIndex, bool apply);
 public:
+    WARHEAD_POOLED_OBJECT
+
     Unit* GetTarget() const { return _target; }
     Aura* GetBase() const { return _base; }
 
@@ -87,6 +90,8 @@ class WH_GAME_API Aura
 {
     friend Aura* Unit::_TryStackingOrRefreshingExistingAura(SpellInfo const* newAura, uint8 effMask, Unit* caster, int32* baseAmount, Item* castItem, ObjectGuid casterGUID, bool noPeriodicReset);
 public:
+    WARHEAD_POOLED_OBJECT
+
     typedef std::map<ObjectGuid, AuraApplication*> ApplicationMap;
 
     static uint8 BuildEffectMaskForOwner(SpellInfo const* spellProto, uint8 avalibleEffectMask, WorldObject* owner);
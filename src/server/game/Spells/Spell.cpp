@@ -819,23 +819,27 @@ void Spell::SelectSpellTargets()
     // select targets for cast phase
     SelectExplicitTargets();
 
+    SpellHotInfo const& hotInfo = sSpellMgr->GetSpellHotInfo(m_spellInfo);
     uint32 processedAreaEffectsMask = 0;
     for (uint32 i = 0; i < MAX_SPELL_EFFECTS; ++i)
     {
         // not call for empty effect.
         // Also some spells use not used effect targets for store targets for dummy effect in triggered spells
-        if (!m_spellInfo->Effects[i].IsEffect())
+        if (!hotInfo.Effect[i])
             continue;
 
+        SpellImplicitTargetInfo const targetA(hotInfo.TargetA[i]);
+        SpellImplicitTargetInfo const targetB(hotInfo.TargetB[i]);
+
         // set expected type of implicit targets to be sent to client
-        uint32 implicitTargetMask = GetTargetFlagMask(m_spellInfo->Effects[i].TargetA.GetObjectType()) | GetTargetFlagMask(m_spellInfo->Effects[i].TargetB.GetObjectType());
+        uint32 implicitTargetMask = GetTargetFlagMask(targetA.GetObjectType()) | GetTargetFlagMask(targetB.GetObjectType());
         if (implicitTargetMask & TARGET_FLAG_UNIT)
             m_targets.SetTargetFlag(TARGET_FLAG_UNIT);
         if (implicitTargetMask & (TARGET_FLAG_GAMEOBJECT | TARGET_FLAG_GAMEOBJECT_ITEM))
             m_targets.SetTargetFlag(TARGET_FLAG_GAMEOBJECT);
 
-        SelectEffectImplicitTargets(SpellEffIndex(i), m_spellInfo->Effects[i].TargetA, processedAreaEffectsMask);
-        SelectEffectImplicitTargets(SpellEffIndex(i), m_spellInfo->Effects[i].TargetB, processedAreaEffectsMask);
+        SelectEffectImplicitTargets(SpellEffIndex(i), targetA, processedAreaEffectsMask);
+        SelectEffectImplicitTargets(SpellEffIndex(i), targetB, processedAreaEffectsMask);
 
         // Select targets of effect based on effect type
         // those are used when no valid target could be added for spell effect based on spell target type
@@ -847,7 +851,7 @@ void Spell::SelectSpellTargets()
         if (m_targets.HasDst())
             AddDestTarget(*m_targets.GetDst(), i);
 
-        if (m_spellInfo->IsChanneled())
+        if (hotInfo.IsChanneled())
         {
             // maybe do this for all spells?
             if (!focusObject && m_UniqueTargetInfo.empty() && m_UniqueGOTargetInfo.empty() && m_UniqueItemInfo.empty() && !m_targets.HasDst())
@@ -1331,6 +1335,8 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
             Warhead::Containers::RandomResize(targets, maxTargets);
         }
 
+        PrefetchLineOfSight(targets);
+
         for (std::list<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
         {
             if (Unit* unitTarget = (*itr)->ToUnit())
@@ -5376,8 +5382,10 @@ void Spell::HandleEffects(Unit* pUnitTarget, Item* pItemTarget, GameObject* pGOT
 
 SpellCastResult Spell::CheckCast(bool strict)
 {
+    SpellHotInfo const& hotInfo = sSpellMgr->GetSpellHotInfo(m_spellInfo);
+
     // check death state
-    if (!m_caster->IsAlive() && !m_spellInfo->HasAttribute(SPELL_ATTR0_PASSIVE) && !(m_spellInfo->HasAttribute(SPELL_ATTR0_ALLOW_CAST_WHILE_DEAD) || (IsTriggered() && !m_triggeredByAuraSpell)))
+    if (!m_caster->IsAlive() && !hotInfo.HasAttribute(SPELL_ATTR0_PASSIVE) && !(hotInfo.HasAttribute(SPELL_ATTR0_ALLOW_CAST_WHILE_DEAD) || (IsTriggered() && !m_triggeredByAuraSpell)))
         return SPELL_FAILED_CASTER_DEAD;
 
     // Spectator check
@@ -5393,7 +5401,7 @@ SpellCastResult Spell::CheckCast(bool strict)
         return res;
 
     // check cooldowns to prevent cheating
-    if (!m_spellInfo->HasAttribute(SPELL_ATTR0_PASSIVE))
+    if (!hotInfo.HasAttribute(SPELL_ATTR0_PASSIVE))
     {
         if (m_caster->GetTypeId() == TYPEID_PLAYER)
         {
@@ -5413,11 +5421,11 @@ SpellCastResult Spell::CheckCast(bool strict)
             if (m_caster->ToPlayer()->GetLastPotionId() && m_CastItem && (m_CastItem->IsPotion() || m_spellInfo->IsCooldownStartedOnEvent()))
                 return SPELL_FAILED_NOT_READY;
         }
-        else if (!IsTriggered() && m_caster->GetTypeId() == TYPEID_UNIT && m_caster->ToCreature()->IsSpellProhibited(m_spellInfo->GetSchoolMask()))
+        else if (!IsTriggered() && m_caster->GetTypeId() == TYPEID_UNIT && m_caster->ToCreature()->IsSpellProhibited(SpellSchoolMask(hotInfo.SchoolMask)))
             return SPELL_FAILED_NOT_READY;
     }
 
-    if (m_spellInfo->HasAttribute(SPELL_ATTR7_DEBUG_SPELL) && !m_caster->HasUnitFlag2(UNIT_FLAG2_ALLOW_CHEAT_SPELLS))
+    if (hotInfo.HasAttribute(SPELL_ATTR7_DEBUG_SPELL) && !m_caster->HasUnitFlag2(UNIT_FLAG2_ALLOW_CHEAT_SPELLS))
     {
         m_customError = SPELL_CUSTOM_ERROR_GM_ONLY;
         return SPELL_FAILED_CUSTOM_ERROR;
@@ -5435,11 +5443,11 @@ SpellCastResult Spell::CheckCast(bool strict)
 
     if (m_caster->GetTypeId() == TYPEID_PLAYER /*&& VMAP::VMapFactory::createOrGetVMapMgr()->isLineOfSightCalcEnabled()*/) // pussywizard: optimization (commented)
     {
-        if (m_spellInfo->HasAttribute(SPELL_ATTR0_ONLY_OUTDOORS) &&
+        if (hotInfo.HasAttribute(SPELL_ATTR0_ONLY_OUTDOORS) &&
                 !m_caster->IsOutdoors())
             return SPELL_FAILED_ONLY_OUTDOORS;
 
-        if (m_spellInfo->HasAttribute(SPELL_ATTR0_ONLY_INDOORS) &&
+        if (hotInfo.HasAttribute(SPELL_ATTR0_ONLY_INDOORS) &&
                 m_caster->IsOutdoors())
             return SPELL_FAILED_ONLY_INDOORS;
     }
@@ -5465,14 +5473,14 @@ SpellCastResult Spell::CheckCast(bool strict)
             if (shapeError != SPELL_CAST_OK)
                 return shapeError;
 
-            if (m_spellInfo->HasAttribute(SPELL_ATTR0_ONLY_STEALTHED) && !(m_caster->HasStealthAura()))
+            if (hotInfo.HasAttribute(SPELL_ATTR0_ONLY_STEALTHED) && !(m_caster->HasStealthAura()))
                 return SPELL_FAILED_ONLY_STEALTHED;
         }
     }
 
     Unit::AuraEffectList const& blockSpells = m_caster->GetAuraEffectsByType(SPELL_AURA_BLOCK_SPELL_FAMILY);
     for (Unit::AuraEffectList::const_iterator blockItr = blockSpells.begin(); blockItr != blockSpells.end(); ++blockItr)
-        if (uint32((*blockItr)->GetMiscValue()) == m_spellInfo->SpellFamilyName)
+        if (uint32((*blockItr)->GetMiscValue()) == hotInfo.SpellFamilyName)
             return SPELL_FAILED_SPELL_UNAVAILABLE;
 
     bool reqCombat = true;
@@ -5510,7 +5518,7 @@ SpellCastResult Spell::CheckCast(bool strict)
     }
 
     // Xinef: exploit protection
-    if (reqCombat && !m_spellInfo->CanBeUsedInCombat() && (m_spellInfo->HasEffect(SPELL_EFFECT_RESURRECT) || m_spellInfo->HasEffect(SPELL_EFFECT_RESURRECT_NEW)))
+    if (reqCombat && !m_spellInfo->CanBeUsedInCombat() && (hotInfo.HasEffect(SPELL_EFFECT_RESURRECT) || hotInfo.HasEffect(SPELL_EFFECT_RESURRECT_NEW)))
     {
         if (m_caster->GetTypeId() == TYPEID_PLAYER && m_caster->GetMap()->IsDungeon())
             if (InstanceScript* instanceScript = m_caster->GetInstanceScript())
@@ -5536,8 +5544,8 @@ SpellCastResult Spell::CheckCast(bool strict)
     if (m_caster->GetTypeId() == TYPEID_PLAYER && m_caster->ToPlayer()->isMoving() && !IsTriggered())
     {
         // skip stuck spell to allow use it in falling case and apply spell limitations at movement
-        if ((!m_caster->HasUnitMovementFlag(MOVEMENTFLAG_FALLING_FAR) || m_spellInfo->Effects[0].Effect != SPELL_EFFECT_STUCK) &&
-                (IsAutoRepeat() || (m_spellInfo->AuraInterruptFlags & AURA_INTERRUPT_FLAG_NOT_SEATED) != 0))
+        if ((!m_caster->HasUnitMovementFlag(MOVEMENTFLAG_FALLING_FAR) || hotInfo.Effect[0] != SPELL_EFFECT_STUCK) &&
+                (IsAutoRepeat() || (hotInfo.AuraInterruptFlags & AURA_INTERRUPT_FLAG_NOT_SEATED) != 0))
             return SPELL_FAILED_MOVING;
     }
 
@@ -5557,7 +5565,7 @@ SpellCastResult Spell::CheckCast(bool strict)
             }
         }
 
-        if (m_spellInfo->HasAura(SPELL_AURA_MOUNTED))
+        if (hotInfo.HasAura(SPELL_AURA_MOUNTED))
             checkMask |= VEHICLE_SEAT_FLAG_CAN_CAST_MOUNT_SPELL;
 
         if (!checkMask)
@@ -5565,7 +5573,7 @@ SpellCastResult Spell::CheckCast(bool strict)
 
         // All creatures should be able to cast as passengers freely, restriction and attribute are only for players
         VehicleSeatEntry const* vehicleSeat = vehicle->GetSeatForPassenger(m_caster);
-        if (!m_spellInfo->HasAttribute(SPELL_ATTR6_ALLOW_WHILE_RIDING_VEHICLE) && !m_spellInfo->HasAttribute(SPELL_ATTR0_ALLOW_WHILE_MOUNTED)
+        if (!hotInfo.HasAttribute(SPELL_ATTR6_ALLOW_WHILE_RIDING_VEHICLE) && !hotInfo.HasAttribute(SPELL_ATTR0_ALLOW_WHILE_MOUNTED)
                 && (vehicleSeat->m_flags & checkMask) != checkMask && m_caster->GetTypeId() == TYPEID_PLAYER)
             return SPELL_FAILED_DONT_REPORT;
     }
@@ -5595,11 +5603,11 @@ SpellCastResult Spell::CheckCast(bool strict)
     // such spells when learned are not targeting anyone using targeting system, they should apply directly to caster instead
     // also, such casts shouldn't be sent to client
     // Xinef: do not check explicit casts for self cast of triggered spells (eg. reflect case)
-    if (!(m_spellInfo->HasAttribute(SPELL_ATTR0_PASSIVE) && (!m_targets.GetUnitTarget() || m_targets.GetUnitTarget() == m_caster)))
+    if (!(hotInfo.HasAttribute(SPELL_ATTR0_PASSIVE) && (!m_targets.GetUnitTarget() || m_targets.GetUnitTarget() == m_caster)))
     {
         // Check explicit target for m_originalCaster - todo: get rid of such workarounds
         // Xinef: do not check explicit target for triggered spell casted on self with targetflag enemy
-        if (!m_triggeredByAuraSpell || m_targets.GetUnitTarget() != m_caster || !(m_spellInfo->GetExplicitTargetMask() & TARGET_FLAG_UNIT_ENEMY))
+        if (!m_triggeredByAuraSpell || m_targets.GetUnitTarget() != m_caster || !(hotInfo.ExplicitTargetMask & TARGET_FLAG_UNIT_ENEMY))
         {
             SpellCastResult castResult = m_spellInfo->CheckExplicitTarget((m_originalCaster && m_caster->GetEntry() != WORLD_TRIGGER) ? m_originalCaster : m_caster, m_targets.GetObjectTarget(), m_targets.GetItemTarget());
             if (castResult != SPELL_CAST_OK)
@@ -5616,15 +5624,15 @@ SpellCastResult Spell::CheckCast(bool strict)
         if (target != m_caster)
         {
             // Must be behind the target
-            if (m_spellInfo->HasAttribute(SPELL_ATTR0_CU_REQ_CASTER_BEHIND_TARGET) && target->HasInArc(static_cast<float>(M_PI), m_caster))
+            if (hotInfo.HasAttribute(SPELL_ATTR0_CU_REQ_CASTER_BEHIND_TARGET) && target->HasInArc(static_cast<float>(M_PI), m_caster))
                 return SPELL_FAILED_NOT_BEHIND;
 
             // Target must be facing you
-            if (m_spellInfo->HasAttribute(SPELL_ATTR0_CU_REQ_TARGET_FACING_CASTER) && !target->HasInArc(static_cast<float>(M_PI), m_caster))
+            if (hotInfo.HasAttribute(SPELL_ATTR0_CU_REQ_TARGET_FACING_CASTER) && !target->HasInArc(static_cast<float>(M_PI), m_caster))
                 return SPELL_FAILED_NOT_INFRONT;
 
-            if ((!m_caster->IsTotem() || !m_spellInfo->IsPositive()) && !m_spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT) &&
-                !m_spellInfo->HasAttribute(SPELL_ATTR5_ALWAYS_AOE_LINE_OF_SIGHT) && !(m_spellFlags & SPELL_FLAG_REDIRECTED))
+            if ((!m_caster->IsTotem() || !m_spellInfo->IsPositive()) && !hotInfo.HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT) &&
+                !hotInfo.HasAttribute(SPELL_ATTR5_ALWAYS_AOE_LINE_OF_SIGHT) && !(m_spellFlags & SPELL_FLAG_REDIRECTED))
             {
                 WorldObject* losCenter = nullptr;
                 uint32 losChecks = LINEOFSIGHT_ALL_CHECKS;
@@ -5664,8 +5672,8 @@ SpellCastResult Spell::CheckCast(bool strict)
         float x, y, z;
         m_targets.GetDstPos()->GetPosition(x, y, z);
 
-        if ((!m_caster->IsTotem() || !m_spellInfo->IsPositive()) && !m_spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT) &&
-            !m_spellInfo->HasAttribute(SPELL_ATTR5_ALWAYS_AOE_LINE_OF_SIGHT))
+        if ((!m_caster->IsTotem() || !m_spellInfo->IsPositive()) && !hotInfo.HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT) &&
+            !hotInfo.HasAttribute(SPELL_ATTR5_ALWAYS_AOE_LINE_OF_SIGHT))
         {
             WorldObject* losCenter = nullptr;
             uint32 losChecks = LINEOFSIGHT_ALL_CHECKS;
@@ -5701,7 +5709,7 @@ SpellCastResult Spell::CheckCast(bool strict)
     // check pet presence
     for (int j = 0; j < MAX_SPELL_EFFECTS; ++j)
     {
-        if (m_spellInfo->Effects[j].TargetA.GetTarget() == TARGET_UNIT_PET)
+        if (hotInfo.TargetA[j] == TARGET_UNIT_PET)
         {
             if (!m_caster->GetGuardianPet() && !m_caster->GetCharm())
             {
@@ -5714,15 +5722,15 @@ SpellCastResult Spell::CheckCast(bool strict)
         }
     }
     // Spell casted only on battleground
-    if (m_spellInfo->HasAttribute(SPELL_ATTR3_ONLY_BATTLEGROUNDS) &&  m_caster->GetTypeId() == TYPEID_PLAYER)
+    if (hotInfo.HasAttribute(SPELL_ATTR3_ONLY_BATTLEGROUNDS) &&  m_caster->GetTypeId() == TYPEID_PLAYER)
         if (!m_caster->ToPlayer()->InBattleground())
             return SPELL_FAILED_ONLY_BATTLEGROUNDS;
 
     // do not allow spells to be cast in arenas
     // - with greater than 10 min CD without SPELL_ATTR4_IGNORE_DEFAULT_ARENA_RESTRICTIONS flag
     // - with SPELL_ATTR4_NOT_IN_ARENA_OR_RATED_BATTLEGROUND flag
-    if (m_spellInfo->HasAttribute(SPELL_ATTR4_NOT_IN_ARENA_OR_RATED_BATTLEGROUND) ||
-            (m_spellInfo->GetRecoveryTime() >= 10 * MINUTE * IN_MILLISECONDS && !m_spellInfo->HasAttribute(SPELL_ATTR4_IGNORE_DEFAULT_ARENA_RESTRICTIONS)))
+    if (hotInfo.HasAttribute(SPELL_ATTR4_NOT_IN_ARENA_OR_RATED_BATTLEGROUND) ||
+            (m_spellInfo->GetRecoveryTime() >= 10 * MINUTE * IN_MILLISECONDS && !hotInfo.HasAttribute(SPELL_ATTR4_IGNORE_DEFAULT_ARENA_RESTRICTIONS)))
         if (MapEntry const* mapEntry = sMapStore.LookupEntry(m_caster->GetMapId()))
             if (mapEntry->IsBattleArena())
                 return SPELL_FAILED_NOT_IN_ARENA;
@@ -5741,7 +5749,7 @@ SpellCastResult Spell::CheckCast(bool strict)
 
     // not let players cast spells at mount (and let do it to creatures)
     if (m_caster->IsMounted() && m_caster->GetTypeId() == TYPEID_PLAYER && !(_triggeredCastFlags & TRIGGERED_IGNORE_CASTER_MOUNTED_OR_ON_VEHICLE) &&
-            !m_spellInfo->IsPassive() && !m_spellInfo->HasAttribute(SPELL_ATTR0_ALLOW_WHILE_MOUNTED))
+            !m_spellInfo->IsPassive() && !hotInfo.HasAttribute(SPELL_ATTR0_ALLOW_WHILE_MOUNTED))
     {
         if (m_caster->IsInFlight())
             return SPELL_FAILED_NOT_ON_TAXI;
@@ -5803,9 +5811,9 @@ SpellCastResult Spell::CheckCast(bool strict)
     bool hasNonDispelEffect = false;
     uint32 dispelMask = 0;
     for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
-        if (m_spellInfo->Effects[i].Effect == SPELL_EFFECT_DISPEL)
+        if (hotInfo.Effect[i] == SPELL_EFFECT_DISPEL)
         {
-            if (m_spellInfo->Effects[i].IsTargetingArea() || m_spellInfo->HasAttribute(SPELL_ATTR1_INITIATE_COMBAT))
+            if (m_spellInfo->Effects[i].IsTargetingArea() || hotInfo.HasAttribute(SPELL_ATTR1_INITIATE_COMBAT))
             {
                 hasDispellableAura = true;
                 break;
@@ -5813,7 +5821,7 @@ SpellCastResult Spell::CheckCast(bool strict)
 
             dispelMask |= SpellInfo::GetDispelMask(DispelType(m_spellInfo->Effects[i].MiscValue));
         }
-        else if (m_spellInfo->Effects[i].IsEffect())
+        else if (hotInfo.Effect[i])
         {
             hasNonDispelEffect = true;
             break;
@@ -5845,11 +5853,11 @@ SpellCastResult Spell::CheckCast(bool strict)
     for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
     {
         // for effects of spells that have only one target
-        switch (m_spellInfo->Effects[i].Effect)
+        switch (hotInfo.Effect[i])
         {
             case SPELL_EFFECT_DUMMY:
                 {
-                    if (m_spellInfo->SpellFamilyName == SPELLFAMILY_DEATHKNIGHT)
+                    if (hotInfo.SpellFamilyName == SPELLFAMILY_DEATHKNIGHT)
                     {
                         // Raise Ally
                         if( m_spellInfo->Id == 61999 )
@@ -5869,7 +5877,7 @@ SpellCastResult Spell::CheckCast(bool strict)
                     if (m_caster->GetTypeId() != TYPEID_PLAYER)
                         return SPELL_FAILED_BAD_TARGETS;
 
-                    if (m_spellInfo->Effects[i].TargetA.GetTarget() != TARGET_UNIT_PET)
+                    if (hotInfo.TargetA[i] != TARGET_UNIT_PET)
                         break;
 
                     Pet* pet = m_caster->ToPlayer()->GetPet();
@@ -5959,7 +5967,7 @@ SpellCastResult Spell::CheckCast(bool strict)
                         return SPELL_FAILED_DONT_REPORT;
                     }
 
-                    if (m_spellInfo->SpellFamilyName == SPELLFAMILY_WARRIOR)
+                    if (hotInfo.SpellFamilyName == SPELLFAMILY_WARRIOR)
                     {
                         // Warbringer - can't be handled in proc system - should be done before checkcast root check and charge effect process
                         if (strict && m_caster->IsScriptOverriden(m_spellInfo, 6953))
@@ -6044,13 +6052,13 @@ SpellCastResult Spell::CheckCast(bool strict)
                 }
             case SPELL_EFFECT_OPEN_LOCK:
                 {
-                    if (m_spellInfo->Effects[i].TargetA.GetTarget() != TARGET_GAMEOBJECT_TARGET &&
-                            m_spellInfo->Effects[i].TargetA.GetTarget() != TARGET_GAMEOBJECT_ITEM_TARGET)
+                    if (hotInfo.TargetA[i] != TARGET_GAMEOBJECT_TARGET &&
+                            hotInfo.TargetA[i] != TARGET_GAMEOBJECT_ITEM_TARGET)
                         break;
 
                     if (m_caster->GetTypeId() != TYPEID_PLAYER  // only players can open locks, gather etc.
                             // we need a go target in case of TARGET_GAMEOBJECT_TARGET
-                            || (m_spellInfo->Effects[i].TargetA.GetTarget() == TARGET_GAMEOBJECT_TARGET && !m_targets.GetGOTarget()))
+                            || (hotInfo.TargetA[i] == TARGET_GAMEOBJECT_TARGET && !m_targets.GetGOTarget()))
                         return SPELL_FAILED_BAD_TARGETS;
 
                     Item* pTempItem = nullptr;
@@ -6063,7 +6071,7 @@ SpellCastResult Spell::CheckCast(bool strict)
                         pTempItem = m_caster->ToPlayer()->GetItemByGuid(m_targets.GetItemTargetGUID());
 
                     // we need a go target, or an openable item target in case of TARGET_GAMEOBJECT_ITEM_TARGET
-                    if (m_spellInfo->Effects[i].TargetA.GetTarget() == TARGET_GAMEOBJECT_ITEM_TARGET &&
+                    if (hotInfo.TargetA[i] == TARGET_GAMEOBJECT_ITEM_TARGET &&
                             !m_targets.GetGOTarget() &&
                             (!pTempItem || !pTempItem->GetTemplate()->LockID || !pTempItem->IsLocked()))
                         return SPELL_FAILED_BAD_TARGETS;
@@ -6137,7 +6145,7 @@ SpellCastResult Spell::CheckCast(bool strict)
             case SPELL_EFFECT_SUMMON:
                 {
                     SummonPropertiesEntry const* SummonProperties = sSummonPropertiesStore.LookupEntry(m_spellInfo->Effects[i].MiscValueB);
-                    if (!SummonProperties || m_spellInfo->HasAttribute(SPELL_ATTR1_DISMISS_PET_FIRST))
+                    if (!SummonProperties || hotInfo.HasAttribute(SPELL_ATTR1_DISMISS_PET_FIRST))
                         break;
                     switch (SummonProperties->Category)
                     {
@@ -6169,7 +6177,7 @@ SpellCastResult Spell::CheckCast(bool strict)
                     if (!unitCaster)
                         return SPELL_FAILED_BAD_TARGETS;
 
-                    if (!m_spellInfo->HasAttribute(SPELL_ATTR1_DISMISS_PET_FIRST))
+                    if (!hotInfo.HasAttribute(SPELL_ATTR1_DISMISS_PET_FIRST))
                     {
                         if (m_caster->GetPetGUID())
                             return SPELL_FAILED_ALREADY_HAVE_SUMMON;
@@ -6342,7 +6350,7 @@ SpellCastResult Spell::CheckCast(bool strict)
 
     for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
     {
-        switch (m_spellInfo->Effects[i].ApplyAuraName)
+        switch (hotInfo.ApplyAuraName[i])
         {
             case SPELL_AURA_DUMMY:
                 break;
@@ -6367,7 +6375,7 @@ SpellCastResult Spell::CheckCast(bool strict)
                         return SPELL_FAILED_CHARMED;
 
                     // Xinef: allow SPELL_AURA_MOD_POSSESS to posses target if caster has some pet
-                    if (m_spellInfo->Effects[i].ApplyAuraName == SPELL_AURA_MOD_CHARM && !m_spellInfo->HasAttribute(SPELL_ATTR1_DISMISS_PET_FIRST))
+                    if (hotInfo.ApplyAuraName[i] == SPELL_AURA_MOD_CHARM && !hotInfo.HasAttribute(SPELL_ATTR1_DISMISS_PET_FIRST))
                     {
                         if (m_caster->GetPetGUID())
                             return SPELL_FAILED_ALREADY_HAVE_SUMMON;
@@ -6375,7 +6383,7 @@ SpellCastResult Spell::CheckCast(bool strict)
                         if (m_caster->GetCharmGUID())
                             return SPELL_FAILED_ALREADY_HAVE_CHARM;
                     }
-                    else if (m_spellInfo->Effects[i].ApplyAuraName == SPELL_AURA_MOD_POSSESS)
+                    else if (hotInfo.ApplyAuraName[i] == SPELL_AURA_MOD_POSSESS)
                     {
                         if (m_caster->GetCharmGUID())
                             return SPELL_FAILED_ALREADY_HAVE_CHARM;
@@ -6408,7 +6416,7 @@ SpellCastResult Spell::CheckCast(bool strict)
             case SPELL_AURA_MOUNTED:
                 {
                     // Xinef: disallow casting in water for mounts not increasing water movement Speed
-                    if (m_caster->IsInWater() && !m_spellInfo->HasAura(SPELL_AURA_MOD_INCREASE_SWIM_SPEED))
+                    if (m_caster->IsInWater() && !hotInfo.HasAura(SPELL_AURA_MOD_INCREASE_SWIM_SPEED))
                         return SPELL_FAILED_ONLY_ABOVEWATER;
 
                     // Ignore map check if spell have AreaId. AreaId already checked and this prevent special mount spells
@@ -6478,7 +6486,7 @@ SpellCastResult Spell::CheckCast(bool strict)
                 }
             case SPELL_AURA_HOVER:
                 {
-                    if ((m_spellInfo->AuraInterruptFlags & AURA_INTERRUPT_FLAG_MOUNT) != 0 && m_targets.GetUnitTarget() && m_targets.GetUnitTarget()->IsMounted())
+                    if ((hotInfo.AuraInterruptFlags & AURA_INTERRUPT_FLAG_MOUNT) != 0 && m_targets.GetUnitTarget() && m_targets.GetUnitTarget()->IsMounted())
                     {
                         return SPELL_FAILED_NOT_ON_MOUNTED;
                     }
@@ -6787,16 +6795,17 @@ SpellCastResult Spell::CheckRange(bool strict)
     if (!strict && m_casttime == 0)
         return SPELL_CAST_OK;
 
+    SpellHotInfo const& hotInfo = sSpellMgr->GetSpellHotInfo(m_spellInfo);
     uint32 range_type = 0;
 
-    if (m_spellInfo->RangeEntry)
+    if (hotInfo.RangeId)
     {
         // check needed by 68766 51693 - both spells are cast on enemies and have 0 max range
         // these are triggered by other spells - possibly we should omit range check in that case?
-        if (m_spellInfo->RangeEntry->ID == 1)
+        if (hotInfo.RangeId == 1)
             return SPELL_CAST_OK;
 
-        range_type = m_spellInfo->RangeEntry->Flags;
+        range_type = hotInfo.RangeFlags;
     }
 
     Unit* target = m_targets.GetUnitTarget();
@@ -6833,7 +6842,7 @@ SpellCastResult Spell::CheckRange(bool strict)
             else if (!m_caster->IsWithinCombatRange(target, max_range))
                 return SPELL_FAILED_OUT_OF_RANGE; //0x5A;
 
-            if (m_spellInfo->DmgClass == SPELL_DAMAGE_CLASS_RANGED && range_type == SPELL_RANGE_RANGED)
+            if (hotInfo.DmgClass == SPELL_DAMAGE_CLASS_RANGED && range_type == SPELL_RANGE_RANGED)
             {
                 if (m_caster->IsWithinMeleeRange(target))
                     return SPELL_FAILED_TOO_CLOSE;
@@ -7673,18 +7682,9 @@ bool Spell::CheckEffectTarget(Unit const* target, uint32 eff) const
             break;
     }
 
-    // xinef: skip los checking if spell has appropriate attribute, or target requires specific entry
-    // this is only for target addition and target has to have unselectable flag, this is valid for FLAG_EXTRA_TRIGGER and quest triggers however there are some without this flag, used not_selectable
-    if (m_spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT) || (target->GetTypeId() == TYPEID_UNIT && target->HasUnitFlag(UNIT_FLAG_NOT_SELECTABLE) && (m_spellInfo->Effects[eff].TargetA.GetCheckType() == TARGET_CHECK_ENTRY || m_spellInfo->Effects[eff].TargetB.GetCheckType() == TARGET_CHECK_ENTRY)))
+    if (IsEffectTargetLineOfSightIgnored(target, eff))
         return true;
 
-     // if spell is triggered, need to check for LOS disable on the aura triggering it and inherit that behaviour
-    if (IsTriggered() && m_triggeredByAuraSpell && (m_triggeredByAuraSpell.spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT) ||
-        DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_triggeredByAuraSpell.spellInfo->Id, nullptr, SPELL_DISABLE_LOS)))
-    {
-        return true;
-    }
-
     // todo: below shouldn't be here, but it's temporary
     //Check targets for LOS visibility (except spells without range limitations)
     switch (m_spellInfo->Effects[eff].Effect)
@@ -7745,35 +7745,10 @@ bool Spell::CheckEffectTarget(Unit const* target, uint32 eff) const
         default: // normal case
         {
             uint32 losChecks = LINEOFSIGHT_ALL_CHECKS;
-            GameObject* gobCaster = nullptr;
-            if (m_originalCasterGUID.IsGameObject())
-            {
-                gobCaster = m_caster->GetMap()->GetGameObject(m_originalCasterGUID);
-            }
-            else if (m_caster->GetEntry() == WORLD_TRIGGER)
-            {
-                if (TempSummon* tempSummon = m_caster->ToTempSummon())
-                {
-                    gobCaster = tempSummon->GetSummonerGameObject();
-                }
-            }
-
-            WorldObject* caster = nullptr;
-            if (gobCaster)
+            WorldObject* caster = GetLineOfSightReference(losChecks);
+            if (!caster)
             {
-                if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
-                {
-                    return true;
-                }
-
-                caster = gobCaster;
-
-                // If spell casted by gameobject then ignore M2 models
-                losChecks &= ~LINEOFSIGHT_CHECK_GOBJECT_M2;
-            }
-            else
-            {
-                caster = m_caster;
+                return true;
             }
 
             if (target != m_caster)
@@ -7801,6 +7776,126 @@ bool Spell::CheckEffectTarget(Unit const* target, uint32 eff) const
     return true;
 }
 
+bool Spell::IsEffectTargetLineOfSightIgnored(Unit const* target, uint32 eff) const
+{
+    // xinef: skip los checking if spell has appropriate attribute, or target requires specific entry
+    // this is only for target addition and target has to have unselectable flag, this is valid for FLAG_EXTRA_TRIGGER and quest triggers however there are some without this flag, used not_selectable
+    if (m_spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT) || (target->GetTypeId() == TYPEID_UNIT && target->HasUnitFlag(UNIT_FLAG_NOT_SELECTABLE) && (m_spellInfo->Effects[eff].TargetA.GetCheckType() == TARGET_CHECK_ENTRY || m_spellInfo->Effects[eff].TargetB.GetCheckType() == TARGET_CHECK_ENTRY)))
+        return true;
+
+     // if spell is triggered, need to check for LOS disable on the aura triggering it and inherit that behaviour
+    if (IsTriggered() && m_triggeredByAuraSpell && (m_triggeredByAuraSpell.spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT) ||
+        DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_triggeredByAuraSpell.spellInfo->Id, nullptr, SPELL_DISABLE_LOS)))
+    {
+        return true;
+    }
+
+    return false;
+}
+
+bool Spell::ReachesEffectTargetLineOfSight(Unit const* target, uint32 eff) const
+{
+    if (!m_spellInfo->Effects[eff].IsEffect())
+        return false;
+
+    // charm effects may reject the target before, not worth replicating for these rare area spells
+    switch (m_spellInfo->Effects[eff].ApplyAuraName)
+    {
+        case SPELL_AURA_MOD_POSSESS:
+        case SPELL_AURA_MOD_CHARM:
+        case SPELL_AURA_MOD_POSSESS_PET:
+        case SPELL_AURA_AOE_CHARM:
+            return false;
+        default:
+            break;
+    }
+
+    if (IsEffectTargetLineOfSightIgnored(target, eff))
+        return false;
+
+    // these do their own checks, see CheckEffectTarget
+    switch (m_spellInfo->Effects[eff].Effect)
+    {
+        case SPELL_EFFECT_RESURRECT_NEW:
+        case SPELL_EFFECT_SKIN_PLAYER_CORPSE:
+        case SPELL_EFFECT_SUMMON_RAF_FRIEND:
+            return false;
+        default:
+            return true;
+    }
+}
+
+WorldObject* Spell::GetLineOfSightReference(uint32& losChecks) const
+{
+    GameObject* gobCaster = nullptr;
+    if (m_originalCasterGUID.IsGameObject())
+    {
+        gobCaster = m_caster->GetMap()->GetGameObject(m_originalCasterGUID);
+    }
+    else if (m_caster->GetEntry() == WORLD_TRIGGER)
+    {
+        if (TempSummon* tempSummon = m_caster->ToTempSummon())
+        {
+            gobCaster = tempSummon->GetSummonerGameObject();
+        }
+    }
+
+    if (!gobCaster)
+    {
+        return m_caster;
+    }
+
+    if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
+    {
+        return nullptr;
+    }
+
+    // If spell casted by gameobject then ignore M2 models
+    losChecks &= ~LINEOFSIGHT_CHECK_GOBJECT_M2;
+    return gobCaster;
+}
+
+void Spell::PrefetchLineOfSight(std::list<WorldObject*> const& targets) const
+{
+    // a single target gains nothing from batching, CheckEffectTarget will do the same ray cast.
+    // without the cache the results would be thrown away and cast again
+    if (targets.size() < 2 || m_spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT) || !Map::IsLineOfSightCacheEnabled())
+        return;
+
+    uint32 losChecks = LINEOFSIGHT_ALL_CHECKS;
+    WorldObject* caster = GetLineOfSightReference(losChecks);
+    if (!caster)
+        return;
+
+    // Same rays as the normal case of CheckEffectTarget, results stay in the map line of sight cache for this tick.
+    // AddUnitTarget checks every effect with the same ray, so one query per target reaching that check
+    std::vector<LineOfSightQuery> queries;
+    queries.reserve(targets.size());
+
+    for (WorldObject* target : targets)
+    {
+        Unit* unit = target->ToUnit();
+        if (!unit || unit == m_caster || !unit->IsInWorld())
+            continue;
+
+        bool reachesCheck = false;
+        for (uint32 effIndex = 0; effIndex < MAX_SPELL_EFFECTS && !reachesCheck; ++effIndex)
+            reachesCheck = ReachesEffectTargetLineOfSight(unit, effIndex);
+
+        if (!reachesCheck)
+            continue;
+
+        if (m_targets.HasDst())
+            queries.push_back(unit->GetLineOfSightQuery(m_targets.GetDstPos()->GetPositionX(), m_targets.GetDstPos()->GetPositionY(), m_targets.GetDstPos()->GetPositionZ()));
+        else if (unit->IsInMap(caster))
+            queries.push_back(unit->GetLineOfSightQuery(caster));
+    }
+
+    // nothing to share a batch with
+    if (queries.size() > 1)
+        m_caster->GetMap()->isInLineOfSight(queries, LineOfSightChecks(losChecks), VMAP::ModelIgnoreFlags::M2);
+}
+
 bool Spell::IsNextMeleeSwingSpell() const
 {
     return m_spellInfo->HasAttribute(SPELL_ATTR0_ON_NEXT_SWING_NO_DAMAGE);
@@ -8285,7 +8380,8 @@ void Spell::LoadScripts()
             continue;
         }
         LOG_DEBUG("spells.aura", "Spell::LoadScripts: Script `{}` for spell `{}` is loaded now", (*itr)->_GetScriptName()->c_str(), m_spellInfo->Id);
-        (*itr)->Register();
+        if (!(*itr)->_HasSharedHooks())
+            (*itr)->Register();
         ++itr;
     }
 }
@@ -20,6 +20,7 @@
 
 #include "GridDefines.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "PathGenerator.h"
 #include "SharedDefines.h"
 #include "SpellInfo.h"
@@ -285,6 +286,8 @@ class WH_GAME_API Spell
     friend void Unit::SetCurrentCastedSpell(Spell* pSpell);
     friend class SpellScript;
 public:
+    WARHEAD_POOLED_OBJECT
+
     Spell(Unit* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, ObjectGuid originalCasterGUID = ObjectGuid::Empty, bool skipCheck = false);
     ~Spell();
 
@@ -487,6 +490,11 @@ public:
     void WriteAmmoToPacket(WorldPacket* data);
 
     bool CheckEffectTarget(Unit const* target, uint32 eff) const;
+    WorldObject* GetLineOfSightReference(uint32& losChecks) const;
+    bool IsEffectTargetLineOfSightIgnored(Unit const* target, uint32 eff) const;
+    // true if CheckEffectTarget gets to its normal line of sight check for this target and effect
+    bool ReachesEffectTargetLineOfSight(Unit const* target, uint32 eff) const;
+    void PrefetchLineOfSight(std::list<WorldObject*> const& targets) const;
     bool CanAutoCast(Unit* target);
     void CheckSrc() { if (!m_targets.HasSrc()) m_targets.SetSrc(*m_caster); }
     void CheckDst() { if (!m_targets.HasDst()) m_targets.SetDst(*m_caster); }
@@ -767,6 +767,60 @@ std::array<SpellEffectInfo::StaticData, TOTAL_SPELL_EFFECTS> SpellEffectInfo::_d
     {EFFECT_IMPLICIT_TARGET_EXPLICIT, TARGET_OBJECT_TYPE_UNIT}, // 164 SPELL_EFFECT_REMOVE_AURA
 } };
 
+SpellHotInfo::SpellHotInfo(SpellInfo const* spellInfo)
+{
+    Id = spellInfo->Id;
+    Attributes = { spellInfo->Attributes, spellInfo->AttributesEx, spellInfo->AttributesEx2, spellInfo->AttributesEx3,
+        spellInfo->AttributesEx4, spellInfo->AttributesEx5, spellInfo->AttributesEx6, spellInfo->AttributesEx7 };
+    AttributesCu = spellInfo->AttributesCu;
+    SchoolMask = spellInfo->SchoolMask;
+    SpellFamilyFlags = spellInfo->SpellFamilyFlags;
+    ProcFlags = spellInfo->ProcFlags;
+    InterruptFlags = spellInfo->InterruptFlags;
+    AuraInterruptFlags = spellInfo->AuraInterruptFlags;
+    ChannelInterruptFlags = spellInfo->ChannelInterruptFlags;
+    ExplicitTargetMask = spellInfo->ExplicitTargetMask;
+    DmgClass = uint8(spellInfo->DmgClass);
+    EquippedItemClass = spellInfo->EquippedItemClass;
+    EquippedItemSubClassMask = spellInfo->EquippedItemSubClassMask;
+    SpellFamilyName = uint8(spellInfo->SpellFamilyName);
+    ProcChance = uint8(spellInfo->ProcChance);
+
+    if (spellInfo->RangeEntry)
+    {
+        RangeId = uint16(spellInfo->RangeEntry->ID);
+        RangeFlags = uint8(spellInfo->RangeEntry->Flags);
+        MinRange = { spellInfo->RangeEntry->RangeMin[0], spellInfo->RangeEntry->RangeMin[1] };
+        MaxRange = { spellInfo->RangeEntry->RangeMax[0], spellInfo->RangeEntry->RangeMax[1] };
+    }
+
+    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+    {
+        SpellEffectInfo const& effect = spellInfo->Effects[i];
+        Effect[i] = uint8(effect.Effect);
+        ApplyAuraName[i] = uint16(effect.ApplyAuraName);
+        TargetA[i] = uint8(effect.TargetA.GetTarget());
+        TargetB[i] = uint8(effect.TargetB.GetTarget());
+
+        if (effect.IsAura())
+            AuraEffectMask |= 1 << i;
+    }
+}
+
+bool SpellHotInfo::HasEffect(SpellEffects effect) const
+{
+    return std::find(Effect.begin(), Effect.end(), uint8(effect)) != Effect.end();
+}
+
+bool SpellHotInfo::HasAura(AuraType aura) const
+{
+    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+        if ((AuraEffectMask & (1 << i)) && ApplyAuraName[i] == aura)
+            return true;
+
+    return false;
+}
+
 SpellInfo::SpellInfo(SpellEntry const* spellEntry)
 {
     Id = spellEntry->Id;
@@ -310,15 +310,66 @@ private:
     static std::array<StaticData, TOTAL_SPELL_EFFECTS> _data;
 };
 
+// Compact copy of the SpellInfo fields read by the cast, range and proc checks, target selection and the
+// aura interrupt loops. SpellMgr keeps one per SpellInfo in a single array, so checks running over many
+// spells do not pull whole SpellInfos (effects alone are ~480 bytes) into the cache. Built once corrections
+// and custom attributes are applied, any later change to these SpellInfo fields must call
+// SpellMgr::UpdateSpellHotInfo.
+struct WH_GAME_API SpellHotInfo
+{
+    SpellHotInfo() = default;
+    explicit SpellHotInfo(SpellInfo const* spellInfo);
+
+    uint32 Id = 0;
+    std::array<uint32, 8> Attributes{};                     // Attributes .. AttributesEx7
+    uint32 AttributesCu = 0;
+    uint32 SchoolMask = 0;
+    flag96 SpellFamilyFlags;
+    uint32 ProcFlags = 0;
+    uint32 InterruptFlags = 0;
+    uint32 AuraInterruptFlags = 0;
+    uint32 ChannelInterruptFlags = 0;
+    uint32 ExplicitTargetMask = 0;
+    std::array<float, 2> MinRange{};                        // [0] hostile [1] friendly
+    std::array<float, 2> MaxRange{};                        // [0] hostile [1] friendly, without spell mods
+    int32 EquippedItemClass = 0;
+    int32 EquippedItemSubClassMask = 0;
+    uint16 RangeId = 0;                                     // 0 without range entry
+    uint8 RangeFlags = 0;
+    uint8 SpellFamilyName = 0;
+    uint8 ProcChance = 0;
+    std::array<uint8, MAX_SPELL_EFFECTS> Effect{};
+    std::array<uint8, MAX_SPELL_EFFECTS> TargetA{};
+    std::array<uint8, MAX_SPELL_EFFECTS> TargetB{};
+    uint8 DmgClass = 0;
+    uint8 AuraEffectMask = 0;                               // effects for which SpellEffectInfo::IsAura is true
+    std::array<uint16, MAX_SPELL_EFFECTS> ApplyAuraName{};
+
+    inline bool HasAttribute(SpellAttr0 attribute) const { return (Attributes[0] & attribute) != 0; }
+    inline bool HasAttribute(SpellAttr1 attribute) const { return (Attributes[1] & attribute) != 0; }
+    inline bool HasAttribute(SpellAttr2 attribute) const { return (Attributes[2] & attribute) != 0; }
+    inline bool HasAttribute(SpellAttr3 attribute) const { return (Attributes[3] & attribute) != 0; }
+    inline bool HasAttribute(SpellAttr4 attribute) const { return (Attributes[4] & attribute) != 0; }
+    inline bool HasAttribute(SpellAttr5 attribute) const { return (Attributes[5] & attribute) != 0; }
+    inline bool HasAttribute(SpellAttr6 attribute) const { return (Attributes[6] & attribute) != 0; }
+    inline bool HasAttribute(SpellAttr7 attribute) const { return (Attributes[7] & attribute) != 0; }
+    inline bool HasAttribute(SpellCustomAttributes customAttribute) const { return (AttributesCu & customAttribute) != 0; }
+
+    inline bool IsChanneled() const { return (Attributes[1] & (SPELL_ATTR1_IS_CHANNELED | SPELL_ATTR1_IS_SELF_CHANNELED)) != 0; }
+
+    bool HasEffect(SpellEffects effect) const;
+    bool HasAura(AuraType aura) const;
+};
+
 class WH_GAME_API SpellInfo
 {
 friend class SpellMgr;
 
 public:
+    // Members are grouped by use: the first block holds what casting checks, proc checks and target
+    // selection read, names, reagents, costs and other data only read when the spell is actually cast
+    // or shown come last. Loops over many spells should read the SpellHotInfo instead.
     uint32 Id;
-    SpellCategoryEntry const* CategoryEntry;
-    uint32 Dispel;
-    uint32 Mechanic;
     uint32 Attributes;
     uint32 AttributesEx;
     uint32 AttributesEx2;
@@ -328,35 +379,47 @@ public:
     uint32 AttributesEx6;
     uint32 AttributesEx7;
     uint32 AttributesCu;
-    uint32 Stances;
-    uint32 StancesNot;
+    uint32 SchoolMask;
+    uint32 DmgClass;
+    uint32 SpellFamilyName;
+    flag96 SpellFamilyFlags;
+    uint32 ProcFlags;
+    uint32 ProcChance;
+    uint32 ProcCharges;
+    uint32 InterruptFlags;
+    uint32 AuraInterruptFlags;
+    uint32 ChannelInterruptFlags;
+    uint32 ExplicitTargetMask;
     uint32 Targets;
     uint32 TargetCreatureType;
-    uint32 RequiresSpellFocus;
+    uint32 Stances;
+    uint32 StancesNot;
     uint32 FacingCasterFlags;
     uint32 CasterAuraState;
     uint32 TargetAuraState;
     uint32 CasterAuraStateNot;
     uint32 TargetAuraStateNot;
+    uint32 Dispel;
+    uint32 Mechanic;
+    uint32 PreventionType;
+    SpellRangeEntry const* RangeEntry;
+    SpellCastTimesEntry const* CastTimeEntry;
+    SpellDurationEntry const* DurationEntry;
+    SpellCategoryEntry const* CategoryEntry;
+    std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
+
     uint32 CasterAuraSpell;
     uint32 TargetAuraSpell;
     uint32 ExcludeCasterAuraSpell;
     uint32 ExcludeTargetAuraSpell;
-    SpellCastTimesEntry const* CastTimeEntry;
+    uint32 RequiresSpellFocus;
     uint32 RecoveryTime;
     uint32 CategoryRecoveryTime;
     uint32 StartRecoveryCategory;
     uint32 StartRecoveryTime;
-    uint32 InterruptFlags;
-    uint32 AuraInterruptFlags;
-    uint32 ChannelInterruptFlags;
-    uint32 ProcFlags;
-    uint32 ProcChance;
-    uint32 ProcCharges;
     uint32 MaxLevel;
     uint32 BaseLevel;
     uint32 SpellLevel;
-    SpellDurationEntry const* DurationEntry;
     uint32 PowerType;
     uint32 ManaCost;
     uint32 ManaCostPerlevel;
@@ -364,7 +427,6 @@ public:
     uint32 ManaPerSecondPerLevel;
     uint32 ManaCostPercentage;
     uint32 RuneCostID;
-    SpellRangeEntry const* RangeEntry;
     float  Speed;
     uint32 StackAmount;
     std::array<uint32, 2> Totem;
@@ -381,14 +443,7 @@ public:
     std::array<char const*, 16> Rank;
     uint32 MaxTargetLevel;
     uint32 MaxAffectedTargets;
-    uint32 SpellFamilyName;
-    flag96 SpellFamilyFlags;
-    uint32 DmgClass;
-    uint32 PreventionType;
     int32  AreaGroupId;
-    uint32 SchoolMask;
-    std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
-    uint32 ExplicitTargetMask;
     SpellChainNode const* ChainEntry;
 
     // Mine
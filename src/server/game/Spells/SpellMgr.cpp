@@ -353,7 +353,7 @@ bool IsDiminishingReturnsGroupDurationLimited(DiminishingGroup group)
     }
 }
 
-SpellMgr::SpellMgr()
+SpellMgr::SpellMgr() : _spellProcGeneration(0)
 {
 }
 
@@ -736,6 +736,24 @@ SpellProcEventEntry const* SpellMgr::GetSpellProcEvent(uint32 spellId) const
     return nullptr;
 }
 
+uint32 SpellMgr::GetSpellProcEventFlags(SpellInfo const* spellInfo) const
+{
+    return SelectSpellProcEventFlags(spellInfo, GetSpellProcEntry(spellInfo->Id), GetSpellProcEvent(spellInfo->Id));
+}
+
+uint32 SpellMgr::SelectSpellProcEventFlags(SpellInfo const* spellInfo, SpellProcEntry const* spellProc, SpellProcEventEntry const* spellProcEvent)
+{
+    // handled by the new proc system
+    if (spellProc)
+        return 0;
+
+    // same choice as in Unit::IsTriggeredAtSpellProcEvent
+    if (spellProcEvent && spellProcEvent->procFlags)
+        return spellProcEvent->procFlags;
+
+    return spellInfo->ProcFlags;
+}
+
 bool SpellMgr::IsSpellProcEventCanTriggeredBy(SpellInfo const* spellProto, SpellProcEventEntry const* spellProcEvent, uint32 EventProcFlag, ProcEventInfo const& eventInfo, bool active) const
 {
     // No extra req need
@@ -764,7 +782,7 @@ bool SpellMgr::IsSpellProcEventCanTriggeredBy(SpellInfo const* spellProto, Spell
             if (EventProcFlag == PROC_FLAG_DONE_PERIODIC)
             {
                 /// no aura with only PROC_FLAG_DONE_PERIODIC and spellFamilyName == 0 can proc from a HOT.
-                if (!spellProto->SpellFamilyName)
+                if (!GetSpellHotInfo(spellProto).SpellFamilyName)
                     return false;
             }
             /// Aura must have positive procflags for a HOT to proc
@@ -813,18 +831,20 @@ bool SpellMgr::IsSpellProcEventCanTriggeredBy(SpellInfo const* spellProto, Spell
         }
         else // For spells need check school/spell family/family mask
         {
+            SpellHotInfo const& procHotInfo = GetSpellHotInfo(procSpellInfo);
+
             // Check (if set) for school
-            if (spellProcEvent->schoolMask && (spellProcEvent->schoolMask & procSpellInfo->SchoolMask) == 0)
+            if (spellProcEvent->schoolMask && (spellProcEvent->schoolMask & procHotInfo.SchoolMask) == 0)
                 return false;
 
             // Check (if set) for spellFamilyName
-            if (spellProcEvent->spellFamilyName && (spellProcEvent->spellFamilyName != procSpellInfo->SpellFamilyName))
+            if (spellProcEvent->spellFamilyName && (spellProcEvent->spellFamilyName != procHotInfo.SpellFamilyName))
                 return false;
 
             // spellFamilyName is Ok need check for spellFamilyMask if present
             if (spellProcEvent->spellFamilyMask)
             {
-                if (!(spellProcEvent->spellFamilyMask & procSpellInfo->SpellFamilyFlags))
+                if (!(spellProcEvent->spellFamilyMask & procHotInfo.SpellFamilyFlags))
                     return false;
                 hasFamilyMask = true;
                 // Some spells are not considered as active even with have spellfamilyflags
@@ -919,10 +939,11 @@ bool SpellMgr::CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry, ProcE
     // check spell family name/flags (if set) for spells
     if (eventInfo.GetTypeMask() & (PERIODIC_PROC_FLAG_MASK | SPELL_PROC_FLAG_MASK | PROC_FLAG_DONE_TRAP_ACTIVATION))
     {
-        if (procEntry.spellFamilyName && (procEntry.spellFamilyName != eventInfo.GetSpellInfo()->SpellFamilyName))
+        SpellHotInfo const& procHotInfo = GetSpellHotInfo(eventInfo.GetSpellInfo());
+        if (procEntry.spellFamilyName && (procEntry.spellFamilyName != procHotInfo.SpellFamilyName))
             return false;
 
-        if (procEntry.spellFamilyMask && !(procEntry.spellFamilyMask & eventInfo.GetSpellInfo()->SpellFamilyFlags))
+        if (procEntry.spellFamilyMask && !(procEntry.spellFamilyMask & procHotInfo.SpellFamilyFlags))
             return false;
     }
 
@@ -1739,6 +1760,7 @@ void SpellMgr::LoadSpellProcEvents()
     uint32 oldMSTime = getMSTime();
 
     mSpellProcEventMap.clear();                             // need for reload case
+    ++_spellProcGeneration;                                 // units rebuild their proc aura index
 
     //                                                0      1           2                3                 4                 5                 6          7       8          9             10       11
     QueryResult result = WorldDatabase.Query("SELECT entry, SchoolMask, SpellFamilyName, SpellFamilyMask0, SpellFamilyMask1, SpellFamilyMask2, procFlags, procEx, procPhase, ppmRate, CustomChance, Cooldown FROM spell_proc_event");
@@ -1833,6 +1855,7 @@ void SpellMgr::LoadSpellProcs()
     uint32 oldMSTime = getMSTime();
 
     mSpellProcMap.clear();                             // need for reload case
+    ++_spellProcGeneration;                            // units rebuild their proc aura index
 
     //                                                 0        1           2                3                 4                 5                 6         7              8               9        10              11             12      13        14
     QueryResult result = WorldDatabase.Query("SELECT spellId, schoolMask, spellFamilyName, spellFamilyMask0, spellFamilyMask1, spellFamilyMask2, typeMask, spellTypeMask, spellPhaseMask, hitMask, attributesMask, ratePerMinute, chance, cooldown, charges FROM spell_proc");
@@ -2710,8 +2733,15 @@ void SpellMgr::LoadSpellInfoStore()
     UnloadSpellInfoStore();
     mSpellInfoMap.resize(sSpellStore.GetNumRows(), nullptr);
 
+    // spells are allocated in one block, neighbouring ids (ranks, triggered spells) share pages and cache lines.
+    // reserved up front, effects keep a pointer to their SpellInfo so the storage must never reallocate
+    mSpellInfoStorage.reserve(std::distance(sSpellStore.begin(), sSpellStore.end()));
+
     for (SpellEntry const* spellEntry : sSpellStore)
-        mSpellInfoMap[spellEntry->Id] = new SpellInfo(spellEntry);
+    {
+        ASSERT(mSpellInfoStorage.size() < mSpellInfoStorage.capacity());
+        mSpellInfoMap[spellEntry->Id] = &mSpellInfoStorage.emplace_back(spellEntry);
+    }
 
     for (uint32 spellIndex = 0; spellIndex < GetSpellInfoStoreSize(); ++spellIndex)
     {
@@ -2734,10 +2764,37 @@ void SpellMgr::LoadSpellInfoStore()
 
 void SpellMgr::UnloadSpellInfoStore()
 {
-    for (uint32 i = 0; i < GetSpellInfoStoreSize(); ++i)
-        delete mSpellInfoMap[i];
-
     mSpellInfoMap.clear();
+    mSpellInfoStorage.clear();
+    mSpellHotInfoStore.clear();
+}
+
+void SpellMgr::LoadSpellHotInfoStore()
+{
+    uint32 oldMSTime = getMSTime();
+
+    mSpellHotInfoStore.clear();
+    mSpellHotInfoStore.reserve(mSpellInfoStorage.size());
+
+    for (SpellInfo const& spellInfo : mSpellInfoStorage)
+        mSpellHotInfoStore.emplace_back(&spellInfo);
+
+    LOG_INFO("server.loading", ">> Loaded {} spell hot infos in {} ms", mSpellHotInfoStore.size(), GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", " ");
+}
+
+SpellHotInfo const& SpellMgr::GetSpellHotInfo(SpellInfo const* spellInfo) const
+{
+    return mSpellHotInfoStore[spellInfo - mSpellInfoStorage.data()];
+}
+
+void SpellMgr::UpdateSpellHotInfo(SpellInfo const* spellInfo)
+{
+    // not built yet, LoadSpellHotInfoStore picks the change up
+    if (mSpellHotInfoStore.empty())
+        return;
+
+    mSpellHotInfoStore[spellInfo - mSpellInfoStorage.data()] = SpellHotInfo(spellInfo);
 }
 
 void SpellMgr::UnloadSpellInfoImplicitTargetConditionLists()
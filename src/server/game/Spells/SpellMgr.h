@@ -26,6 +26,7 @@
 #include "Unit.h"
 
 class SpellInfo;
+struct SpellHotInfo;
 class Player;
 class Unit;
 class ProcEventInfo;
@@ -672,6 +673,12 @@ public:
     // Spell proc event table
     [[nodiscard]] SpellProcEventEntry const* GetSpellProcEvent(uint32 spellId) const;
     bool IsSpellProcEventCanTriggeredBy(SpellInfo const* spellProto, SpellProcEventEntry const* spellProcEvent, uint32 EventProcFlag, ProcEventInfo const& eventInfo, bool active) const;
+    // Proc flags an aura of the spell can proc on in Unit::ProcDamageAndSpellFor, 0 if it never procs there
+    [[nodiscard]] uint32 GetSpellProcEventFlags(SpellInfo const* spellInfo) const;
+    // The same from the spell's entries of both proc tables (nullptr when it has none)
+    [[nodiscard]] static uint32 SelectSpellProcEventFlags(SpellInfo const* spellInfo, SpellProcEntry const* spellProc, SpellProcEventEntry const* spellProcEvent);
+    // Changes every time the proc tables are (re)loaded, flags computed before are stale then
+    [[nodiscard]] uint32 GetSpellProcGeneration() const { return _spellProcGeneration; }
 
     // Spell proc table
     [[nodiscard]] SpellProcEntry const* GetSpellProcEntry(uint32 spellId) const;
@@ -733,6 +740,11 @@ public:
     }
     [[nodiscard]] uint32 GetSpellInfoStoreSize() const { return mSpellInfoMap.size(); }
 
+    // Compact copy of the fields read when checking many spells in a row, see SpellHotInfo
+    [[nodiscard]] SpellHotInfo const& GetSpellHotInfo(SpellInfo const* spellInfo) const;
+    // Must be called after changing a loaded SpellInfo field copied into SpellHotInfo
+    void UpdateSpellHotInfo(SpellInfo const* spellInfo);
+
     // Talent Additional Set
     [[nodiscard]] bool IsAdditionalTalentSpell(uint32 spellId) const;
 
@@ -765,6 +777,7 @@ public:
     void LoadSpellAreas();
     void LoadSpellInfoStore();
     void UnloadSpellInfoStore();
+    void LoadSpellHotInfoStore();
     void UnloadSpellInfoImplicitTargetConditionLists();
     void LoadSpellInfoCustomAttributes();
     void LoadSpellInfoCorrections();
@@ -781,6 +794,7 @@ private:
     SpellGroupStackMap         mSpellGroupStackMap;
     SpellProcEventMap          mSpellProcEventMap;
     SpellProcMap               mSpellProcMap;
+    uint32                     _spellProcGeneration;
     SpellBonusMap              mSpellBonusMap;
     SpellThreatMap             mSpellThreatMap;
     SpellMixologyMap           mSpellMixologyMap;
@@ -797,6 +811,8 @@ private:
     PetLevelupSpellMap         mPetLevelupSpellMap;
     PetDefaultSpellsMap        mPetDefaultSpellsMap;           // only spells not listed in related mPetLevelupSpellMap entry
     SpellInfoMap               mSpellInfoMap;
+    std::vector<SpellInfo>     mSpellInfoStorage;              // backs mSpellInfoMap, one block in spell id order; never grows after loading
+    std::vector<SpellHotInfo>  mSpellHotInfoStore;             // same order as mSpellInfoStorage
     TalentAdditionalSet        mTalentSpellAdditionalSet;
 };
 
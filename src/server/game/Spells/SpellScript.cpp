@@ -355,6 +355,25 @@ bool SpellScript::_Load(Spell* spell)
     return load;
 }
 
+void SpellScript::_ShareHooks(SpellScript const& hooks)
+{
+    BeforeCast = hooks.BeforeCast;
+    OnCast = hooks.OnCast;
+    AfterCast = hooks.AfterCast;
+    OnCheckCast = hooks.OnCheckCast;
+    OnEffectLaunch = hooks.OnEffectLaunch;
+    OnEffectLaunchTarget = hooks.OnEffectLaunchTarget;
+    OnEffectHit = hooks.OnEffectHit;
+    OnEffectHitTarget = hooks.OnEffectHitTarget;
+    BeforeHit = hooks.BeforeHit;
+    OnHit = hooks.OnHit;
+    AfterHit = hooks.AfterHit;
+    OnObjectAreaTargetSelect = hooks.OnObjectAreaTargetSelect;
+    OnObjectTargetSelect = hooks.OnObjectTargetSelect;
+    OnDestinationTargetSelect = hooks.OnDestinationTargetSelect;
+    m_hooksShared = true;
+}
+
 void SpellScript::_InitHit()
 {
     m_hitPreventEffectMask = 0;
@@ -932,6 +951,34 @@ bool AuraScript::_Load(Aura* aura)
     return load;
 }
 
+void AuraScript::_ShareHooks(AuraScript const& hooks)
+{
+    DoCheckAreaTarget = hooks.DoCheckAreaTarget;
+    OnDispel = hooks.OnDispel;
+    AfterDispel = hooks.AfterDispel;
+    OnEffectApply = hooks.OnEffectApply;
+    AfterEffectApply = hooks.AfterEffectApply;
+    OnEffectRemove = hooks.OnEffectRemove;
+    AfterEffectRemove = hooks.AfterEffectRemove;
+    OnEffectPeriodic = hooks.OnEffectPeriodic;
+    OnEffectUpdatePeriodic = hooks.OnEffectUpdatePeriodic;
+    DoEffectCalcAmount = hooks.DoEffectCalcAmount;
+    DoEffectCalcPeriodic = hooks.DoEffectCalcPeriodic;
+    DoEffectCalcSpellMod = hooks.DoEffectCalcSpellMod;
+    OnEffectAbsorb = hooks.OnEffectAbsorb;
+    AfterEffectAbsorb = hooks.AfterEffectAbsorb;
+    OnEffectManaShield = hooks.OnEffectManaShield;
+    AfterEffectManaShield = hooks.AfterEffectManaShield;
+    OnEffectSplit = hooks.OnEffectSplit;
+    DoCheckProc = hooks.DoCheckProc;
+    DoPrepareProc = hooks.DoPrepareProc;
+    OnProc = hooks.OnProc;
+    AfterProc = hooks.AfterProc;
+    OnEffectProc = hooks.OnEffectProc;
+    AfterEffectProc = hooks.AfterEffectProc;
+    m_hooksShared = true;
+}
+
 void AuraScript::_PrepareScriptCall(AuraScriptHookType hookType, AuraApplication const* aurApp)
 {
     m_scriptStates.push(ScriptStateStore(m_currentScriptState, m_auraApplication, m_defaultActionPrevented));
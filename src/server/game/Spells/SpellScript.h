@@ -60,12 +60,14 @@ protected:
     virtual bool _Validate(SpellInfo const* entry);
 
 public:
-    _SpellScript() : m_currentScriptState(SPELL_SCRIPT_STATE_NONE), m_scriptName(nullptr), m_scriptSpellId(0) {}
+    _SpellScript() : m_currentScriptState(SPELL_SCRIPT_STATE_NONE), m_scriptName(nullptr), m_scriptSpellId(0), m_hooksShared(false) {}
     virtual ~_SpellScript() {}
     virtual void _Register();
     virtual void _Unload();
     virtual void _Init(std::string const* scriptname, uint32 spellId);
     std::string const* _GetScriptName() const;
+    // true when the hooks were taken from the instance registered at startup, Register() must not run again
+    bool _HasSharedHooks() const { return m_hooksShared; }
 
 protected:
     class WH_GAME_API EffectHook
@@ -105,6 +107,7 @@ protected:
     uint8 m_currentScriptState;
     std::string const* m_scriptName;
     uint32 m_scriptSpellId;
+    bool m_hooksShared;
 public:
     //
     // SpellScript/AuraScript interface base
@@ -297,6 +300,7 @@ public:
 public:
     bool _Validate(SpellInfo const* entry) override;
     bool _Load(Spell* spell);
+    void _ShareHooks(SpellScript const& hooks);
     void _InitHit();
     bool _IsEffectPrevented(SpellEffIndex effIndex) { return m_hitPreventEffectMask & (1 << effIndex); }
     bool _IsDefaultEffectPrevented(SpellEffIndex effIndex) { return m_hitPreventDefaultEffectMask & (1 << effIndex); }
@@ -678,6 +682,7 @@ public:
     {}
     bool _Validate(SpellInfo const* entry) override;
     bool _Load(Aura* aura);
+    void _ShareHooks(AuraScript const& hooks);
     void _PrepareScriptCall(AuraScriptHookType hookType, AuraApplication const* aurApp = nullptr);
     void _FinishScriptCall();
     bool _IsDefaultActionPrevented();
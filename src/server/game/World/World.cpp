@@ -68,8 +68,10 @@
 #include "MapMgr.h"
 #include "Metric.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
+#include "PacketBudget.h"
 #include "PetitionMgr.h"
 #include "Player.h"
 #include "PlayerDump.h"
@@ -140,6 +142,7 @@ World::World()
     mail_expire_check_timer = 0s;
     m_isClosed = false;
     m_CleaningFlags = 0;
+    _sessionUpdateCursor = 0;
 }
 
 /// World destructor
@@ -669,6 +672,9 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Loading SpellInfo custom attributes...");
     sSpellMgr->LoadSpellInfoCustomAttributes();
 
+    LOG_INFO("server.loading", "Loading SpellInfo hot data...");
+    sSpellMgr->LoadSpellHotInfoStore();
+
     LOG_INFO("server.loading", "Loading GameObject models...");
     LoadGameObjectModelList(m_dataPath);
 
@@ -1096,6 +1102,8 @@ void World::SetInitialWorldSettings()
 
     m_timers[WUPDATE_WHO_LIST].SetInterval(5 * IN_MILLISECONDS); // update who list cache every 5 seconds
 
+    m_timers[WUPDATE_OPCODE_COSTS].SetInterval(MINUTE * IN_MILLISECONDS);
+
     mail_expire_check_timer = GameTime::GetGameTime() + 6h;
 
     ///- Initilize static helper structures
@@ -1317,6 +1325,13 @@ void World::Update(uint32 diff)
         sWhoListCacheMgr->Update();
     }
 
+    ///- Export the opcode processing cost histograms
+    if (m_timers[WUPDATE_OPCODE_COSTS].Passed())
+    {
+        m_timers[WUPDATE_OPCODE_COSTS].Reset();
+        WorldSession::ReportOpcodeCosts();
+    }
+
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Check quest reset times"));
 
@@ -1391,6 +1406,12 @@ void World::Update(uint32 diff)
     // end of section with mutex
     AsyncAuctionListingMgr::SetAuctionListingAllowed(true);
 
+    {
+        /// <li> Deliver the remaining part of broadcasts to big chat channels
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update channel broadcasts"));
+        ChannelMgr::UpdateBroadcasts();
+    }
+
     /// <li> Handle weather updates when the timer has passed
     if (m_timers[WUPDATE_WEATHERS].Passed())
     {
@@ -1409,6 +1430,10 @@ void World::Update(uint32 diff)
         sMapMgr->Update(diff);
     }
 
+    AchievementMgr::ReportDeferredCriteria();
+    Unit::ReportStatUpdates();
+    Warhead::ObjectPool::ReportStats();
+
     if (CONF_GET_BOOL("AutoBroadcast.On"))
     {
         if (m_timers[WUPDATE_AUTOBROADCAST].Passed())
@@ -1520,6 +1545,11 @@ void World::Update(uint32 diff)
         sExternalMail->Update(diff);
     }
 
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update guild bank data"));
+        sGuildMgr->Update(diff);
+    }
+
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update metrics"));
         // Stats logger update
@@ -1802,11 +1832,27 @@ void World::UpdateSessions(uint32 diff)
         }
     }
 
+    static GameConfigOption<uint32> const globalPacketBudget("PacketProcessing.GlobalBudget", 100000);
+
+    // Sessions are visited starting where the packet budget ran out in the previous update,
+    // so the sessions at the end of the order are not the ones that always get deferred
+    _sessionUpdateOrder.clear();
+    _sessionUpdateOrder.reserve(m_sessions.size());
+    for (SessionMap::iterator itr = m_sessions.begin(); itr != m_sessions.end(); ++itr)
+        _sessionUpdateOrder.push_back(itr);
+
+    Microseconds const globalBudget(globalPacketBudget.Get());
+    auto const sessionsStart = std::chrono::steady_clock::now();
+    std::size_t const sessionCount = _sessionUpdateOrder.size();
+    std::size_t const firstSession = sessionCount ? _sessionUpdateCursor % sessionCount : 0;
+    bool budgetSpent = false;
+    uint32 deferredSessions = 0;
+
     ///- Then send an update signal to remaining ones
-    for (SessionMap::iterator itr = m_sessions.begin(), next; itr != m_sessions.end(); itr = next)
+    for (std::size_t i = 0; i < sessionCount; ++i)
     {
-        next = itr;
-        ++next;
+        // erasing from an unordered_map only invalidates the erased iterator
+        SessionMap::iterator itr = _sessionUpdateOrder[(firstSession + i) % sessionCount];
 
         ///- and remove not active sessions from the list
         WorldSession* pSession = itr->second;
@@ -1835,7 +1881,24 @@ void World::UpdateSessions(uint32 diff)
         [[maybe_unused]] uint32 currentSessionId = itr->first;
         METRIC_DETAILED_TIMER("world_update_sessions_time", METRIC_TAG("account_id", std::to_string(currentSessionId)));
 
-        if (!pSession->Update(diff, updater))
+        // Once the global budget is spent the remaining sessions only handle one packet each
+        Microseconds timeBudget = 0us;
+        if (globalBudget > 0us)
+        {
+            Microseconds used = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - sessionsStart);
+            timeBudget = PacketBudget::GetSessionTimeBudget(globalBudget, used);
+            if (used >= globalBudget && !budgetSpent)
+            {
+                budgetSpent = true;
+                _sessionUpdateCursor = (firstSession + i) % sessionCount;
+            }
+        }
+
+        bool active = pSession->Update(diff, updater, timeBudget);
+        if (pSession->HasDeferredPackets())
+            ++deferredSessions;
+
+        if (!active)
         {
             if (!RemoveQueuedPlayer(pSession) && CONF_GET_INT("DisconnectToleranceInterval"))
                 m_disconnects[pSession->GetAccountId()] = GameTime::GetGameTime().count();
@@ -1846,6 +1909,8 @@ void World::UpdateSessions(uint32 diff)
         }
     }
 
+    METRIC_VALUE("world_sessions_deferred", uint64(deferredSessions));
+
     // pussywizard:
     if (m_offlineSessions.empty())
         return;
@@ -118,6 +118,7 @@ enum WorldTimers
     WUPDATE_PINGDB,
     WUPDATE_5_SECS,
     WUPDATE_WHO_LIST,
+    WUPDATE_OPCODE_COSTS,
     WUPDATE_COUNT
 };
 
@@ -391,6 +392,8 @@ private:
 
     SessionMap m_sessions;
     SessionMap m_offlineSessions;
+    std::vector<SessionMap::iterator> _sessionUpdateOrder;   // reused by UpdateSessions()
+    std::size_t _sessionUpdateCursor;                        // position where the packet budget ran out in the last update
     typedef std::unordered_map<uint32, time_t> DisconnectMap;
     DisconnectMap m_disconnects;
     uint32 m_maxActiveSessionCount;
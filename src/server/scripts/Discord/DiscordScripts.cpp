@@ -81,7 +81,7 @@ public:
 class DiscordClient_Player : public PlayerScript
 {
 public:
-    DiscordClient_Player() : PlayerScript("DiscordClient_Player") { }
+    DiscordClient_Player() : PlayerScript("DiscordClient_Player", GetOverriddenHooks<DiscordClient_Player>()) { }
 
     void OnLogin(Player* player) override
     {
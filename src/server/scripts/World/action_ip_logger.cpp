@@ -168,7 +168,7 @@ public:
 class CharacterActionIpLogger : public PlayerScript
 {
 public:
-    CharacterActionIpLogger() : PlayerScript("CharacterActionIpLogger") { }
+    CharacterActionIpLogger() : PlayerScript("CharacterActionIpLogger", GetOverriddenHooks<CharacterActionIpLogger>()) { }
 
     // CHARACTER_CREATE = 7
     void OnCreate(Player* player) override
@@ -255,7 +255,7 @@ public:
 class CharacterDeleteActionIpLogger : public PlayerScript
 {
 public:
-    CharacterDeleteActionIpLogger() : PlayerScript("CharacterDeleteActionIpLogger") { }
+    CharacterDeleteActionIpLogger() : PlayerScript("CharacterDeleteActionIpLogger", GetOverriddenHooks<CharacterDeleteActionIpLogger>()) { }
 
     // CHARACTER_DELETE = 10
     void OnDelete(ObjectGuid guid, uint32 accountId) override
@@ -0,0 +1,133 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuthCryptoPool.h"
+#include "Log.h"
+
+AuthCryptoPool& AuthCryptoPool::Instance()
+{
+    static AuthCryptoPool instance;
+    return instance;
+}
+
+void AuthCryptoPool::Start(uint32 numThreads, uint32 maxQueued)
+{
+    _maxQueued = maxQueued;
+    _lastStats = std::chrono::steady_clock::now();
+
+    _workerThreads.reserve(numThreads);
+    for (uint32 i = 0; i < numThreads; ++i)
+        _workerThreads.push_back(std::thread(&AuthCryptoPool::WorkerThread, this));
+
+    if (numThreads)
+        LOG_INFO("server.authserver", "Started {} crypto worker threads (max queued logons: {})", numThreads, maxQueued);
+}
+
+void AuthCryptoPool::Stop()
+{
+    // Queued logons still have sessions waiting on their futures, so let the workers run everything queued
+    // before they reach the null tasks that stop them. Cancel() would delete the tasks and break the promises
+    for (std::size_t i = 0; i < _workerThreads.size(); ++i)
+        _queue.Push(nullptr);
+
+    for (auto& thread : _workerThreads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+
+    _workerThreads.clear();
+
+    // Anything pushed behind the null tasks runs here, the network is stopped before the pool
+    Task* task = nullptr;
+    while (_queue.Pop(task))
+    {
+        if (!task)
+            continue;
+
+        --_queued;
+        task->Work();
+        delete task;
+
+        ++_inlineTasks;
+    }
+}
+
+std::future<void> AuthCryptoPool::Enqueue(std::function<void()>&& work)
+{
+    Task* task = new Task{ std::packaged_task<void()>(std::move(work)), std::chrono::steady_clock::now() };
+    std::future<void> result = task->Work.get_future();
+
+    if (_workerThreads.empty() || _queued.fetch_add(1) >= _maxQueued)
+    {
+        if (!_workerThreads.empty())
+            --_queued;
+
+        task->Work();
+        delete task;
+
+        ++_inlineTasks;
+        return result;
+    }
+
+    _queue.Push(task);
+    return result;
+}
+
+void AuthCryptoPool::LogStats()
+{
+    auto now = std::chrono::steady_clock::now();
+    float seconds = std::chrono::duration<float>(now - _lastStats).count();
+    _lastStats = now;
+
+    uint64 pooled = _pooledTasks.exchange(0);
+    uint64 inlined = _inlineTasks.exchange(0);
+    uint64 waitTime = _totalWaitTime.exchange(0);
+    uint64 maxWaitTime = _maxWaitTime.exchange(0);
+
+    if (!pooled && !inlined)
+        return;
+
+    LOG_INFO("server.authserver", "Crypto: {:.1f} tasks/s ({} pooled, {} inline), queue wait avg {}us max {}us, {} queued",
+        seconds > 0.0f ? (pooled + inlined) / seconds : 0.0f, pooled, inlined, pooled ? waitTime / pooled : 0, maxWaitTime, _queued.load());
+}
+
+void AuthCryptoPool::WorkerThread()
+{
+    while (true)
+    {
+        Task* task = nullptr;
+
+        _queue.WaitAndPop(task);
+
+        if (!task)
+            return;
+
+        --_queued;
+
+        uint64 waitTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - task->QueuedAt).count();
+        _totalWaitTime += waitTime;
+
+        uint64 maxWaitTime = _maxWaitTime.load();
+        while (waitTime > maxWaitTime && !_maxWaitTime.compare_exchange_weak(maxWaitTime, waitTime));
+
+        task->Work();
+        delete task;
+
+        ++_pooledTasks;
+    }
+}
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AuthCryptoPool_h__
+#define AuthCryptoPool_h__
+
+#include "Define.h"
+#include "PCQueue.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <thread>
+#include <vector>
+
+/*
+ * Runs the SRP6 big number math of logons away from the network thread.
+ *
+ * AuthSession polls the returned future in Update() and continues on the
+ * network thread, so only the work itself has to be thread safe. When the
+ * queue is full (or the pool is disabled) the work runs on the calling
+ * thread, which throttles the network thread instead of queueing forever.
+ * Stop() runs whatever is still queued, so every returned future gets ready.
+ */
+class WH_SHARED_API AuthCryptoPool
+{
+public:
+    static AuthCryptoPool& Instance();
+
+    void Start(uint32 numThreads, uint32 maxQueued);
+    void Stop();
+
+    std::future<void> Enqueue(std::function<void()>&& work);
+
+    // Logs throughput and queue waits since the previous call
+    void LogStats();
+
+private:
+    struct Task
+    {
+        std::packaged_task<void()> Work;
+        std::chrono::steady_clock::time_point QueuedAt;
+    };
+
+    void WorkerThread();
+
+    std::vector<std::thread> _workerThreads;
+    ProducerConsumerQueue<Task*> _queue;
+    std::atomic<uint32> _queued{ 0 };
+    uint32 _maxQueued{ 0 };
+
+    std::atomic<uint64> _pooledTasks{ 0 };
+    std::atomic<uint64> _inlineTasks{ 0 };
+    std::atomic<uint64> _totalWaitTime{ 0 }; // microseconds
+    std::atomic<uint64> _maxWaitTime{ 0 };   // microseconds
+    std::chrono::steady_clock::time_point _lastStats;
+};
+
+#define sAuthCryptoPool AuthCryptoPool::Instance()
+
+#endif // AuthCryptoPool_h__
@@ -24,7 +24,7 @@
 #include "Util.h"
 #include <boost/asio/ip/tcp.hpp>
 
-RealmList::RealmList() : _updateInterval(0) { }
+RealmList::RealmList() : _realms(std::make_shared<RealmMap const>()), _updateInterval(0) { }
 
 RealmList* RealmList::Instance()
 {
@@ -81,12 +81,12 @@ void RealmList::LoadBuildInfo()
     }
 }
 
-void RealmList::UpdateRealm(RealmHandle const& id, uint32 build, std::string const& name,
+void RealmList::UpdateRealm(RealmMap& realms, RealmHandle const& id, uint32 build, std::string const& name,
     boost::asio::ip::address && address, boost::asio::ip::address && localAddr, boost::asio::ip::address && localSubmask,
     uint16 port, uint8 icon, RealmFlags flag, uint8 timezone, AccountTypes allowedSecurityLevel, float population)
 {
     // Create new if not exist or update existed
-    Realm& realm = _realms[id];
+    Realm& realm = realms[id];
 
     realm.Id = id;
     realm.Build = build;
@@ -120,10 +120,10 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
     PreparedQueryResult result = LoginDatabase.Query(stmt);
 
     std::map<RealmHandle, std::string> existingRealms;
-    for (auto const& p : _realms)
+    for (auto const& p : *GetRealms())
         existingRealms[p.first] = p.second.Name;
 
-    _realms.clear();
+    std::shared_ptr<RealmMap> realms = std::make_shared<RealmMap>();
 
     // Circle through results and add them to the realm map
     if (result)
@@ -177,7 +177,7 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
 
                 RealmHandle id{ realmId };
 
-                UpdateRealm(id, build, name, externalAddress->address(), localAddress->address(), localSubmask->address(), port, icon, flag,
+                UpdateRealm(*realms, id, build, name, externalAddress->address(), localAddress->address(), localSubmask->address(), port, icon, flag,
                     timezone, (allowedSecurityLevel <= SEC_ADMINISTRATOR ? AccountTypes(allowedSecurityLevel) : SEC_ADMINISTRATOR), pop);
 
                 if (!existingRealms.count(id))
@@ -198,6 +198,11 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
     for (auto itr = existingRealms.begin(); itr != existingRealms.end(); ++itr)
         LOG_INFO("server.authserver", "Removed realm \"{}\".", itr->second);
 
+    {
+        std::lock_guard<std::mutex> guard(_realmsLock);
+        _realms = std::move(realms);
+    }
+
     if (_updateInterval)
     {
         _updateTimer->expires_from_now(boost::posix_time::seconds(_updateInterval));
@@ -205,11 +210,19 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
     }
 }
 
-Realm const* RealmList::GetRealm(RealmHandle const& id) const
+std::shared_ptr<RealmList::RealmMap const> RealmList::GetRealms() const
 {
-    auto itr = _realms.find(id);
-    if (itr != _realms.end())
-        return &itr->second;
+    std::lock_guard<std::mutex> guard(_realmsLock);
+    return _realms;
+}
+
+std::shared_ptr<Realm const> RealmList::GetRealm(RealmHandle const& id) const
+{
+    std::shared_ptr<RealmMap const> realms = GetRealms();
+
+    auto itr = realms->find(id);
+    if (itr != realms->end())
+        return std::shared_ptr<Realm const>(realms, &itr->second);
 
     return nullptr;
 }
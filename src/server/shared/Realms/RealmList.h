@@ -22,6 +22,8 @@
 #include "Realm.h"
 #include <array>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <unordered_set>
 #include <vector>
 
@@ -52,8 +54,9 @@ public:
     void Initialize(Warhead::Asio::IoContext& ioContext, uint32 updateInterval);
     void Close();
 
-    [[nodiscard]] RealmMap const& GetRealms() const { return _realms; }
-    [[nodiscard]] Realm const* GetRealm(RealmHandle const& id) const;
+    // Every update publishes a new map, so holders of the previous one are never disturbed
+    [[nodiscard]] std::shared_ptr<RealmMap const> GetRealms() const;
+    [[nodiscard]] std::shared_ptr<Realm const> GetRealm(RealmHandle const& id) const; // keeps its realm list update alive
 
     [[nodiscard]] RealmBuildInfo const* GetBuildInfo(uint32 build) const;
 
@@ -63,12 +66,13 @@ private:
 
     void LoadBuildInfo();
     void UpdateRealms(boost::system::error_code const& error);
-    void UpdateRealm(RealmHandle const& id, uint32 build, std::string const& name,
+    void UpdateRealm(RealmMap& realms, RealmHandle const& id, uint32 build, std::string const& name,
         boost::asio::ip::address&& address, boost::asio::ip::address&& localAddr, boost::asio::ip::address&& localSubmask,
         uint16 port, uint8 icon, RealmFlags flag, uint8 timezone, AccountTypes allowedSecurityLevel, float population);
 
     std::vector<RealmBuildInfo> _builds;
-    RealmMap _realms;
+    std::shared_ptr<RealmMap const> _realms;
+    mutable std::mutex _realmsLock;
     uint32 _updateInterval{0};
     std::unique_ptr<Warhead::Asio::DeadlineTimer> _updateTimer;
     std::unique_ptr<Warhead::Asio::Resolver> _resolver;
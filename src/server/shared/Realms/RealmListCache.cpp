@@ -0,0 +1,88 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RealmListCache.h"
+
+Optional<RealmCharacterCountMap> CharacterCountCache::Get(uint32 accountId, Clock::time_point now /*= Clock::now()*/) const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    auto itr = _counts.find(accountId);
+    if (itr == _counts.end() || itr->second.ExpireTime < now)
+        return {};
+
+    return itr->second.Counts;
+}
+
+void CharacterCountCache::Store(uint32 accountId, RealmCharacterCountMap const& characterCounts, Seconds cacheTime, Clock::time_point now /*= Clock::now()*/)
+{
+    if (cacheTime <= 0s)
+        return;
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    _counts[accountId] = { characterCounts, now + cacheTime };
+
+    // drop accounts which went away now and then, the cache would only grow otherwise
+    if (++_inserts % 1024 == 0)
+    {
+        for (auto itr = _counts.begin(); itr != _counts.end();)
+        {
+            if (itr->second.ExpireTime < now)
+                itr = _counts.erase(itr);
+            else
+                ++itr;
+        }
+    }
+}
+
+void CharacterCountCache::Clear(uint32 accountId)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _counts.erase(accountId);
+}
+
+std::size_t CharacterCountCache::GetSize() const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _counts.size();
+}
+
+ByteBuffer RealmListPacketCache::Get(uint16 build, uint8 expansion, AccountTypes security, std::shared_ptr<RealmList::RealmMap const> const& realms,
+    RealmCharacterCountMap const& characterCounts, BuildFunction const& buildPacket)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    CachedPacket& cached = _packets[{ build, expansion, security }];
+    if (cached.Realms != realms)
+    {
+        cached.Realms = realms;
+        cached.Positions.clear();
+        cached.Packet = buildPacket(cached.Positions);
+    }
+
+    ByteBuffer packet = cached.Packet;
+
+    for (auto const& [position, realmId] : cached.Positions)
+    {
+        auto itr = characterCounts.find(realmId);
+        if (itr != characterCounts.end())
+            packet.put<uint8>(position, itr->second);
+    }
+
+    return packet;
+}
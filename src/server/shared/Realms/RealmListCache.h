@@ -0,0 +1,79 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _REALMLISTCACHE_H
+#define _REALMLISTCACHE_H
+
+#include "ByteBuffer.h"
+#include "Duration.h"
+#include "Optional.h"
+#include "RealmList.h"
+#include <functional>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+typedef std::map<uint32 /*realm id*/, uint8 /*characters*/> RealmCharacterCountMap;
+
+/// Character counts of accounts, kept for a while since clients ask for the realm list again and again. Thread safe
+class WH_SHARED_API CharacterCountCache
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    [[nodiscard]] Optional<RealmCharacterCountMap> Get(uint32 accountId, Clock::time_point now = Clock::now()) const;
+    void Store(uint32 accountId, RealmCharacterCountMap const& characterCounts, Seconds cacheTime, Clock::time_point now = Clock::now());
+    void Clear(uint32 accountId);
+
+    [[nodiscard]] std::size_t GetSize() const;
+
+private:
+    struct CachedCounts
+    {
+        RealmCharacterCountMap Counts;
+        Clock::time_point ExpireTime;
+    };
+
+    mutable std::mutex _lock;
+    std::unordered_map<uint32 /*account id*/, CachedCounts> _counts;
+    uint32 _inserts{ 0 };
+};
+
+/// Realm list packets as seen by clients outside of the realms' local networks, one per build, expansion flags
+/// and security level. Built once per realm list update, requests get a copy with their character counts. Thread safe
+class WH_SHARED_API RealmListPacketCache
+{
+public:
+    typedef std::vector<std::pair<std::size_t /*packet position*/, uint32 /*realm id*/>> CharacterCountPositions;
+    typedef std::function<ByteBuffer(CharacterCountPositions& characterCountPositions)> BuildFunction;
+
+    [[nodiscard]] ByteBuffer Get(uint16 build, uint8 expansion, AccountTypes security, std::shared_ptr<RealmList::RealmMap const> const& realms,
+        RealmCharacterCountMap const& characterCounts, BuildFunction const& buildPacket);
+
+private:
+    struct CachedPacket
+    {
+        std::shared_ptr<RealmList::RealmMap const> Realms; // realm list update the packet was built from
+        ByteBuffer Packet;
+        CharacterCountPositions Positions;
+    };
+
+    std::mutex _lock;
+    std::map<std::tuple<uint16, uint8, AccountTypes>, CachedPacket> _packets;
+};
+
+#endif
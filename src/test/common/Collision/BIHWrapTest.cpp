@@ -0,0 +1,294 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BoundingIntervalHierarchyWrapper.h"
+#include "G3D/AABox.h"
+#include "G3D/Ray.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <random>
+#include <set>
+
+namespace
+{
+    struct TestModel
+    {
+        uint32 Id;
+        G3D::AABox Bounds;
+    };
+}
+
+template<> struct BoundsTrait<TestModel>
+{
+    static void GetBounds(TestModel const& model, G3D::AABox& out) { out = model.Bounds; }
+    static void GetBounds2(TestModel const* model, G3D::AABox& out) { out = model->Bounds; }
+};
+
+namespace
+{
+    using TestTree = BIHWrap<TestModel>;
+
+    // Collects every model hit, never shortens the ray
+    struct CollectCallback
+    {
+        std::set<uint32> Hits;
+
+        bool operator()(G3D::Ray const& ray, TestModel const& model, float& maxDist, bool /*stopAtFirstHit*/)
+        {
+            if (ray.intersectionTime(model.Bounds) <= maxDist)
+                Hits.insert(model.Id);
+
+            return false;
+        }
+
+        void operator()(G3D::Vector3 const& point, TestModel const& model)
+        {
+            if (model.Bounds.contains(point))
+                Hits.insert(model.Id);
+        }
+    };
+
+    class BIHWrapTest : public ::testing::Test
+    {
+    protected:
+        static constexpr uint32 ModelCount = 200;
+        static constexpr float WorldSize = 200.0f;
+
+        void SetUp() override
+        {
+            std::uniform_real_distribution<float> position(0.0f, WorldSize);
+            std::uniform_real_distribution<float> extent(2.0f, 20.0f);
+
+            _models.resize(ModelCount);
+            for (uint32 i = 0; i < ModelCount; ++i)
+            {
+                G3D::Vector3 low(position(_random), position(_random), position(_random));
+                _models[i] = { i, G3D::AABox(low, low + G3D::Vector3(extent(_random), extent(_random), extent(_random))) };
+            }
+        }
+
+        uint32 RandomInsertedModel()
+        {
+            auto itr = _inserted.begin();
+            std::advance(itr, _random() % _inserted.size());
+            return *itr;
+        }
+
+        // aimed at a random inserted model, so most rays cross a few of them
+        G3D::Ray RandomRay()
+        {
+            std::uniform_real_distribution<float> position(0.0f, WorldSize);
+            G3D::Vector3 origin(position(_random), position(_random), position(_random));
+            G3D::Vector3 target = _models[_inserted.empty() ? 0 : RandomInsertedModel()].Bounds.center();
+            if (target == origin)
+                target += G3D::Vector3::unitX();
+
+            return G3D::Ray::fromOriginAndDirection(origin, (target - origin).direction());
+        }
+
+        std::set<uint32> BruteForceRay(G3D::Ray const& ray, float maxDist) const
+        {
+            std::set<uint32> hits;
+            for (uint32 id : _inserted)
+                if (ray.intersectionTime(_models[id].Bounds) <= maxDist)
+                    hits.insert(id);
+
+            return hits;
+        }
+
+        std::set<uint32> BruteForcePoint(G3D::Vector3 const& point) const
+        {
+            std::set<uint32> hits;
+            for (uint32 id : _inserted)
+                if (_models[id].Bounds.contains(point))
+                    hits.insert(id);
+
+            return hits;
+        }
+
+        void ExpectMatchesBruteForce(TestTree& tree)
+        {
+            for (uint32 i = 0; i < 20; ++i)
+            {
+                G3D::Ray ray = RandomRay();
+                float maxDist = WorldSize;
+                CollectCallback callback;
+                tree.intersectRay(ray, callback, maxDist, false);
+                EXPECT_EQ(callback.Hits, BruteForceRay(ray, WorldSize));
+            }
+
+            // points inside models, so the point queries hit something
+            for (uint32 i = 0; i < 20 && !_inserted.empty(); ++i)
+            {
+                G3D::Vector3 point = _models[RandomInsertedModel()].Bounds.center();
+
+                CollectCallback callback;
+                tree.intersectPoint(point, callback);
+                EXPECT_EQ(callback.Hits, BruteForcePoint(point));
+            }
+        }
+
+        void Insert(TestTree& tree, uint32 id)
+        {
+            tree.insert(_models[id]);
+            _inserted.insert(id);
+        }
+
+        void Remove(TestTree& tree, uint32 id)
+        {
+            tree.remove(_models[id]);
+            _inserted.erase(id);
+        }
+
+        std::mt19937 _random{ 42 };
+        std::vector<TestModel> _models;
+        std::set<uint32> _inserted;
+    };
+}
+
+TEST_F(BIHWrapTest, SmallCellWithoutTree)
+{
+    TestTree tree;
+    for (uint32 i = 0; i < 5; ++i)
+        Insert(tree, i);
+
+    tree.balance();
+    ExpectMatchesBruteForce(tree);
+
+    Remove(tree, 2);
+    ExpectMatchesBruteForce(tree);
+}
+
+TEST_F(BIHWrapTest, InsertAndRemoveAfterBalance)
+{
+    TestTree tree;
+    for (uint32 i = 0; i < 100; ++i)
+        Insert(tree, i);
+
+    tree.balance();
+    ExpectMatchesBruteForce(tree);
+
+    // removed slots of the tree and the unindexed tail
+    for (uint32 i = 0; i < 100; i += 7)
+        Remove(tree, i);
+
+    for (uint32 i = 100; i < 105; ++i)
+        Insert(tree, i);
+
+    Remove(tree, 101);
+    Remove(tree, 104);
+    ExpectMatchesBruteForce(tree);
+
+    tree.balance();
+    ExpectMatchesBruteForce(tree);
+}
+
+TEST_F(BIHWrapTest, DuplicateInsertAndUnknownRemove)
+{
+    TestTree tree;
+    for (uint32 i = 0; i < 20; ++i)
+        Insert(tree, i);
+
+    Insert(tree, 3);
+    Remove(tree, 50);
+    tree.balance();
+
+    G3D::Vector3 point = _models[3].Bounds.center();
+    CollectCallback callback;
+    tree.intersectPoint(point, callback);
+    EXPECT_EQ(callback.Hits, BruteForcePoint(point));
+}
+
+TEST_F(BIHWrapTest, RandomUpdatesMatchBruteForce)
+{
+    TestTree tree;
+    for (uint32 i = 0; i < ModelCount / 2; ++i)
+        Insert(tree, i);
+
+    std::uniform_int_distribution<uint32> model(0, ModelCount - 1);
+    for (uint32 step = 0; step < 300; ++step)
+    {
+        uint32 id = model(_random);
+        if (_inserted.count(id))
+            Remove(tree, id);
+        else
+            Insert(tree, id);
+
+        if (step % 50 == 0)
+            tree.balance();
+
+        if (step % 10 == 0)
+            ExpectMatchesBruteForce(tree);
+    }
+
+    ExpectMatchesBruteForce(tree);
+}
+
+// Moves one model per step (a door or transport changing its collision) and casts a few rays, once with the
+// incremental updates and once rebuilding the cell on every change like before. Timing only, so it is disabled:
+// run it with --gtest_also_run_disabled_tests, the times are test properties in the --gtest_output=xml report.
+TEST_F(BIHWrapTest, DISABLED_MovingModelBenchmark)
+{
+    constexpr uint32 Steps = 20000;
+    constexpr uint32 CellModels = 60;
+
+    for (uint32 i = 0; i < CellModels; ++i)
+        _inserted.insert(i);
+
+    std::vector<G3D::Ray> rays;
+    for (uint32 i = 0; i < 5; ++i)
+        rays.push_back(RandomRay());
+
+    auto measure = [&](bool rebuildOnChange)
+    {
+        TestTree tree;
+        for (uint32 i = 0; i < CellModels; ++i)
+            tree.insert(_models[i]);
+
+        tree.balance();
+
+        uint32 hits = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 step = 0; step < Steps; ++step)
+        {
+            TestModel const& moved = _models[step % CellModels];
+            tree.remove(moved);
+            tree.insert(moved);
+
+            if (rebuildOnChange)
+                tree.balance();
+
+            for (G3D::Ray const& ray : rays)
+            {
+                float maxDist = WorldSize;
+                CollectCallback callback;
+                tree.intersectRay(ray, callback, maxDist, false);
+                hits += callback.Hits.size();
+            }
+        }
+
+        return std::make_pair(hits, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    auto [rebuildHits, rebuildTime] = measure(true);
+    auto [incrementalHits, incrementalTime] = measure(false);
+
+    EXPECT_EQ(rebuildHits, incrementalHits);
+
+    RecordProperty("RebuildMicroseconds", std::to_string(rebuildTime));
+    RecordProperty("IncrementalMicroseconds", std::to_string(incrementalTime));
+}
@@ -0,0 +1,195 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Containers.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <random>
+#include <unordered_map>
+
+namespace
+{
+    // Stands in for a HostileReference: a victim and its threat
+    struct ThreatEntry
+    {
+        uint64 Victim;
+        float Threat;
+    };
+
+    // Highest threat first, like Warhead::ThreatOrderPred
+    struct ThreatOrder
+    {
+        bool operator()(ThreatEntry const* a, ThreatEntry const* b) const { return a->Threat > b->Threat; }
+    };
+
+    using ThreatList = std::list<ThreatEntry*>;
+
+    std::vector<uint64> Victims(ThreatList const& list)
+    {
+        std::vector<uint64> victims;
+        for (ThreatEntry const* entry : list)
+            victims.push_back(entry->Victim);
+
+        return victims;
+    }
+
+    // Sorts a copy with list::sort, the reference for order and stability
+    std::vector<uint64> ListSorted(ThreatList list)
+    {
+        list.sort(ThreatOrder());
+        return Victims(list);
+    }
+}
+
+TEST(ContainersTest, SortNearlySortedFewChanged)
+{
+    std::vector<ThreatEntry> entries;
+    for (uint32 i = 0; i < 40; ++i)
+        entries.push_back({ i, float(1000 - i * 10) });
+
+    ThreatList list;
+    for (ThreatEntry& entry : entries)
+        list.push_back(&entry);
+
+    // a heal on the tank's list moves one victim up, a fade moves one down, two end up with equal threat
+    entries[30].Threat = 995.0f;
+    entries[2].Threat = 0.0f;
+    entries[20].Threat = entries[10].Threat;
+
+    std::vector<uint64> expected = ListSorted(list);
+    Warhead::Containers::SortNearlySorted(list, ThreatOrder());
+    EXPECT_EQ(Victims(list), expected);
+}
+
+TEST(ContainersTest, SortNearlySortedKeepsIterators)
+{
+    std::vector<ThreatEntry> entries;
+    for (uint32 i = 0; i < 10; ++i)
+        entries.push_back({ i, float(i) });
+
+    ThreatList list;
+    std::unordered_map<uint64, ThreatList::iterator> index;
+    for (ThreatEntry& entry : entries)
+        index.emplace(entry.Victim, list.insert(list.end(), &entry));
+
+    Warhead::Containers::SortNearlySorted(list, ThreatOrder());
+
+    EXPECT_EQ(list.front()->Victim, 9u);
+    for (ThreatEntry const& entry : entries)
+        EXPECT_EQ(*index[entry.Victim], &entry);
+}
+
+TEST(ContainersTest, SortNearlySortedRandomOrder)
+{
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> threat(0, 50); // many equal keys to check stability
+
+    for (uint32 size : { 0, 1, 2, 3, 10, 100, 1000 })
+    {
+        std::vector<ThreatEntry> entries;
+        for (uint32 i = 0; i < size; ++i)
+            entries.push_back({ i, float(threat(random)) });
+
+        ThreatList list;
+        for (ThreatEntry& entry : entries)
+            list.push_back(&entry);
+
+        std::vector<uint64> expected = ListSorted(list);
+        Warhead::Containers::SortNearlySorted(list, ThreatOrder());
+        EXPECT_EQ(Victims(list), expected) << "size " << size;
+    }
+}
+
+// A raid sized threat list where a few victims change threat between two target selections, looked up by
+// guid through the index and re-sorted, against the previous linear lookup and full sort. Also times the
+// reversed list, the worst case that falls back to list::sort. Timing only, opt in with
+// --gtest_also_run_disabled_tests and read the times from the --gtest_output=xml properties.
+TEST(ContainersTest, DISABLED_ThreatListBenchmark)
+{
+    constexpr uint32 VictimCount = 40;
+    constexpr uint32 Steps = 200000;
+
+    std::mt19937 random(42);
+    std::uniform_int_distribution<uint32> victim(0, VictimCount - 1);
+    std::uniform_real_distribution<float> threat(0.0f, 500.0f);
+
+    auto measure = [&](bool indexed)
+    {
+        std::vector<ThreatEntry> entries;
+        for (uint32 i = 0; i < VictimCount; ++i)
+            entries.push_back({ i * 7919ull, 0.0f });
+
+        ThreatList list;
+        std::unordered_map<uint64, ThreatList::iterator> index;
+        for (ThreatEntry& entry : entries)
+            index.emplace(entry.Victim, list.insert(list.end(), &entry));
+
+        random.seed(42);
+        uint64 top = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 step = 0; step < Steps; ++step)
+        {
+            for (uint32 i = 0; i < 3; ++i)
+            {
+                uint64 guid = victim(random) * 7919ull;
+                ThreatEntry* entry = nullptr;
+                if (indexed)
+                    entry = *index.find(guid)->second;
+                else
+                    entry = *std::find_if(list.begin(), list.end(), [guid](ThreatEntry const* ref) { return ref->Victim == guid; });
+
+                entry->Threat += threat(random);
+            }
+
+            if (indexed)
+                Warhead::Containers::SortNearlySorted(list, ThreatOrder());
+            else
+                list.sort(ThreatOrder());
+
+            top += list.front()->Victim;
+        }
+
+        return std::make_pair(top, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    auto [scanTop, scanTime] = measure(false);
+    auto [indexTop, indexTime] = measure(true);
+    EXPECT_EQ(scanTop, indexTop);
+
+    // worst case for the insertion pass, every element is out of order
+    std::vector<ThreatEntry> entries;
+    for (uint32 i = 0; i < 20000; ++i)
+        entries.push_back({ i, float(i) });
+
+    ThreatList reversed;
+    for (ThreatEntry& entry : entries)
+        reversed.push_back(&entry);
+
+    ThreatList reversedCopy = reversed;
+    auto start = std::chrono::steady_clock::now();
+    Warhead::Containers::SortNearlySorted(reversed, ThreatOrder());
+    int64 reversedTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    reversedCopy.sort(ThreatOrder());
+    int64 reversedSortTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(Victims(reversed), Victims(reversedCopy));
+
+    RecordProperty("ScanAndSortMicroseconds", std::to_string(scanTime));
+    RecordProperty("IndexAndNearlySortedMicroseconds", std::to_string(indexTime));
+    RecordProperty("ReversedNearlySortedMicroseconds", std::to_string(reversedTime));
+    RecordProperty("ReversedSortMicroseconds", std::to_string(reversedSortTime));
+}
@@ -0,0 +1,314 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FlatMap.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using Warhead::FlatMap;
+
+TEST(FlatMapTest, InsertKeepsKeyOrder)
+{
+    FlatMap<uint8_t, int> map;
+    for (uint8_t key : { 5, 1, 9, 3, 7 })
+        EXPECT_TRUE(map.insert({ key, key * 10 }).second);
+
+    EXPECT_EQ(map.size(), 5u);
+
+    uint8_t previous = 0;
+    for (auto const& [key, value] : map)
+    {
+        EXPECT_LT(previous, key);
+        EXPECT_EQ(value, key * 10);
+        previous = key;
+    }
+}
+
+TEST(FlatMapTest, InsertExistingKeyKeepsValue)
+{
+    FlatMap<uint8_t, int> map;
+    map.insert({ 3, 30 });
+
+    auto [itr, inserted] = map.insert({ 3, 99 });
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(itr->second, 30);
+    EXPECT_EQ(map.size(), 1u);
+}
+
+TEST(FlatMapTest, FindAndCount)
+{
+    FlatMap<uint8_t, int> map;
+    map[2] = 20;
+    map[4] = 40;
+
+    EXPECT_EQ(map.find(4)->second, 40);
+    EXPECT_EQ(map.find(3), map.end());
+    EXPECT_EQ(map.find(5), map.end());
+    EXPECT_EQ(map.count(2), 1u);
+    EXPECT_EQ(map.count(1), 0u);
+
+    FlatMap<uint8_t, int> const& constMap = map;
+    EXPECT_EQ(constMap.find(2)->second, 20);
+    EXPECT_EQ(constMap.find(0), constMap.end());
+}
+
+TEST(FlatMapTest, SubscriptInsertsDefault)
+{
+    FlatMap<uint8_t, std::string> map;
+    EXPECT_TRUE(map[0].empty());
+    EXPECT_EQ(map.size(), 1u);
+
+    map[1] = "one";
+    EXPECT_EQ(map[1], "one");
+    EXPECT_EQ(map.size(), 2u);
+}
+
+TEST(FlatMapTest, Erase)
+{
+    FlatMap<uint8_t, int> map;
+    for (uint8_t key = 0; key < 10; ++key)
+        map[key] = key;
+
+    EXPECT_EQ(map.erase(4), 1u);
+    EXPECT_EQ(map.erase(4), 0u);
+    EXPECT_EQ(map.find(4), map.end());
+
+    // erase by iterator returns the next entry, like std::map
+    auto itr = map.erase(map.find(5));
+    ASSERT_NE(itr, map.end());
+    EXPECT_EQ(itr->first, 6);
+    EXPECT_EQ(map.size(), 8u);
+
+    // erase while walking, the pattern used when removing visible auras
+    for (auto itr = map.begin(); itr != map.end();)
+    {
+        if (itr->first % 2)
+            itr = map.erase(itr);
+        else
+            ++itr;
+    }
+
+    for (auto const& [key, value] : map)
+        EXPECT_EQ(key % 2, 0);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(FlatMapTest, LowerBound)
+{
+    FlatMap<uint8_t, int> map;
+    map[10] = 1;
+    map[20] = 2;
+
+    EXPECT_EQ(map.lower_bound(5)->first, 10);
+    EXPECT_EQ(map.lower_bound(10)->first, 10);
+    EXPECT_EQ(map.lower_bound(15)->first, 20);
+    EXPECT_EQ(map.lower_bound(25), map.end());
+}
+
+TEST(FlatMapTest, CustomCompare)
+{
+    FlatMap<int, int, std::greater<int>> map;
+    map[1] = 1;
+    map[3] = 3;
+    map[2] = 2;
+
+    EXPECT_EQ(map.begin()->first, 3);
+    EXPECT_EQ(map.find(2)->second, 2);
+    EXPECT_EQ(map.find(4), map.end());
+}
+
+// Reports the cost of the visible aura pattern (fill up to MAX_AURAS slots, look up, walk for client updates,
+// free slots) with std::map and with FlatMap. Timing only, so it is disabled: run it with
+// --gtest_also_run_disabled_tests, the times are test properties in the --gtest_output=xml report.
+TEST(FlatMapTest, DISABLED_VisibleAuraPatternBenchmark)
+{
+    constexpr uint32_t Units = 2000;
+    constexpr uint32_t Rounds = 50;
+    constexpr uint8_t MaxAuras = 64;
+
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> slot(0, MaxAuras - 1);
+
+    auto measure = [&](auto map)
+    {
+        std::vector<decltype(map)> maps(Units);
+        uint64_t sum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t round = 0; round < Rounds; ++round)
+        {
+            for (auto& unitMap : maps)
+            {
+                for (uint8_t i = 0; i < 8; ++i)
+                    unitMap[uint8_t(slot(random))] = round;
+
+                for (uint8_t i = 0; i < 8; ++i)
+                {
+                    auto itr = unitMap.find(uint8_t(slot(random)));
+                    if (itr != unitMap.end())
+                        sum += itr->second;
+                }
+
+                for (auto const& [key, value] : unitMap)
+                    sum += key;
+
+                unitMap.erase(uint8_t(slot(random)));
+            }
+        }
+
+        return std::make_pair(sum, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    random.seed(42);
+    auto [treeSum, treeTime] = measure(std::map<uint8_t, uint32_t>());
+    random.seed(42);
+    auto [flatSum, flatTime] = measure(FlatMap<uint8_t, uint32_t>());
+
+    EXPECT_EQ(treeSum, flatSum);
+
+    RecordProperty("MapMicroseconds", std::to_string(treeTime));
+    RecordProperty("FlatMapMicroseconds", std::to_string(flatTime));
+}
+
+// The owned aura pattern of a raid: every unit carries a few dozen auras keyed by spell id from several casters,
+// walks them on each update dropping the expired ones, looks auras up by spell and re-applies or refreshes
+// them. Compares the multimap of Unit::m_ownedAuras with a FlatMap keyed by spell and caster. Timing only, so it
+// is disabled: run it with --gtest_also_run_disabled_tests, the times are test properties in the
+// --gtest_output=xml report.
+TEST(FlatMapTest, DISABLED_OwnedAuraPatternBenchmark)
+{
+    constexpr uint32_t Units = 2000;
+    constexpr uint32_t Rounds = 50;
+    constexpr uint32_t AurasPerUnit = 40;
+    constexpr uint32_t Lookups = 20;
+
+    std::mt19937 random(42);
+    std::uniform_int_distribution<uint32_t> spell(1, 200);
+    std::uniform_int_distribution<uint32_t> caster(0, 4);
+    std::uniform_int_distribution<int32_t> duration(1, 30);
+
+    // Stands in for an Aura: its caster and remaining duration
+    struct OwnedAura
+    {
+        uint32_t Caster;
+        int32_t Duration;
+    };
+
+    using AuraTree = std::multimap<uint32_t, OwnedAura>;
+    using AuraFlat = FlatMap<std::pair<uint32_t, uint32_t>, OwnedAura>;
+
+    auto measureTree = [&]()
+    {
+        std::vector<AuraTree> units(Units);
+        uint64_t sum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t round = 0; round < Rounds; ++round)
+        {
+            for (AuraTree& auras : units)
+            {
+                for (auto itr = auras.begin(); itr != auras.end();)
+                {
+                    if (--itr->second.Duration <= 0)
+                        itr = auras.erase(itr);
+                    else
+                        ++itr;
+                }
+
+                for (uint32_t i = 0; i < Lookups; ++i)
+                {
+                    auto range = auras.equal_range(spell(random));
+                    for (auto itr = range.first; itr != range.second; ++itr)
+                        sum += itr->second.Duration;
+                }
+
+                while (auras.size() < AurasPerUnit)
+                {
+                    uint32_t spellId = spell(random);
+                    OwnedAura aura{ caster(random), duration(random) };
+
+                    auto range = auras.equal_range(spellId);
+                    auto itr = std::find_if(range.first, range.second, [&aura](AuraTree::value_type const& pair) { return pair.second.Caster == aura.Caster; });
+                    if (itr != range.second)
+                        itr->second.Duration = aura.Duration;
+                    else
+                        auras.emplace(spellId, aura);
+                }
+            }
+        }
+
+        return std::make_pair(sum, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    auto measureFlat = [&]()
+    {
+        std::vector<AuraFlat> units(Units);
+        uint64_t sum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t round = 0; round < Rounds; ++round)
+        {
+            for (AuraFlat& auras : units)
+            {
+                for (auto itr = auras.begin(); itr != auras.end();)
+                {
+                    if (--itr->second.Duration <= 0)
+                        itr = auras.erase(itr);
+                    else
+                        ++itr;
+                }
+
+                for (uint32_t i = 0; i < Lookups; ++i)
+                {
+                    uint32_t spellId = spell(random);
+                    for (auto itr = auras.lower_bound({ spellId, 0 }); itr != auras.end() && itr->first.first == spellId; ++itr)
+                        sum += itr->second.Duration;
+                }
+
+                while (auras.size() < AurasPerUnit)
+                {
+                    uint32_t spellId = spell(random);
+                    OwnedAura aura{ caster(random), duration(random) };
+
+                    auto [itr, inserted] = auras.insert({ { spellId, aura.Caster }, aura });
+                    if (!inserted)
+                        itr->second.Duration = aura.Duration;
+                }
+            }
+        }
+
+        return std::make_pair(sum, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    random.seed(42);
+    auto [treeSum, treeTime] = measureTree();
+    random.seed(42);
+    auto [flatSum, flatTime] = measureFlat();
+
+    EXPECT_EQ(treeSum, flatSum);
+
+    RecordProperty("MultimapMicroseconds", std::to_string(treeTime));
+    RecordProperty("FlatMapMicroseconds", std::to_string(flatTime));
+}
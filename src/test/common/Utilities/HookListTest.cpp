@@ -0,0 +1,110 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Util.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace
+{
+    template<typename T>
+    std::vector<T> Items(HookList<T>& list)
+    {
+        return std::vector<T>(list.begin(), list.end());
+    }
+}
+
+TEST(HookListTest, EmptyList)
+{
+    HookList<int> list;
+    EXPECT_EQ(list.size(), 0u);
+    EXPECT_EQ(list.begin(), list.end());
+
+    HookList<int> copy = list;
+    copy += 1;
+    EXPECT_EQ(list.size(), 0u);
+    EXPECT_EQ(Items(copy), (std::vector<int>{ 1 }));
+}
+
+TEST(HookListTest, CopiesShareTheTable)
+{
+    HookList<int> registered;
+    registered += 1;
+    registered += 2;
+
+    HookList<int> first = registered;
+    HookList<int> second = registered;
+
+    // no copy of the table until one of them changes
+    EXPECT_EQ(&*first.begin(), &*registered.begin());
+    EXPECT_EQ(&*second.begin(), &*registered.begin());
+    EXPECT_EQ(Items(first), (std::vector<int>{ 1, 2 }));
+}
+
+TEST(HookListTest, ModifiedCopyLeavesSharedTable)
+{
+    HookList<int> registered;
+    registered += 1;
+    registered += 2;
+
+    HookList<int> added = registered;
+    HookList<int> removed = registered;
+    HookList<int> untouched = registered;
+
+    added += 3;
+    removed -= 1;
+
+    EXPECT_EQ(Items(registered), (std::vector<int>{ 1, 2 }));
+    EXPECT_EQ(Items(added), (std::vector<int>{ 1, 2, 3 }));
+    EXPECT_EQ(Items(removed), (std::vector<int>{ 2 }));
+    EXPECT_EQ(Items(untouched), (std::vector<int>{ 1, 2 }));
+    EXPECT_EQ(&*untouched.begin(), &*registered.begin());
+    EXPECT_NE(&*added.begin(), &*registered.begin());
+}
+
+TEST(HookListTest, ModifiedSourceLeavesCopies)
+{
+    HookList<int> registered;
+    registered += 1;
+
+    HookList<int> copy = registered;
+    registered += 2;
+    registered -= 1;
+
+    EXPECT_EQ(Items(registered), (std::vector<int>{ 2 }));
+    EXPECT_EQ(Items(copy), (std::vector<int>{ 1 }));
+}
+
+TEST(HookListTest, AssignedListIsShared)
+{
+    HookList<int> registered;
+    registered += 1;
+
+    HookList<int> script;
+    script += 5;
+    script = registered; // what _ShareHooks does
+
+    EXPECT_EQ(Items(script), (std::vector<int>{ 1 }));
+    EXPECT_EQ(&*script.begin(), &*registered.begin());
+
+    // the last owner modifies in place
+    HookList<int> alone;
+    alone += 1;
+    int* first = &*alone.begin();
+    alone += 2;
+    EXPECT_EQ(&*alone.begin(), first);
+}
@@ -0,0 +1,186 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+#include "gtest/gtest.h"
+#include <future>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace Warhead;
+
+namespace
+{
+    // Every test runs on a fresh thread so it starts with empty free lists
+    template<class Test>
+    void RunOnNewThread(Test&& test)
+    {
+        std::thread thread(std::forward<Test>(test));
+        thread.join();
+    }
+
+    struct PooledObject
+    {
+        WARHEAD_POOLED_OBJECT
+
+        virtual ~PooledObject() = default;
+
+        uint8 Data[100];
+    };
+
+    struct LargerPooledObject : PooledObject
+    {
+        uint8 MoreData[400];
+    };
+}
+
+TEST(ObjectPoolTest, ReusesBlockOfSameSizeClass)
+{
+    RunOnNewThread([]()
+    {
+        void* first = ObjectPool::Allocate(100);
+        ObjectPool::Deallocate(first, 100);
+        EXPECT_EQ(ObjectPool::GetThreadCachedBlocks(100), 1u);
+
+        // 100 and 120 bytes share the 128 byte class
+        void* second = ObjectPool::Allocate(120);
+        EXPECT_EQ(second, first);
+        EXPECT_EQ(ObjectPool::GetThreadCachedBlocks(100), 0u);
+
+        // other classes do not see the block
+        ObjectPool::Deallocate(second, 120);
+        void* other = ObjectPool::Allocate(200);
+        EXPECT_NE(other, first);
+        EXPECT_EQ(ObjectPool::GetThreadCachedBlocks(120), 1u);
+
+        ObjectPool::Deallocate(other, 200);
+    });
+}
+
+TEST(ObjectPoolTest, FreeListIsCapped)
+{
+    RunOnNewThread([]()
+    {
+        std::vector<void*> blocks;
+        for (uint32 i = 0; i < 300; ++i)
+            blocks.push_back(ObjectPool::Allocate(64));
+
+        for (void* block : blocks)
+            ObjectPool::Deallocate(block, 64);
+
+        EXPECT_EQ(ObjectPool::GetThreadCachedBlocks(64), 256u);
+
+        // the cached blocks come back first, latest freed first
+        std::set<void*> cached(blocks.begin(), blocks.begin() + 256);
+        for (uint32 i = 0; i < 256; ++i)
+        {
+            void* block = ObjectPool::Allocate(64);
+            EXPECT_EQ(block, blocks[255 - i]);
+            EXPECT_TRUE(cached.count(block));
+        }
+
+        EXPECT_EQ(ObjectPool::GetThreadCachedBlocks(64), 0u);
+
+        for (uint32 i = 0; i < 256; ++i)
+            ObjectPool::Deallocate(blocks[i], 64);
+    });
+}
+
+TEST(ObjectPoolTest, OversizedIsNotCached)
+{
+    RunOnNewThread([]()
+    {
+        void* block = ObjectPool::Allocate(5000);
+        ObjectPool::Deallocate(block, 5000);
+        EXPECT_EQ(ObjectPool::GetThreadCachedBlocks(5000), 0u);
+    });
+}
+
+TEST(ObjectPoolTest, FreeOnOtherThreadIsCachedThere)
+{
+    RunOnNewThread([]()
+    {
+        std::vector<void*> blocks;
+        for (uint32 i = 0; i < 10; ++i)
+            blocks.push_back(ObjectPool::Allocate(256));
+
+        // deferred deletion on another thread, like a map thread freeing a spell of the world thread
+        std::thread other([&blocks]()
+        {
+            for (void* block : blocks)
+                ObjectPool::Deallocate(block, 256);
+
+            EXPECT_EQ(ObjectPool::GetThreadCachedBlocks(256), 10u);
+
+            void* reused = ObjectPool::Allocate(256);
+            EXPECT_EQ(reused, blocks.back());
+            ObjectPool::Deallocate(reused, 256);
+        });
+        other.join();
+
+        EXPECT_EQ(ObjectPool::GetThreadCachedBlocks(256), 0u);
+    });
+}
+
+TEST(ObjectPoolTest, ReleasedOnThreadExit)
+{
+    int64 cachedBefore = ObjectPool::GetCachedBytes();
+
+    std::promise<void> cached;
+    std::promise<void> release;
+    std::thread thread([&]()
+    {
+        std::vector<void*> blocks;
+        for (uint32 i = 0; i < 20; ++i)
+            blocks.push_back(ObjectPool::Allocate(1024));
+
+        for (void* block : blocks)
+            ObjectPool::Deallocate(block, 1024);
+
+        cached.set_value();
+        release.get_future().wait();
+    });
+
+    cached.get_future().wait();
+    EXPECT_EQ(ObjectPool::GetCachedBytes(), cachedBefore + 20 * 1024);
+
+    release.set_value();
+    thread.join();
+    EXPECT_EQ(ObjectPool::GetCachedBytes(), cachedBefore);
+}
+
+// WARHEAD_POOLED_OBJECT is empty when the pools are disabled
+#ifndef WARHEAD_DISABLE_OBJECT_POOLS
+TEST(ObjectPoolTest, PooledObjectsUseRealSize)
+{
+    RunOnNewThread([]()
+    {
+        PooledObject* object = new LargerPooledObject();
+        void* address = object;
+        delete object;
+
+        // freed through the virtual destructor with the size of the derived class
+        EXPECT_EQ(ObjectPool::GetThreadCachedBlocks(sizeof(LargerPooledObject)), 1u);
+        EXPECT_EQ(ObjectPool::GetThreadCachedBlocks(sizeof(PooledObject)), 0u);
+
+        LargerPooledObject* reused = new LargerPooledObject();
+        EXPECT_EQ(static_cast<void*>(reused), address);
+        delete reused;
+    });
+}
+#endif
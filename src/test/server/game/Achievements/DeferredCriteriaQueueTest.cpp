@@ -0,0 +1,147 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DeferredCriteriaQueue.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <limits>
+#include <map>
+
+namespace
+{
+    // Stands in for the criteria progress AchievementMgr::UpdateAchievementCriteria keeps: the highest
+    // value or the running total of a type
+    struct CriteriaProgress
+    {
+        std::map<AchievementCriteriaTypes, uint64> Values;
+        uint32 Updates = 0;
+
+        void Update(AchievementCriteriaTypes type, uint32 value)
+        {
+            ++Updates;
+            if (type == ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED || type == ACHIEVEMENT_CRITERIA_TYPE_TOTAL_HEALING_RECEIVED)
+                Values[type] += value;
+            else
+                Values[type] = std::max<uint64>(Values[type], value);
+        }
+    };
+
+    // Stands in for AchievementMgr::SaveToDB: pending events are evaluated before the progress is written
+    std::map<AchievementCriteriaTypes, uint64> SaveProgress(DeferredCriteriaQueue& queue, CriteriaProgress& progress)
+    {
+        queue.Flush([&progress](AchievementCriteriaTypes type, uint32 value) { progress.Update(type, value); });
+        return progress.Values;
+    }
+}
+
+TEST(DeferredCriteriaQueueTest, FoldsHighestAndTotal)
+{
+    DeferredCriteriaQueue queue;
+    CriteriaProgress folded;
+    CriteriaProgress direct;
+
+    uint32 hits[] = { 1200, 4800, 300, 4799, 2500 };
+    for (uint32 hit : hits)
+    {
+        queue.Add(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_DEALT, hit);
+        queue.Add(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED, hit);
+        direct.Update(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_DEALT, hit);
+        direct.Update(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED, hit);
+    }
+
+    // one event per type
+    EXPECT_EQ(queue.GetSize(), 2u);
+    EXPECT_EQ(queue.Flush([&folded](AchievementCriteriaTypes type, uint32 value) { folded.Update(type, value); }), 2u);
+    EXPECT_TRUE(queue.IsEmpty());
+
+    EXPECT_EQ(folded.Updates, 2u);
+    EXPECT_EQ(folded.Values, direct.Values);
+    EXPECT_EQ(folded.Values[ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_DEALT], 4800u);
+    EXPECT_EQ(folded.Values[ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED], 13599u);
+}
+
+TEST(DeferredCriteriaQueueTest, TotalSaturates)
+{
+    constexpr uint32 Max = std::numeric_limits<uint32>::max();
+
+    DeferredCriteriaQueue queue;
+    queue.Add(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_HEALING_RECEIVED, Max - 10);
+    queue.Add(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_HEALING_RECEIVED, 5);
+    queue.Add(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_HEALING_RECEIVED, 100);
+    queue.Add(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_HEALING_RECEIVED, Max);
+
+    // the highest types never add up
+    queue.Add(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEALING_RECEIVED, Max - 1);
+    queue.Add(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEALING_RECEIVED, 2);
+
+    std::map<AchievementCriteriaTypes, uint32> values;
+    queue.Flush([&values](AchievementCriteriaTypes type, uint32 value) { values[type] = value; });
+
+    EXPECT_EQ(values[ACHIEVEMENT_CRITERIA_TYPE_TOTAL_HEALING_RECEIVED], Max);
+    EXPECT_EQ(values[ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEALING_RECEIVED], Max - 1);
+}
+
+TEST(DeferredCriteriaQueueTest, OnlyValueCriteriaFold)
+{
+    for (AchievementCriteriaTypes type : { ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_DEALT, ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_RECEIVED,
+        ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEAL_CASTED, ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEALING_RECEIVED,
+        ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED, ACHIEVEMENT_CRITERIA_TYPE_TOTAL_HEALING_RECEIVED })
+        EXPECT_TRUE(DeferredCriteriaQueue::CanFold(type)) << type;
+
+    // counted per event or checked against the target of the event, AchievementMgr passes them on right away
+    for (AchievementCriteriaTypes type : { ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE, ACHIEVEMENT_CRITERIA_TYPE_DAMAGE_DONE,
+        ACHIEVEMENT_CRITERIA_TYPE_HEALING_DONE, ACHIEVEMENT_CRITERIA_TYPE_TOTAL })
+        EXPECT_FALSE(DeferredCriteriaQueue::CanFold(type)) << type;
+}
+
+TEST(DeferredCriteriaQueueTest, SaveFlushesPendingEvents)
+{
+    DeferredCriteriaQueue queue;
+    CriteriaProgress progress;
+
+    queue.Add(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEAL_CASTED, 9000);
+    queue.Add(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED, 150);
+
+    std::map<AchievementCriteriaTypes, uint64> saved = SaveProgress(queue, progress);
+    EXPECT_EQ(saved[ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEAL_CASTED], 9000u);
+    EXPECT_EQ(saved[ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED], 150u);
+    EXPECT_TRUE(queue.IsEmpty());
+
+    // a second save in the same update doesn't count the events again
+    saved = SaveProgress(queue, progress);
+    EXPECT_EQ(saved[ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED], 150u);
+    EXPECT_EQ(progress.Updates, 2u);
+}
+
+TEST(DeferredCriteriaQueueTest, EventsRaisedWhileFlushingWait)
+{
+    DeferredCriteriaQueue queue;
+    queue.Add(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED, 10);
+
+    // like completing an achievement that raises a new event from UpdateAchievementCriteria
+    std::size_t flushed = queue.Flush([&queue](AchievementCriteriaTypes /*type*/, uint32 /*value*/)
+    {
+        queue.Add(ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED, 20);
+    });
+
+    EXPECT_EQ(flushed, 1u);
+    ASSERT_EQ(queue.GetSize(), 1u);
+
+    uint32 pending = 0;
+    queue.Flush([&pending](AchievementCriteriaTypes /*type*/, uint32 value) { pending = value; });
+    EXPECT_EQ(pending, 20u);
+}
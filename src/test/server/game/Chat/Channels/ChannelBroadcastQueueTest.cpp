@@ -0,0 +1,138 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ChannelBroadcastQueue.h"
+#include "gtest/gtest.h"
+#include <map>
+
+namespace
+{
+    ObjectGuid Member(uint32 counter)
+    {
+        return ObjectGuid::Create<HighGuid::Player>(counter);
+    }
+
+    GuidVector Members(uint32 first, uint32 count)
+    {
+        GuidVector members;
+        for (uint32 i = 0; i < count; ++i)
+            members.push_back(Member(first + i));
+
+        return members;
+    }
+
+    // Opcodes received by each member, in order
+    struct Received
+    {
+        std::map<ObjectGuid, std::vector<uint16>> Packets;
+        uint32 Total = 0;
+
+        ChannelBroadcastQueue::SendFunction Send()
+        {
+            return [this](ObjectGuid recipient, WorldPacket const& packet)
+            {
+                Packets[recipient].push_back(packet.GetOpcode());
+                ++Total;
+            };
+        }
+    };
+}
+
+TEST(ChannelBroadcastQueueTest, DeliversInChunks)
+{
+    ChannelBroadcastQueue queue;
+    queue.Push(WorldPacket(1), Members(1, 10));
+    EXPECT_EQ(queue.GetSize(), 1u);
+
+    Received received;
+    uint32 budget = 4;
+    queue.Deliver(budget, received.Send());
+    EXPECT_EQ(budget, 0u);
+    EXPECT_EQ(received.Total, 4u);
+    EXPECT_EQ(queue.GetSize(), 1u);
+    EXPECT_FALSE(queue.HasQueued(Member(1)));
+    EXPECT_TRUE(queue.HasQueued(Member(5)));
+
+    budget = 10;
+    queue.Deliver(budget, received.Send());
+    EXPECT_EQ(budget, 4u);
+    EXPECT_EQ(received.Total, 10u);
+    EXPECT_TRUE(queue.IsEmpty());
+
+    for (uint32 i = 1; i <= 10; ++i)
+    {
+        EXPECT_EQ(received.Packets[Member(i)], std::vector<uint16>{ 1 });
+        EXPECT_FALSE(queue.HasQueued(Member(i)));
+    }
+}
+
+TEST(ChannelBroadcastQueueTest, BudgetSpansBroadcasts)
+{
+    ChannelBroadcastQueue queue;
+    queue.Push(WorldPacket(1), Members(1, 3));
+    queue.Push(WorldPacket(2), Members(1, 3));
+    queue.Push(WorldPacket(3), {});
+    EXPECT_EQ(queue.GetSize(), 2u);
+
+    Received received;
+    uint32 budget = 5;
+    queue.Deliver(budget, received.Send());
+    EXPECT_EQ(queue.GetSize(), 1u);
+    EXPECT_TRUE(queue.HasQueued(Member(3)));
+    EXPECT_FALSE(queue.HasQueued(Member(2)));
+
+    budget = 1;
+    queue.Deliver(budget, received.Send());
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_EQ(received.Total, 6u);
+}
+
+// A notice for one member or a broadcast sent while a broadcast is still queued for some members: the ones
+// with nothing queued may get it at once (what the channel does), the others only through the queue
+TEST(ChannelBroadcastQueueTest, KeepsOrderPerMember)
+{
+    ChannelBroadcastQueue queue;
+    Received received;
+
+    // first broadcast reached members 1-2 at once, 3-6 wait
+    received.Send()(Member(1), WorldPacket(1));
+    received.Send()(Member(2), WorldPacket(1));
+    queue.Push(WorldPacket(1), Members(3, 4));
+
+    // notice for member 4 and a broadcast to everyone
+    for (uint16 opcode : { 2, 3 })
+    {
+        GuidVector deferred;
+        for (ObjectGuid member : (opcode == 2 ? Members(4, 1) : Members(1, 6)))
+        {
+            if (queue.HasQueued(member))
+                deferred.push_back(member);
+            else
+                received.Send()(member, WorldPacket(opcode));
+        }
+
+        queue.Push(WorldPacket(opcode), std::move(deferred));
+    }
+
+    for (uint32 budget = 1; !queue.IsEmpty(); budget = 1)
+        queue.Deliver(budget, received.Send());
+
+    EXPECT_EQ(received.Packets[Member(1)], (std::vector<uint16>{ 1, 3 }));
+    EXPECT_EQ(received.Packets[Member(3)], (std::vector<uint16>{ 1, 3 }));
+    EXPECT_EQ(received.Packets[Member(4)], (std::vector<uint16>{ 1, 2, 3 }));
+    EXPECT_EQ(received.Packets[Member(6)], (std::vector<uint16>{ 1, 3 }));
+}
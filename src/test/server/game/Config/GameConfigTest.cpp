@@ -0,0 +1,156 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Config.h"
+#include "GameConfig.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace
+{
+    constexpr uint32 BenchmarkOptions = 700;
+
+    // Options of these tests, in a config file of their own
+    class GameConfigTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            static bool const loaded = LoadOptions();
+            ASSERT_TRUE(loaded);
+        }
+
+    private:
+        static bool LoadOptions()
+        {
+            std::string fileName = (std::filesystem::temp_directory_path() / "GameConfigTest.conf").string();
+
+            {
+                std::ofstream file(fileName + ".dist");
+                file << "GameConfigTest.Int = 42\n";
+                file << "GameConfigTest.Float = 2.5\n";
+                file << "GameConfigTest.Text = \"some text\"\n";
+
+                for (uint32 i = 0; i < BenchmarkOptions; ++i)
+                    file << "GameConfigTest.Benchmark." << i << " = " << i << "\n";
+            }
+
+            sConfigMgr->Configure(fileName, {});
+            bool loaded = sConfigMgr->LoadAppConfigs();
+            std::filesystem::remove(fileName + ".dist");
+            if (!loaded)
+                return false;
+
+            sGameConfig->AddOption<int32>("GameConfigTest.Int");
+            sGameConfig->AddOption<float>("GameConfigTest.Float");
+            sGameConfig->AddOption<std::string>("GameConfigTest.Text");
+
+            for (uint32 i = 0; i < BenchmarkOptions; ++i)
+                sGameConfig->AddOption<int32>("GameConfigTest.Benchmark." + std::to_string(i));
+
+            return true;
+        }
+    };
+}
+
+TEST_F(GameConfigTest, HandleReadsParsedValue)
+{
+    static GameConfigOption<int32> const intOption("GameConfigTest.Int");
+    static GameConfigOption<float> const floatOption("GameConfigTest.Float");
+    static GameConfigOption<std::string> const textOption("GameConfigTest.Text");
+
+    EXPECT_EQ(intOption.Get(), 42);
+    EXPECT_EQ(floatOption.Get(), 2.5f);
+    EXPECT_EQ(textOption.Get(), "some text");
+
+    // the same slot read as another type
+    EXPECT_EQ(sGameConfig->GetOption<uint32>("GameConfigTest.Int"), 42u);
+    EXPECT_EQ(CONF_GET_INT("GameConfigTest.Int"), 42);
+}
+
+TEST_F(GameConfigTest, MissingOptionUsesDefault)
+{
+    static GameConfigOption<uint32> const handle("GameConfigTest.Missing.Handle", 7);
+
+    EXPECT_EQ(handle.Get(), 7u);
+    EXPECT_EQ(handle.Get(), 7u);
+    EXPECT_EQ(sGameConfig->GetOption<int32>("GameConfigTest.Missing.Name", 3), 3);
+    EXPECT_EQ(CONF_GET_BOOL("GameConfigTest.Missing.Literal"), false);
+    EXPECT_EQ(CONF_GET_FLOAT("GameConfigTest.Missing.Literal"), 1.0f);
+
+    // not added to the published options until the next load
+    std::string name = "GameConfigTest.Missing.Name";
+    EXPECT_EQ(CONF_GET_INT(name), 0);
+}
+
+TEST_F(GameConfigTest, SetOptionReachesHandlesOnAllThreads)
+{
+    static GameConfigOption<int32> const handle("GameConfigTest.Benchmark.5");
+    EXPECT_EQ(handle.Get(), 5);
+
+    sGameConfig->SetOption<int32>("GameConfigTest.Benchmark.5", 500);
+    EXPECT_EQ(handle.Get(), 500);
+
+    int32 otherThread = 0;
+    std::thread([&otherThread]() { otherThread = handle.Get(); }).join();
+    EXPECT_EQ(otherThread, 500);
+
+    sGameConfig->SetOption<int32>("GameConfigTest.Benchmark.5", 5);
+    EXPECT_EQ(handle.Get(), 5);
+}
+
+// Reads every option of a config sized set by name from the config manager (string copy, hash lookup and
+// parse per read, the cost of the former GameConfig::GetOption), by name from the parsed options and through
+// handles. Timing only, so it is disabled: run it with --gtest_also_run_disabled_tests, the times are test
+// properties in the --gtest_output=xml report.
+TEST_F(GameConfigTest, DISABLED_OptionLookupBenchmark)
+{
+    constexpr uint32 Rounds = 2000;
+
+    std::vector<std::string> names;
+    std::vector<std::unique_ptr<GameConfigOption<int32>>> handles;
+    for (uint32 i = 0; i < BenchmarkOptions; ++i)
+        names.emplace_back("GameConfigTest.Benchmark." + std::to_string(i));
+
+    for (std::string const& name : names)
+        handles.emplace_back(std::make_unique<GameConfigOption<int32>>(name));
+
+    auto measure = [&](auto read)
+    {
+        int64 sum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 round = 0; round < Rounds; ++round)
+            for (uint32 i = 0; i < BenchmarkOptions; ++i)
+                sum += read(i);
+
+        return std::make_pair(sum, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    auto [configSum, configTime] = measure([&](uint32 i) { return sConfigMgr->GetOption<int32>(std::string(names[i]), 0); });
+    auto [nameSum, nameTime] = measure([&](uint32 i) { return sGameConfig->GetOption<int32>(names[i]); });
+    auto [handleSum, handleTime] = measure([&](uint32 i) { return handles[i]->Get(); });
+
+    EXPECT_EQ(configSum, nameSum);
+    EXPECT_EQ(nameSum, handleSum);
+
+    RecordProperty("ConfigMgrMicroseconds", std::to_string(configTime));
+    RecordProperty("NameMicroseconds", std::to_string(nameTime));
+    RecordProperty("HandleMicroseconds", std::to_string(handleTime));
+}
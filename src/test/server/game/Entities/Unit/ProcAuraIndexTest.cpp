@@ -0,0 +1,238 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ProcAuraIndex.h"
+#include "DBCStructure.h"
+#include "SpellInfo.h"
+#include "SpellMgr.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <random>
+#include <unordered_map>
+
+namespace
+{
+    // Stands in for an AuraApplication
+    struct TestApplication
+    {
+        uint32 SpellId;
+    };
+
+    typedef ProcAuraIndex<TestApplication> TestIndex;
+
+    std::vector<TestApplication const*> Applications(TestIndex const& index)
+    {
+        std::vector<TestApplication const*> applications;
+        for (auto const& [spellId, entry] : index)
+            applications.push_back(entry.Application);
+
+        return applications;
+    }
+}
+
+TEST(ProcAuraIndexTest, IndexesProcAurasInAppliedOrder)
+{
+    TestApplication blessing{ 20217 }, seal{ 20375 }, sealOther{ 20375 }, trinket{ 33648 };
+    TestIndex index;
+
+    index.Add(seal.SpellId, PROC_FLAG_DONE_MELEE_AUTO_ATTACK, &seal);
+    index.Add(blessing.SpellId, 0, &blessing);       // never procs
+    index.Add(trinket.SpellId, PROC_FLAG_DONE_SPELL_MAGIC_DMG_CLASS_NEG, &trinket);
+    index.Add(sealOther.SpellId, PROC_FLAG_DONE_MELEE_AUTO_ATTACK, &sealOther);
+
+    // by spell id, then in application order, like the applied aura multimap
+    EXPECT_EQ(Applications(index), std::vector<TestApplication const*>({ &seal, &sealOther, &trinket }));
+    EXPECT_EQ(index.GetProcFlags(), uint32(PROC_FLAG_DONE_MELEE_AUTO_ATTACK | PROC_FLAG_DONE_SPELL_MAGIC_DMG_CLASS_NEG));
+    EXPECT_TRUE(index.CanProcOn(PROC_FLAG_DONE_MELEE_AUTO_ATTACK));
+    EXPECT_FALSE(index.CanProcOn(PROC_FLAG_TAKEN_MELEE_AUTO_ATTACK | PROC_FLAG_KILL));
+}
+
+TEST(ProcAuraIndexTest, RemoveRecomputesFlags)
+{
+    TestApplication seal{ 20375 }, sealOther{ 20375 }, trinket{ 33648 }, unknown{ 1 };
+    TestIndex index;
+    index.Add(seal.SpellId, PROC_FLAG_DONE_MELEE_AUTO_ATTACK, &seal);
+    index.Add(sealOther.SpellId, PROC_FLAG_DONE_MELEE_AUTO_ATTACK, &sealOther);
+    index.Add(trinket.SpellId, PROC_FLAG_TAKEN_DAMAGE, &trinket);
+
+    // another application of the same spell still procs on melee
+    index.Remove(seal.SpellId, &seal);
+    EXPECT_EQ(Applications(index), std::vector<TestApplication const*>({ &sealOther, &trinket }));
+    EXPECT_TRUE(index.CanProcOn(PROC_FLAG_DONE_MELEE_AUTO_ATTACK));
+
+    index.Remove(sealOther.SpellId, &sealOther);
+    EXPECT_FALSE(index.CanProcOn(PROC_FLAG_DONE_MELEE_AUTO_ATTACK));
+    EXPECT_EQ(index.GetProcFlags(), uint32(PROC_FLAG_TAKEN_DAMAGE));
+
+    // not indexed (no proc flags), or already gone
+    index.Remove(unknown.SpellId, &unknown);
+    index.Remove(seal.SpellId, &seal);
+    EXPECT_EQ(index.size(), 1u);
+
+    index.Remove(trinket.SpellId, &trinket);
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT_EQ(index.GetProcFlags(), 0u);
+}
+
+TEST(ProcAuraIndexTest, RebuildAfterProcTablesReload)
+{
+    TestApplication seal{ 20375 }, trinket{ 33648 };
+    TestIndex index;
+
+    // built for generation 1, like Unit::RebuildProcAuras
+    index.Clear(1);
+    index.Add(seal.SpellId, PROC_FLAG_DONE_MELEE_AUTO_ATTACK, &seal);
+    index.Add(trinket.SpellId, 0, &trinket);
+    EXPECT_TRUE(index.IsBuiltFor(1));
+
+    // the reload gave the trinket proc flags and took the seal's away
+    EXPECT_FALSE(index.IsBuiltFor(2));
+    index.Clear(2);
+    index.Add(seal.SpellId, 0, &seal);
+    index.Add(trinket.SpellId, PROC_FLAG_TAKEN_MELEE_AUTO_ATTACK, &trinket);
+
+    EXPECT_TRUE(index.IsBuiltFor(2));
+    EXPECT_EQ(Applications(index), std::vector<TestApplication const*>({ &trinket }));
+    EXPECT_EQ(index.GetProcFlags(), uint32(PROC_FLAG_TAKEN_MELEE_AUTO_ATTACK));
+}
+
+TEST(ProcAuraIndexTest, SpellProcEventFlags)
+{
+    SpellEntry entry{};
+    entry.Id = 20375;
+    entry.ProcFlags = PROC_FLAG_DONE_MELEE_AUTO_ATTACK;
+    SpellInfo spellInfo(&entry);
+
+    // from Spell.dbc when neither proc table has the spell
+    EXPECT_EQ(SpellMgr::SelectSpellProcEventFlags(&spellInfo, nullptr, nullptr), uint32(PROC_FLAG_DONE_MELEE_AUTO_ATTACK));
+
+    // spell_proc_event overrides them, unless its flags are 0
+    SpellProcEventEntry procEvent{};
+    EXPECT_EQ(SpellMgr::SelectSpellProcEventFlags(&spellInfo, nullptr, &procEvent), uint32(PROC_FLAG_DONE_MELEE_AUTO_ATTACK));
+    procEvent.procFlags = PROC_FLAG_TAKEN_DAMAGE;
+    EXPECT_EQ(SpellMgr::SelectSpellProcEventFlags(&spellInfo, nullptr, &procEvent), uint32(PROC_FLAG_TAKEN_DAMAGE));
+
+    // spell_proc is handled by the new proc system, never by ProcDamageAndSpellFor
+    SpellProcEntry proc{};
+    proc.typeMask = PROC_FLAG_DONE_MELEE_AUTO_ATTACK;
+    EXPECT_EQ(SpellMgr::SelectSpellProcEventFlags(&spellInfo, &proc, &procEvent), 0u);
+
+    // the loaded tables, empty here
+    EXPECT_EQ(sSpellMgr->GetSpellProcEventFlags(&spellInfo), uint32(PROC_FLAG_DONE_MELEE_AUTO_ATTACK));
+}
+
+// A 25 man raid round: everyone hits the boss once with melee and once with a spell, the boss hits the tank
+// and ten raid members. Every unit wears 30 auras, 5 of them can proc. Once walking every applied aura and
+// looking its proc flags up like before the index, once through the index. Timing only, so it is disabled:
+// run it with --gtest_also_run_disabled_tests, the times are test properties in the --gtest_output=xml report.
+TEST(ProcAuraIndexTest, DISABLED_CombatRoundBenchmark)
+{
+    constexpr uint32 RaidSize = 25;
+    constexpr uint32 AurasPerUnit = 30;
+    constexpr uint32 Rounds = 20000;
+
+    uint32 const procFlagChoices[] = { PROC_FLAG_DONE_MELEE_AUTO_ATTACK, PROC_FLAG_DONE_SPELL_MAGIC_DMG_CLASS_NEG, PROC_FLAG_TAKEN_DAMAGE,
+        PROC_FLAG_TAKEN_MELEE_AUTO_ATTACK, PROC_FLAG_KILL };
+
+    // proc flags by spell id, what GetSpellProcEvent looked up per aura
+    std::unordered_map<uint32, uint32> procFlagsBySpell;
+    std::mt19937 random(42);
+
+    struct TestUnit
+    {
+        std::multimap<uint32, TestApplication*> AppliedAuras;
+        TestIndex ProcAuras;
+        std::vector<TestApplication> Applications;
+    };
+
+    std::vector<TestUnit> units(RaidSize + 1);
+    for (TestUnit& unit : units)
+    {
+        unit.Applications.reserve(AurasPerUnit);
+        for (uint32 i = 0; i < AurasPerUnit; ++i)
+        {
+            uint32 spellId = 1000 + random() % 5000;
+            unit.Applications.push_back({ spellId });
+            if (i < 5)
+                procFlagsBySpell[spellId] = procFlagChoices[i];
+        }
+    }
+
+    for (TestUnit& unit : units)
+    {
+        for (TestApplication& application : unit.Applications)
+        {
+            unit.AppliedAuras.emplace(application.SpellId, &application);
+            auto itr = procFlagsBySpell.find(application.SpellId);
+            unit.ProcAuras.Add(application.SpellId, itr != procFlagsBySpell.end() ? itr->second : 0, &application);
+        }
+    }
+
+    auto measure = [&](bool indexed)
+    {
+        uint64 candidates = 0;
+        auto procEvent = [&](TestUnit const& unit, uint32 procFlag)
+        {
+            if (indexed)
+            {
+                if (!unit.ProcAuras.CanProcOn(procFlag))
+                    return;
+
+                for (auto const& [spellId, entry] : unit.ProcAuras)
+                    if (entry.ProcFlags & procFlag)
+                        candidates += spellId;
+            }
+            else
+            {
+                for (auto const& [spellId, application] : unit.AppliedAuras)
+                {
+                    auto itr = procFlagsBySpell.find(spellId);
+                    if (itr != procFlagsBySpell.end() && (itr->second & procFlag))
+                        candidates += spellId;
+                }
+            }
+        };
+
+        TestUnit const& boss = units[RaidSize];
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 round = 0; round < Rounds; ++round)
+        {
+            for (uint32 member = 0; member < RaidSize; ++member)
+            {
+                procEvent(units[member], PROC_FLAG_DONE_MELEE_AUTO_ATTACK);
+                procEvent(boss, PROC_FLAG_TAKEN_MELEE_AUTO_ATTACK | PROC_FLAG_TAKEN_DAMAGE);
+                procEvent(units[member], PROC_FLAG_DONE_SPELL_MAGIC_DMG_CLASS_NEG);
+                procEvent(boss, PROC_FLAG_TAKEN_SPELL_MAGIC_DMG_CLASS_NEG | PROC_FLAG_TAKEN_DAMAGE);
+            }
+
+            for (uint32 member = 0; member <= 10; ++member)
+            {
+                procEvent(boss, PROC_FLAG_DONE_MELEE_AUTO_ATTACK);
+                procEvent(units[member], PROC_FLAG_TAKEN_MELEE_AUTO_ATTACK | PROC_FLAG_TAKEN_DAMAGE);
+            }
+        }
+
+        return std::make_pair(candidates, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    auto [scanCandidates, scanTime] = measure(false);
+    auto [indexCandidates, indexTime] = measure(true);
+    EXPECT_EQ(scanCandidates, indexCandidates);
+
+    RecordProperty("AppliedAurasMicroseconds", std::to_string(scanTime));
+    RecordProperty("ProcAuraIndexMicroseconds", std::to_string(indexTime));
+}
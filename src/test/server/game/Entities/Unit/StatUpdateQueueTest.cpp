@@ -0,0 +1,184 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StatUpdateQueue.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace
+{
+    // Stand-ins for the UnitMods groups used here, in UnitMods order
+    enum TestGroup : uint32
+    {
+        GROUP_STAMINA,
+        GROUP_HEALTH,
+        GROUP_ARMOR,
+        GROUP_RANGED_DAMAGE = 26
+    };
+
+    // Stands in for a Unit: aura modifiers per group, the update fields derived from them and the
+    // batch handling of Unit::HandleStatModifier, Unit::StatUpdateBatch and the stat getters
+    class TestUnit
+    {
+    public:
+        class Batch
+        {
+        public:
+            explicit Batch(TestUnit& unit) : _unit(unit) { _unit._pending.OpenBatch(); }
+            ~Batch()
+            {
+                if (_unit._pending.CloseBatch())
+                    _unit.Resolve();
+            }
+
+        private:
+            TestUnit& _unit;
+        };
+
+        void Modify(TestGroup group, int32 amount)
+        {
+            _modifiers[group] += amount;
+
+            if (_pending.IsBatching())
+            {
+                if (!_pending.Defer(group))
+                    ++Merged;
+
+                return;
+            }
+
+            Update(group);
+        }
+
+        int32 GetStamina() const { ResolveForRead(); return _stamina; }
+        int32 GetMaxHealth() const { ResolveForRead(); return _maxHealth; }
+
+        std::vector<uint32> Updates;
+        uint32 Merged = 0;
+
+    private:
+        void Update(uint32 group)
+        {
+            Updates.push_back(group);
+
+            switch (group)
+            {
+                case GROUP_STAMINA:
+                    _stamina = _modifiers[GROUP_STAMINA];
+                    // like Player::UpdateStats, a stamina change recalculates max health
+                    Update(GROUP_HEALTH);
+                    break;
+                case GROUP_HEALTH:
+                    // reads the stat through its getter, like Player::UpdateMaxHealth
+                    _maxHealth = _modifiers[GROUP_HEALTH] + GetStamina() * 10;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        void Resolve() { _pending.Resolve([this](uint32 group) { Update(group); }); }
+
+        void ResolveForRead() const
+        {
+            if (_pending.HasPending())
+                const_cast<TestUnit*>(this)->Resolve();
+        }
+
+        StatUpdateQueue _pending;
+        int32 _modifiers[StatUpdateQueue::MaxGroups] = { };
+        int32 _stamina = 0;
+        int32 _maxHealth = 0;
+    };
+}
+
+TEST(StatUpdateQueueTest, WithoutBatchUpdatesRightAway)
+{
+    TestUnit unit;
+    unit.Modify(GROUP_HEALTH, 100);
+    EXPECT_EQ(unit.Updates, std::vector<uint32>({ GROUP_HEALTH }));
+    EXPECT_EQ(unit.GetMaxHealth(), 100);
+}
+
+TEST(StatUpdateQueueTest, NestedBatchesResolveOnce)
+{
+    TestUnit unit;
+    {
+        TestUnit::Batch outer(unit);
+        unit.Modify(GROUP_ARMOR, 50);
+        unit.Modify(GROUP_HEALTH, 100);
+
+        {
+            // like an aura apply inside a gear swap
+            TestUnit::Batch inner(unit);
+            unit.Modify(GROUP_STAMINA, 5);
+            unit.Modify(GROUP_STAMINA, 5);
+            unit.Modify(GROUP_RANGED_DAMAGE, 1);
+        }
+
+        EXPECT_TRUE(unit.Updates.empty());
+    }
+
+    // group order: stamina first, so the health it recalculates sees the new stamina
+    EXPECT_EQ(unit.Updates, std::vector<uint32>({ GROUP_STAMINA, GROUP_HEALTH, GROUP_HEALTH, GROUP_ARMOR, GROUP_RANGED_DAMAGE }));
+    EXPECT_EQ(unit.Merged, 1u);
+    EXPECT_EQ(unit.GetStamina(), 10);
+    EXPECT_EQ(unit.GetMaxHealth(), 200);
+}
+
+TEST(StatUpdateQueueTest, ReadResolvesBeforeBatchCloses)
+{
+    TestUnit unit;
+    {
+        TestUnit::Batch batch(unit);
+        unit.Modify(GROUP_STAMINA, 3);
+        unit.Modify(GROUP_HEALTH, 20);
+
+        EXPECT_EQ(unit.GetMaxHealth(), 50);
+        EXPECT_EQ(unit.Updates, std::vector<uint32>({ GROUP_STAMINA, GROUP_HEALTH, GROUP_HEALTH }));
+
+        // still batching after the early resolve
+        unit.Modify(GROUP_STAMINA, 1);
+        EXPECT_EQ(unit.Updates.size(), 3u);
+    }
+
+    // only the group changed after the read is left for the close
+    EXPECT_EQ(unit.Updates, std::vector<uint32>({ GROUP_STAMINA, GROUP_HEALTH, GROUP_HEALTH, GROUP_STAMINA, GROUP_HEALTH }));
+    EXPECT_EQ(unit.GetMaxHealth(), 60);
+}
+
+TEST(StatUpdateQueueTest, DeferReportsMergedGroups)
+{
+    StatUpdateQueue queue;
+    EXPECT_FALSE(queue.IsBatching());
+
+    queue.OpenBatch();
+    queue.OpenBatch();
+    EXPECT_TRUE(queue.Defer(StatUpdateQueue::MaxGroups - 1));
+    EXPECT_FALSE(queue.Defer(StatUpdateQueue::MaxGroups - 1));
+    EXPECT_TRUE(queue.Defer(0));
+
+    EXPECT_FALSE(queue.CloseBatch());
+    EXPECT_TRUE(queue.IsBatching());
+    EXPECT_TRUE(queue.CloseBatch());
+    EXPECT_FALSE(queue.IsBatching());
+
+    std::vector<uint32> groups;
+    queue.Resolve([&groups](uint32 group) { groups.push_back(group); });
+    EXPECT_EQ(groups, std::vector<uint32>({ 0, StatUpdateQueue::MaxGroups - 1 }));
+    EXPECT_FALSE(queue.HasPending());
+}
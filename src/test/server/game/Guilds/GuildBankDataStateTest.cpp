@@ -0,0 +1,130 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GuildBankDataState.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    // Stands in for the bank data query, counts the loads started
+    struct TestLoader
+    {
+        uint32 Started = 0;
+        bool CanStart = true;
+
+        GuildBankDataState::LoadFunction Function()
+        {
+            return [this]()
+            {
+                if (!CanStart)
+                    return false;
+
+                ++Started;
+                return true;
+            };
+        }
+    };
+}
+
+TEST(GuildBankDataStateTest, RequestsWaitForOneLoad)
+{
+    GuildBankDataState state;
+    TestLoader loader;
+    std::vector<uint32> served;
+
+    // every request made while loading waits for the same load
+    for (uint32 request = 0; request < 3; ++request)
+    {
+        ASSERT_FALSE(state.Prepare(100, loader.Function()));
+        state.Defer([&served, request]() { served.push_back(request); });
+    }
+
+    EXPECT_TRUE(state.IsLoading());
+    EXPECT_EQ(loader.Started, 1u);
+    EXPECT_EQ(state.GetWaiterCount(), 3u);
+    EXPECT_TRUE(served.empty());
+
+    state.SetLoaded(101);
+    EXPECT_EQ(served, std::vector<uint32>({ 0, 1, 2 }));
+    EXPECT_EQ(state.GetWaiterCount(), 0u);
+
+    // served right away from now on
+    EXPECT_TRUE(state.Prepare(102, loader.Function()));
+    EXPECT_EQ(loader.Started, 1u);
+}
+
+TEST(GuildBankDataStateTest, WaiterSeesLoadedData)
+{
+    GuildBankDataState state;
+    TestLoader loader;
+    bool loadedInWaiter = false;
+
+    ASSERT_FALSE(state.Prepare(100, loader.Function()));
+
+    // the deferred handler prepares again, like Guild::SendBankTabData does
+    state.Defer([&]() { loadedInWaiter = state.Prepare(101, loader.Function()); });
+    state.SetLoaded(101);
+
+    EXPECT_TRUE(loadedInWaiter);
+    EXPECT_EQ(loader.Started, 1u);
+}
+
+TEST(GuildBankDataStateTest, FailedStartIsRetried)
+{
+    GuildBankDataState state;
+    TestLoader loader;
+    bool served = false;
+
+    loader.CanStart = false;
+    EXPECT_FALSE(state.Prepare(100, loader.Function()));
+    state.Defer([&served]() { served = true; });
+    EXPECT_FALSE(state.IsLoading());
+
+    // the next request starts the load, the earlier one is still served
+    loader.CanStart = true;
+    EXPECT_FALSE(state.Prepare(101, loader.Function()));
+    EXPECT_TRUE(state.IsLoading());
+    EXPECT_EQ(loader.Started, 1u);
+
+    state.SetLoaded(102);
+    EXPECT_TRUE(served);
+}
+
+TEST(GuildBankDataStateTest, UnloadOnlyWhenIdle)
+{
+    GuildBankDataState state;
+    TestLoader loader;
+
+    // nothing to unload before the data is loaded or while it loads
+    EXPECT_FALSE(state.UnloadIfIdle(1000));
+    state.Prepare(100, loader.Function());
+    EXPECT_FALSE(state.UnloadIfIdle(1000));
+
+    state.SetLoaded(100);
+    EXPECT_TRUE(state.Prepare(200, loader.Function()));
+
+    // used after idleSince
+    EXPECT_FALSE(state.UnloadIfIdle(150));
+    EXPECT_TRUE(state.IsLoaded());
+
+    EXPECT_TRUE(state.UnloadIfIdle(200));
+    EXPECT_FALSE(state.IsLoaded());
+
+    // the next request loads it again
+    EXPECT_FALSE(state.Prepare(300, loader.Function()));
+    EXPECT_EQ(loader.Started, 2u);
+}
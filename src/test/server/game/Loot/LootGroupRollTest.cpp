@@ -0,0 +1,276 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LootGroupRoll.h"
+#include "Containers.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <list>
+
+namespace
+{
+    // Stands in for a LootStoreItem
+    struct TestEntry
+    {
+        uint32 ItemId;
+        float Chance;
+        uint16 LootMode;
+        bool Equippable;
+    };
+
+    typedef std::vector<TestEntry*> TestEntryList;
+
+    // Like LootGroupInvalidSelector: wrong loot mode, or dropped too often already
+    struct TestInvalidSelector
+    {
+        std::vector<uint32> const& Dropped;
+        uint16 LootMode;
+
+        bool operator()(TestEntry const* entry) const
+        {
+            if (!(entry->LootMode & LootMode))
+                return true;
+
+            uint32 duplicates = uint32(std::count(Dropped.begin(), Dropped.end(), entry->ItemId));
+            return entry->Equippable ? duplicates >= 1 : duplicates >= 3;
+        }
+    };
+
+    Optional<float> ChanceOf(TestEntry const* entry) { return entry->Chance; }
+
+    // The roll before the entries were skipped in place: filter a copy of the list, then walk it
+    TestEntry* RollFilteredCopy(TestEntryList const& entries, float roll, TestInvalidSelector const& isInvalid)
+    {
+        std::list<TestEntry*> possibleLoot(entries.begin(), entries.end());
+        possibleLoot.remove_if(isInvalid);
+
+        for (TestEntry* entry : possibleLoot)
+        {
+            if (entry->Chance >= 100.0f)
+                return entry;
+
+            roll -= entry->Chance;
+            if (roll < 0)
+                return entry;
+        }
+
+        return nullptr;
+    }
+
+    TestEntry* SelectFilteredCopy(TestEntryList const& entries, TestInvalidSelector const& isInvalid)
+    {
+        std::list<TestEntry*> possibleLoot(entries.begin(), entries.end());
+        possibleLoot.remove_if(isInvalid);
+        return possibleLoot.empty() ? nullptr : Warhead::Containers::SelectRandomContainerElement(possibleLoot);
+    }
+
+    TestEntryList Pointers(std::vector<TestEntry>& entries)
+    {
+        TestEntryList list;
+        for (TestEntry& entry : entries)
+            list.push_back(&entry);
+
+        return list;
+    }
+}
+
+TEST(LootGroupRollTest, ExplicitlyChancedMatchesFilteredCopy)
+{
+    std::vector<TestEntry> entries =
+    {
+        { 1, 10.0f, 1, true },
+        { 2, 25.0f, 2, true },  // other loot mode
+        { 3, 15.0f, 1, true },  // dropped already
+        { 4, 30.0f, 1, false }, // dropped twice, still valid
+        { 5, 5.0f, 3, false },
+    };
+
+    TestEntryList list = Pointers(entries);
+    std::vector<uint32> dropped = { 3, 4, 4 };
+    TestInvalidSelector isInvalid{ dropped, 1 };
+
+    for (float roll = 0.0f; roll <= 100.0f; roll += 0.25f)
+    {
+        Optional<TestEntry*> rolled = Warhead::LootRoll::RollExplicitlyChanced(list, roll, isInvalid, ChanceOf);
+        ASSERT_TRUE(rolled);
+        EXPECT_EQ(*rolled, RollFilteredCopy(list, roll, isInvalid)) << "roll " << roll;
+    }
+
+    // a guaranteed entry is taken whatever the roll, once the ones before it missed
+    entries[4].Chance = 100.0f;
+    Optional<TestEntry*> rolled = Warhead::LootRoll::RollExplicitlyChanced(list, 99.0f, isInvalid, ChanceOf);
+    ASSERT_TRUE(rolled);
+    EXPECT_EQ(*rolled, &entries[4]);
+}
+
+TEST(LootGroupRollTest, ExplicitlyChancedStopsWhenRejected)
+{
+    std::vector<TestEntry> entries = { { 1, 10.0f, 1, true }, { 2, 10.0f, 1, true } };
+    TestEntryList list = Pointers(entries);
+    std::vector<uint32> dropped;
+    TestInvalidSelector isInvalid{ dropped, 1 };
+
+    // OnItemRoll returning false for an entry drops nothing from the group
+    auto rejectSecond = [](TestEntry const* entry) -> Optional<float>
+    {
+        if (entry->ItemId == 2)
+            return {};
+
+        return entry->Chance;
+    };
+
+    EXPECT_FALSE(Warhead::LootRoll::RollExplicitlyChanced(list, 50.0f, isInvalid, rejectSecond));
+
+    // hit before reaching the rejected entry
+    Optional<TestEntry*> rolled = Warhead::LootRoll::RollExplicitlyChanced(list, 5.0f, isInvalid, rejectSecond);
+    ASSERT_TRUE(rolled);
+    EXPECT_EQ(*rolled, &entries[0]);
+}
+
+TEST(LootGroupRollTest, EqualChancedKeepsDistribution)
+{
+    constexpr uint32 Picks = 100000;
+
+    std::vector<TestEntry> entries;
+    for (uint32 i = 0; i < 8; ++i)
+        entries.push_back({ i, 0.0f, uint16(i == 2 ? 2 : 1), true });
+
+    TestEntryList list = Pointers(entries);
+    std::vector<uint32> dropped = { 5, 7 };
+    TestInvalidSelector isInvalid{ dropped, 1 };
+
+    std::vector<uint32> picked(entries.size());
+    std::vector<uint32> pickedFromCopy(entries.size());
+    for (uint32 i = 0; i < Picks; ++i)
+    {
+        TestEntry* entry = Warhead::LootRoll::SelectEqualChanced(list, isInvalid);
+        ASSERT_TRUE(entry);
+        ++picked[entry->ItemId];
+        ++pickedFromCopy[SelectFilteredCopy(list, isInvalid)->ItemId];
+    }
+
+    // 5 valid entries with 20000 expected picks each, a standard deviation of about 126
+    for (uint32 id = 0; id < entries.size(); ++id)
+    {
+        if (isInvalid(&entries[id]))
+        {
+            EXPECT_EQ(picked[id], 0u) << "entry " << id;
+            EXPECT_EQ(pickedFromCopy[id], 0u) << "entry " << id;
+        }
+        else
+        {
+            EXPECT_NEAR(picked[id], Picks / 5, 1000) << "entry " << id;
+            EXPECT_NEAR(pickedFromCopy[id], Picks / 5, 1000) << "entry " << id;
+        }
+    }
+
+    dropped = { 0, 1, 3, 4, 5, 6, 7 };
+    EXPECT_EQ(Warhead::LootRoll::SelectEqualChanced(list, isInvalid), nullptr);
+}
+
+// Rolls raid trash (many groups with lots of equal chanced gear, the loot filling up while rolling) and mass
+// skinning (one small explicitly chanced group per corpse), once filtering list copies like before and once
+// skipping invalid entries in place. Timing only, so it is disabled: run it with --gtest_also_run_disabled_tests,
+// the times are test properties in the --gtest_output=xml report.
+TEST(LootGroupRollTest, DISABLED_LootGenerationBenchmark)
+{
+    struct Scenario
+    {
+        char const* Name;
+        uint32 Corpses;
+        uint32 Groups;
+        uint32 ExplicitEntries;
+        uint32 EqualEntries;
+    };
+
+    Scenario const scenarios[] =
+    {
+        { "RaidTrash", 20000, 4, 6, 40 },
+        { "MassSkinning", 200000, 1, 5, 0 },
+    };
+
+    for (Scenario const& scenario : scenarios)
+    {
+        std::vector<std::vector<TestEntry>> groups(scenario.Groups);
+        uint32 itemId = 0;
+        for (std::vector<TestEntry>& group : groups)
+        {
+            for (uint32 i = 0; i < scenario.ExplicitEntries; ++i)
+                group.push_back({ ++itemId, 70.0f / scenario.ExplicitEntries, uint16(i % 4 ? 1 : 2), false });
+
+            // gear shared by the groups, like a reference table of the zone's drops
+            for (uint32 i = 0; i < scenario.EqualEntries; ++i)
+                group.push_back({ 1000 + i, 0.0f, 1, true });
+        }
+
+        std::vector<std::pair<TestEntryList, TestEntryList>> lists;
+        for (std::vector<TestEntry>& group : groups)
+        {
+            TestEntryList explicitlyChanced, equalChanced;
+            for (TestEntry& entry : group)
+                (entry.Chance > 0.0f ? explicitlyChanced : equalChanced).push_back(&entry);
+
+            lists.emplace_back(explicitlyChanced, equalChanced);
+        }
+
+        auto measure = [&](bool filteredCopy)
+        {
+            uint64 drops = 0;
+            std::vector<uint32> dropped;
+            auto start = std::chrono::steady_clock::now();
+            for (uint32 corpse = 0; corpse < scenario.Corpses; ++corpse)
+            {
+                dropped.clear();
+                TestInvalidSelector isInvalid{ dropped, 1 };
+
+                for (auto const& [explicitlyChanced, equalChanced] : lists)
+                {
+                    float roll = float(rand_chance());
+                    TestEntry* entry = nullptr;
+                    if (filteredCopy)
+                    {
+                        entry = RollFilteredCopy(explicitlyChanced, roll, isInvalid);
+                        if (!entry)
+                            entry = SelectFilteredCopy(equalChanced, isInvalid);
+                    }
+                    else
+                    {
+                        entry = *Warhead::LootRoll::RollExplicitlyChanced(explicitlyChanced, roll, isInvalid, ChanceOf);
+                        if (!entry)
+                            entry = Warhead::LootRoll::SelectEqualChanced(equalChanced, isInvalid);
+                    }
+
+                    if (entry)
+                        dropped.push_back(entry->ItemId);
+                }
+
+                drops += dropped.size();
+            }
+
+            return std::make_pair(drops, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        };
+
+        auto [copyDrops, copyTime] = measure(true);
+        auto [inPlaceDrops, inPlaceTime] = measure(false);
+
+        // random rolls, only the drop rate can be compared
+        EXPECT_NEAR(double(copyDrops), double(inPlaceDrops), 0.05 * copyDrops) << scenario.Name;
+
+        RecordProperty(std::string(scenario.Name) + "FilteredCopyMicroseconds", std::to_string(copyTime));
+        RecordProperty(std::string(scenario.Name) + "InPlaceMicroseconds", std::to_string(inPlaceTime));
+    }
+}
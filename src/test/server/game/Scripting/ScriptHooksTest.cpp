@@ -0,0 +1,160 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ScriptMgr.h"
+#include "ScriptMgrMacros.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+    std::vector<uint16> Sorted(std::vector<uint16> hooks)
+    {
+        std::sort(hooks.begin(), hooks.end());
+        return hooks;
+    }
+
+    class LoginChatScript : public PlayerScript
+    {
+    public:
+        using PlayerScript::GetOverriddenHooks;
+
+        void OnLogin(Player* /*player*/) override { }
+        void OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Channel* /*channel*/) override { }
+    };
+
+    // Overrides through an intermediate class count as well
+    class DerivedLoginChatScript : public LoginChatScript
+    {
+    public:
+        void OnLogout(Player* /*player*/) override { }
+    };
+
+    class NoHookScript : public PlayerScript
+    {
+    public:
+        using PlayerScript::GetOverriddenHooks;
+    };
+
+    // Implements login and logout, but only subscribes to the hooks it is given
+    class CountingScript : public PlayerScript
+    {
+    public:
+        CountingScript(char const* name, std::vector<uint16> enabledHooks) : PlayerScript(name, std::move(enabledHooks)) { }
+
+        void OnLogin(Player* /*player*/) override { ++Logins; }
+        void OnLogout(Player* /*player*/) override { ++Logouts; }
+
+        uint32 Logins = 0;
+        uint32 Logouts = 0;
+    };
+
+    // A module that only listens to chat, the usual shape of the bundled modules
+    class ChatOnlyScript : public PlayerScript
+    {
+    public:
+        ChatOnlyScript() : PlayerScript("ChatOnlyScript", GetOverriddenHooks<ChatOnlyScript>()) { }
+
+        void OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/) override { }
+    };
+
+    class VendorScript : public AllCreatureScript
+    {
+    public:
+        using AllCreatureScript::GetOverriddenHooks;
+
+        bool CanCreatureSendListInventory(Player* /*player*/, Creature* /*creature*/, uint32 /*vendorEntry*/) override { return true; }
+    };
+}
+
+TEST(ScriptHooksTest, PlayerScriptOverrides)
+{
+    EXPECT_EQ(Sorted(LoginChatScript::GetOverriddenHooks<LoginChatScript>()), Sorted({ PLAYERHOOK_ON_CHAT, PLAYERHOOK_ON_LOGIN }));
+}
+
+TEST(ScriptHooksTest, InheritedOverrides)
+{
+    EXPECT_EQ(Sorted(LoginChatScript::GetOverriddenHooks<DerivedLoginChatScript>()), Sorted({ PLAYERHOOK_ON_CHAT, PLAYERHOOK_ON_LOGIN, PLAYERHOOK_ON_LOGOUT }));
+}
+
+TEST(ScriptHooksTest, NoOverrides)
+{
+    EXPECT_TRUE(NoHookScript::GetOverriddenHooks<NoHookScript>().empty());
+}
+
+TEST(ScriptHooksTest, AllCreatureScriptOverrides)
+{
+    EXPECT_EQ(VendorScript::GetOverriddenHooks<VendorScript>(), (std::vector<uint16>{ ALLCREATUREHOOK_CAN_CREATURE_SEND_LIST_INVENTORY }));
+}
+
+TEST(ScriptHooksTest, DispatchSkipsUnsubscribedHooks)
+{
+    // scripts stay registered for the whole process, like the real ones
+    CountingScript* loginOnly = new CountingScript("ScriptHooksTest_LoginOnly", { PLAYERHOOK_ON_LOGIN });
+    CountingScript* allHooks = new CountingScript("ScriptHooksTest_AllHooks", { });
+
+    auto const& logoutSubscribers = ScriptRegistry<PlayerScript>::EnabledHooks[PLAYERHOOK_ON_LOGOUT];
+    EXPECT_EQ(std::count(logoutSubscribers.begin(), logoutSubscribers.end(), loginOnly), 0);
+    EXPECT_EQ(std::count(logoutSubscribers.begin(), logoutSubscribers.end(), allHooks), 1);
+
+    sScriptMgr->OnPlayerLogin(nullptr);
+    sScriptMgr->OnPlayerLogout(nullptr);
+
+    EXPECT_EQ(loginOnly->Logins, 1u);
+    EXPECT_EQ(loginOnly->Logouts, 0u);
+    EXPECT_EQ(allHooks->Logins, 1u);
+    EXPECT_EQ(allHooks->Logouts, 1u);
+}
+
+// Per tick cost of the player update hooks with 30 registered modules that only listen to chat: dispatch
+// through the subscriber lists against walking every registered script like before. Timing only, opt in
+// with --gtest_also_run_disabled_tests, the times are properties in the --gtest_output=xml report.
+TEST(ScriptHooksTest, DISABLED_PlayerUpdateHookBenchmark)
+{
+    constexpr uint32 Modules = 30;
+    constexpr uint32 Players = 1000;
+    constexpr uint32 Ticks = 1000;
+
+    for (uint32 i = 0; i < Modules; ++i)
+        new ChatOnlyScript();
+
+    auto measure = [&](auto&& tick)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < Ticks; ++i)
+            for (uint32 player = 0; player < Players; ++player)
+                tick();
+
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    auto walkTime = measure([]()
+    {
+        ExecuteScript<PlayerScript>([](PlayerScript* script) { script->OnBeforeUpdate(nullptr, 50); });
+        ExecuteScript<PlayerScript>([](PlayerScript* script) { script->OnUpdate(nullptr, 50); });
+    });
+
+    auto subscriberTime = measure([]()
+    {
+        sScriptMgr->OnBeforePlayerUpdate(nullptr, 50);
+        sScriptMgr->OnPlayerUpdate(nullptr, 50);
+    });
+
+    RecordProperty("AllScriptsMicroseconds", std::to_string(walkTime));
+    RecordProperty("SubscribersMicroseconds", std::to_string(subscriberTime));
+}
@@ -0,0 +1,267 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DBCStores.h"
+#include "DBCStructure.h"
+#include "GameConfig.h"
+#include "ObjectMgr.h"
+#include "ScriptMgr.h"
+#include "SpellAuraDefines.h"
+#include "SpellInfo.h"
+#include "SpellMgr.h"
+#include "SpellScript.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+    constexpr uint32 ScriptedSpellId = 40001;
+    constexpr uint32 UnscriptedSpellId = 40002;
+    constexpr char const* ScriptName = "SpellScriptHooksTest_Script";
+    constexpr char const* ShareHooksOption = "Spells.ShareScriptHooks";
+
+    class TestSpellScript : public SpellScript
+    {
+        PrepareSpellScript(TestSpellScript);
+
+        void HandleCast() { }
+        void HandleHit() { }
+        void HandleEffect(SpellEffIndex /*effIndex*/) { }
+
+        void Register() override
+        {
+            BeforeCast += SpellCastFn(TestSpellScript::HandleCast);
+            OnCast += SpellCastFn(TestSpellScript::HandleCast);
+            AfterCast += SpellCastFn(TestSpellScript::HandleCast);
+            OnHit += SpellHitFn(TestSpellScript::HandleHit);
+            AfterHit += SpellHitFn(TestSpellScript::HandleHit);
+            OnEffectLaunchTarget += SpellEffectFn(TestSpellScript::HandleEffect, EFFECT_1, SPELL_EFFECT_SCHOOL_DAMAGE);
+            OnEffectHitTarget += SpellEffectFn(TestSpellScript::HandleEffect, EFFECT_1, SPELL_EFFECT_SCHOOL_DAMAGE);
+        }
+    };
+
+    class TestAuraScript : public AuraScript
+    {
+        PrepareAuraScript(TestAuraScript);
+
+        void HandleApply(AuraEffect const* /*aurEff*/, AuraEffectHandleModes /*mode*/) { }
+        void HandlePeriodic(AuraEffect const* /*aurEff*/) { }
+        bool CheckProc(ProcEventInfo& /*eventInfo*/) { return true; }
+        void HandleProc(ProcEventInfo& /*eventInfo*/) { }
+
+        void Register() override
+        {
+            OnEffectApply += AuraEffectApplyFn(TestAuraScript::HandleApply, EFFECT_0, SPELL_AURA_PERIODIC_DAMAGE, AURA_EFFECT_HANDLE_REAL);
+            OnEffectPeriodic += AuraEffectPeriodicFn(TestAuraScript::HandlePeriodic, EFFECT_0, SPELL_AURA_PERIODIC_DAMAGE);
+            DoCheckProc += AuraCheckProcFn(TestAuraScript::CheckProc);
+            OnProc += AuraProcFn(TestAuraScript::HandleProc);
+        }
+    };
+
+    uint32 HookCount(SpellScript* script)
+    {
+        return script->BeforeCast.size() + script->OnCast.size() + script->AfterCast.size() + script->OnHit.size()
+            + script->AfterHit.size() + script->OnEffectLaunchTarget.size() + script->OnEffectHitTarget.size();
+    }
+
+    uint32 HookCount(AuraScript* script)
+    {
+        return script->OnEffectApply.size() + script->OnEffectPeriodic.size() + script->DoCheckProc.size() + script->OnProc.size();
+    }
+
+    // Registers the hooks the way Spell::LoadScripts and Aura::LoadScripts do and frees the scripts again
+    template<class Script>
+    uint32 LoadAndFreeScripts(std::list<Script*>& scripts)
+    {
+        uint32 hooks = 0;
+        for (Script* script : scripts)
+        {
+            if (!script->_HasSharedHooks())
+                script->Register();
+
+            hooks += HookCount(script);
+            script->_Unload();
+            delete script;
+        }
+
+        scripts.clear();
+        return hooks;
+    }
+
+    void SetShareHooks(bool share)
+    {
+        sGameConfig->SetOption<bool>(ShareHooksOption, share);
+    }
+
+    SpellEntry MakeSpellEntry(uint32 id)
+    {
+        SpellEntry entry{};
+        entry.Id = id;
+        entry.SchoolMask = SPELL_SCHOOL_MASK_SHADOW;
+        entry.DmgClass = SPELL_DAMAGE_CLASS_MAGIC;
+        entry.EquippedItemClass = -1;
+        entry.Effect[EFFECT_0] = SPELL_EFFECT_APPLY_AURA;
+        entry.EffectApplyAuraName[EFFECT_0] = SPELL_AURA_PERIODIC_DAMAGE;
+        entry.EffectImplicitTargetA[EFFECT_0] = TARGET_UNIT_TARGET_ENEMY;
+        entry.Effect[EFFECT_1] = SPELL_EFFECT_SCHOOL_DAMAGE;
+        entry.EffectImplicitTargetA[EFFECT_1] = TARGET_UNIT_TARGET_ENEMY;
+        return entry;
+    }
+
+    // One spell with a spell and aura script assigned like by spell_script_names, loaded and validated like at
+    // startup, and one spell without scripts
+    class SpellScriptHooksTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            static bool const loaded = LoadScripts();
+            ASSERT_TRUE(loaded);
+        }
+
+        void TearDown() override
+        {
+            SetShareHooks(true);
+        }
+
+    private:
+        static bool LoadScripts()
+        {
+            // the DBC store owns its entries
+            sSpellStore.SetEntry(ScriptedSpellId, new SpellEntry(MakeSpellEntry(ScriptedSpellId)));
+            sSpellStore.SetEntry(UnscriptedSpellId, new SpellEntry(MakeSpellEntry(UnscriptedSpellId)));
+            sSpellMgr->LoadSpellInfoStore();
+            sSpellMgr->LoadSpellHotInfoStore();
+
+            // script names are sorted with "" first, see ObjectMgr::LoadScriptNames
+            ObjectMgr::ScriptNameContainer& scriptNames = sObjectMgr->GetScriptNames();
+            if (scriptNames.empty())
+                scriptNames.emplace_back("");
+
+            scriptNames.emplace_back(ScriptName);
+            std::sort(scriptNames.begin() + 1, scriptNames.end());
+
+            // scripts stay registered for the whole process, like the real ones
+            RegisterSpellAndAuraScriptPairWithArgs(TestSpellScript, TestAuraScript, ScriptName);
+            ScriptRegistry<SpellScriptLoader>::AddALScripts();
+
+            if (!sObjectMgr->LoadSpellScriptName(ScriptedSpellId, ScriptName))
+                return false;
+
+            sObjectMgr->ValidateSpellScripts();
+            sGameConfig->AddOption<bool>(ShareHooksOption, true);
+            return true;
+        }
+    };
+}
+
+TEST_F(SpellScriptHooksTest, CreatedScriptsShareRegisteredHooks)
+{
+    std::list<SpellScript*> spellScripts;
+    std::list<AuraScript*> auraScripts;
+    sScriptMgr->CreateSpellScripts(ScriptedSpellId, spellScripts);
+    sScriptMgr->CreateAuraScripts(ScriptedSpellId, auraScripts);
+
+    ASSERT_EQ(spellScripts.size(), 1u);
+    ASSERT_EQ(auraScripts.size(), 1u);
+    EXPECT_TRUE(spellScripts.front()->_HasSharedHooks());
+    EXPECT_TRUE(auraScripts.front()->_HasSharedHooks());
+    EXPECT_EQ(HookCount(spellScripts.front()), 7u);
+    EXPECT_EQ(HookCount(auraScripts.front()), 4u);
+
+    // a hook added to one cast's script stays on that script
+    SpellScript* script = spellScripts.front();
+    script->OnCast += *script->OnCast.begin();
+    std::list<SpellScript*> otherScripts;
+    sScriptMgr->CreateSpellScripts(ScriptedSpellId, otherScripts);
+    ASSERT_EQ(otherScripts.size(), 1u);
+    EXPECT_EQ(otherScripts.front()->OnCast.size(), 1u);
+
+    EXPECT_EQ(LoadAndFreeScripts(spellScripts), 8u);
+    EXPECT_EQ(LoadAndFreeScripts(otherScripts), 7u);
+    EXPECT_EQ(LoadAndFreeScripts(auraScripts), 4u);
+}
+
+TEST_F(SpellScriptHooksTest, UnsharedScriptsRegisterPerCast)
+{
+    SetShareHooks(false);
+
+    std::list<SpellScript*> spellScripts;
+    std::list<AuraScript*> auraScripts;
+    sScriptMgr->CreateSpellScripts(ScriptedSpellId, spellScripts);
+    sScriptMgr->CreateAuraScripts(ScriptedSpellId, auraScripts);
+
+    ASSERT_EQ(spellScripts.size(), 1u);
+    ASSERT_EQ(auraScripts.size(), 1u);
+    EXPECT_FALSE(spellScripts.front()->_HasSharedHooks());
+    EXPECT_EQ(HookCount(spellScripts.front()), 0u);
+
+    EXPECT_EQ(LoadAndFreeScripts(spellScripts), 7u);
+    EXPECT_EQ(LoadAndFreeScripts(auraScripts), 4u);
+}
+
+TEST_F(SpellScriptHooksTest, UnscriptedSpellCreatesNoScripts)
+{
+    std::list<SpellScript*> spellScripts;
+    std::list<AuraScript*> auraScripts;
+    sScriptMgr->CreateSpellScripts(UnscriptedSpellId, spellScripts);
+    sScriptMgr->CreateAuraScripts(UnscriptedSpellId, auraScripts);
+
+    EXPECT_TRUE(spellScripts.empty());
+    EXPECT_TRUE(auraScripts.empty());
+}
+
+// The script setup of every cast and aura application: creates the spell and aura scripts of an unscripted
+// spell, of a scripted spell registering its hooks per cast and of a scripted spell sharing the hooks registered
+// at startup. Timing only, so it is disabled: run it with --gtest_also_run_disabled_tests, the times are test
+// properties in the --gtest_output=xml report.
+TEST_F(SpellScriptHooksTest, DISABLED_CastScriptSetupBenchmark)
+{
+    constexpr uint32 Casts = 200000;
+
+    auto measure = [](uint32 spellId, bool shareHooks)
+    {
+        SetShareHooks(shareHooks);
+
+        std::list<SpellScript*> spellScripts;
+        std::list<AuraScript*> auraScripts;
+        uint32 hooks = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < Casts; ++i)
+        {
+            sScriptMgr->CreateSpellScripts(spellId, spellScripts);
+            sScriptMgr->CreateAuraScripts(spellId, auraScripts);
+            hooks += LoadAndFreeScripts(spellScripts);
+            hooks += LoadAndFreeScripts(auraScripts);
+        }
+
+        return std::make_pair(hooks, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    auto [unscriptedHooks, unscriptedTime] = measure(UnscriptedSpellId, true);
+    auto [registerHooks, registerTime] = measure(ScriptedSpellId, false);
+    auto [sharedHooks, sharedTime] = measure(ScriptedSpellId, true);
+
+    EXPECT_EQ(unscriptedHooks, 0u);
+    EXPECT_EQ(registerHooks, sharedHooks);
+
+    RecordProperty("UnscriptedMicroseconds", std::to_string(unscriptedTime));
+    RecordProperty("RegisterHooksMicroseconds", std::to_string(registerTime));
+    RecordProperty("SharedHooksMicroseconds", std::to_string(sharedTime));
+}
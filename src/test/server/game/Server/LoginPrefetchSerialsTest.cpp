@@ -0,0 +1,80 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoginPrefetchSerials.h"
+#include "gtest/gtest.h"
+
+TEST(LoginPrefetchSerialsTest, ChangeAfterIssueIsStale)
+{
+    LoginPrefetchSerials serials;
+
+    uint32 issued = serials.GetSerial();
+    EXPECT_FALSE(serials.IsChanged(1, issued));
+
+    serials.Invalidate(1, 100, 30);
+    EXPECT_TRUE(serials.IsChanged(1, issued));
+    EXPECT_FALSE(serials.IsChanged(2, issued));
+
+    // a prefetch issued after the change is current
+    uint32 reissued = serials.GetSerial();
+    EXPECT_FALSE(serials.IsChanged(1, reissued));
+
+    // changes of other characters don't matter
+    serials.Invalidate(2, 100, 30);
+    EXPECT_FALSE(serials.IsChanged(1, reissued));
+    EXPECT_TRUE(serials.IsChanged(2, reissued));
+}
+
+TEST(LoginPrefetchSerialsTest, InvalidateAllDropsEveryPrefetch)
+{
+    LoginPrefetchSerials serials;
+    serials.Invalidate(1, 100, 30);
+
+    uint32 issued = serials.GetSerial();
+    serials.InvalidateAll();
+
+    EXPECT_TRUE(serials.IsChanged(1, issued));
+    EXPECT_TRUE(serials.IsChanged(5, issued));
+    EXPECT_EQ(serials.GetSize(), 0u);
+
+    uint32 reissued = serials.GetSerial();
+    EXPECT_FALSE(serials.IsChanged(1, reissued));
+    EXPECT_FALSE(serials.IsChanged(5, reissued));
+}
+
+TEST(LoginPrefetchSerialsTest, OldChangesAreForgotten)
+{
+    LoginPrefetchSerials serials;
+
+    for (uint32 guid = 1; guid <= 1024; ++guid)
+        serials.Invalidate(guid, 100, 30);
+
+    EXPECT_EQ(serials.GetSize(), 1024u);
+
+    // past the threshold, changes older than the max age go away
+    uint32 issued = serials.GetSerial();
+    serials.Invalidate(2000, 131, 30);
+    EXPECT_EQ(serials.GetSize(), 1u);
+    EXPECT_TRUE(serials.IsChanged(2000, issued));
+    EXPECT_FALSE(serials.IsChanged(1, issued));
+
+    // changes within the max age stay
+    for (uint32 guid = 1; guid <= 1024; ++guid)
+        serials.Invalidate(guid, 140, 30);
+
+    EXPECT_EQ(serials.GetSize(), 1025u);
+}
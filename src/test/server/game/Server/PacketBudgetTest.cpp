@@ -0,0 +1,95 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PacketBudget.h"
+#include "gtest/gtest.h"
+
+TEST(PacketBudgetTest, CostEstimateMovingAverage)
+{
+    OpcodeCostEstimate estimate;
+    EXPECT_EQ(estimate.Get(), 0us);
+
+    // the first sample is taken as it is
+    estimate.Record(800us);
+    EXPECT_EQ(estimate.Get(), 800us);
+
+    // then each sample weighs 1/8
+    estimate.Record(0us);
+    EXPECT_EQ(estimate.Get(), 700us);
+    estimate.Record(1500us);
+    EXPECT_EQ(estimate.Get(), 800us);
+
+    // a handler that got slow is followed within a few dozen packets
+    for (uint32 i = 0; i < 40; ++i)
+        estimate.Record(5000us);
+
+    EXPECT_NEAR(estimate.Get().count(), 5000, 30);
+
+    // a single outlier only moves it by an eighth
+    estimate.Record(Microseconds(estimate.Get().count() + 8000));
+    EXPECT_NEAR(estimate.Get().count(), 6000, 30);
+}
+
+TEST(PacketBudgetTest, CostEstimateBuckets)
+{
+    OpcodeCostEstimate estimate;
+    for (Microseconds cost : { 5us, 99us, 100us, 999us, 1000us, 20000us })
+        estimate.Record(cost);
+
+    EXPECT_EQ(estimate.TakeBucketCount(0), 2u);
+    EXPECT_EQ(estimate.TakeBucketCount(1), 2u);
+    EXPECT_EQ(estimate.TakeBucketCount(2), 1u);
+    EXPECT_EQ(estimate.TakeBucketCount(3), 1u);
+
+    // counted from the last report on
+    EXPECT_EQ(estimate.TakeBucketCount(0), 0u);
+    estimate.Record(10us);
+    EXPECT_EQ(estimate.TakeBucketCount(0), 1u);
+}
+
+TEST(PacketBudgetTest, SessionAndTimeBudget)
+{
+    EXPECT_EQ(PacketBudget(10000us, 0us).Get(), 10000us);
+    EXPECT_EQ(PacketBudget(10000us, 4000us).Get(), 4000us);
+    EXPECT_EQ(PacketBudget(10000us, 40000us).Get(), 10000us);
+    EXPECT_EQ(PacketBudget(0us, 4000us).Get(), 4000us);
+    EXPECT_EQ(PacketBudget(0us, 0us).Get(), 0us);
+
+    EXPECT_EQ(PacketBudget::GetSessionTimeBudget(0us, 500000us), 0us);
+    EXPECT_EQ(PacketBudget::GetSessionTimeBudget(100000us, 30000us), 70000us);
+
+    // spent: the remaining sessions get a single packet
+    EXPECT_EQ(PacketBudget::GetSessionTimeBudget(100000us, 100000us), 1us);
+    EXPECT_EQ(PacketBudget::GetSessionTimeBudget(100000us, 250000us), 1us);
+}
+
+TEST(PacketBudgetTest, CutOffByExpectedCost)
+{
+    PacketBudget budget(10000us, 0us);
+
+    EXPECT_TRUE(budget.Fits(2000us, 8000us, 3));
+    EXPECT_FALSE(budget.Fits(2000us, 8001us, 3));
+    EXPECT_FALSE(budget.Fits(12000us, 0us, 3));
+
+    // the first packet is handled whatever it costs, so a session cannot starve
+    EXPECT_TRUE(budget.Fits(0us, 50000us, 0));
+    EXPECT_TRUE(PacketBudget(10000us, 1us).Fits(0us, 500us, 0));
+    EXPECT_FALSE(PacketBudget(10000us, 1us).Fits(0us, 500us, 1));
+
+    // no limit
+    EXPECT_TRUE(PacketBudget(0us, 0us).Fits(1000000us, 1000000us, 100));
+}
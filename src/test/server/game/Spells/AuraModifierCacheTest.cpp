@@ -0,0 +1,174 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuraModifierCache.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    // Stands in for an AuraEffect registered on a unit
+    struct TestEffect
+    {
+        AuraType Type;
+        int32 Amount;
+        bool Enabled;
+    };
+
+    // The cached lookups of Unit and the invalidations of AuraEffect: SetAmount, ChangeAmount
+    // (marked or not) and SetEnabled all drop the cached results of the effect's aura type
+    class TestUnit
+    {
+    public:
+        void Register(TestEffect& effect)
+        {
+            _effects.push_back(&effect);
+            _cache.Invalidate(effect.Type);
+        }
+
+        void SetAmount(TestEffect& effect, int32 amount)
+        {
+            effect.Amount = amount;
+            _cache.Invalidate(effect.Type);
+        }
+
+        void SetEnabled(TestEffect& effect, bool enabled)
+        {
+            effect.Enabled = enabled;
+            _cache.Invalidate(effect.Type);
+        }
+
+        int32 GetTotal(AuraType type)
+        {
+            return Get(type, AuraModifierAggregate::Total, [](int32 total, int32 amount) { return total + amount; });
+        }
+
+        int32 GetMaxPositive(AuraType type)
+        {
+            return Get(type, AuraModifierAggregate::MaxPositive, [](int32 max, int32 amount) { return std::max(max, amount); });
+        }
+
+        uint32 Walks = 0;
+
+    private:
+        template<class Fold>
+        int32 Get(AuraType type, AuraModifierAggregate aggregate, Fold fold)
+        {
+            if (double const* cached = _cache.Find(type, aggregate, 0))
+                return int32(*cached);
+
+            ++Walks;
+            int32 value = 0;
+            for (TestEffect const* effect : _effects)
+                if (effect->Type == type && effect->Enabled)
+                    value = fold(value, effect->Amount);
+
+            _cache.Store(type, aggregate, 0, value);
+            return value;
+        }
+
+        std::vector<TestEffect*> _effects;
+        AuraModifierCache _cache;
+    };
+}
+
+TEST(AuraModifierCacheTest, FindByAggregateAndMisc)
+{
+    AuraModifierCache cache;
+    EXPECT_EQ(cache.Find(SPELL_AURA_MOD_STAT, AuraModifierAggregate::Total, 0), nullptr);
+
+    cache.Store(SPELL_AURA_MOD_STAT, AuraModifierAggregate::Total, 0, 30.0);
+    cache.Store(SPELL_AURA_MOD_STAT, AuraModifierAggregate::TotalByMiscValue, 1, 12.0);
+    cache.Store(SPELL_AURA_MOD_STAT, AuraModifierAggregate::MultiplierByMiscValue, 1, 1.1);
+
+    ASSERT_NE(cache.Find(SPELL_AURA_MOD_STAT, AuraModifierAggregate::Total, 0), nullptr);
+    EXPECT_EQ(*cache.Find(SPELL_AURA_MOD_STAT, AuraModifierAggregate::Total, 0), 30.0);
+    EXPECT_EQ(*cache.Find(SPELL_AURA_MOD_STAT, AuraModifierAggregate::TotalByMiscValue, 1), 12.0);
+    EXPECT_EQ(*cache.Find(SPELL_AURA_MOD_STAT, AuraModifierAggregate::MultiplierByMiscValue, 1), 1.1);
+    EXPECT_EQ(cache.Find(SPELL_AURA_MOD_STAT, AuraModifierAggregate::TotalByMiscValue, 2), nullptr);
+    EXPECT_EQ(cache.Find(SPELL_AURA_MOD_INCREASE_SPEED, AuraModifierAggregate::Total, 0), nullptr);
+}
+
+TEST(AuraModifierCacheTest, InvalidateDropsOnlyItsType)
+{
+    AuraModifierCache cache;
+    cache.Store(SPELL_AURA_MOD_STAT, AuraModifierAggregate::Total, 0, 30.0);
+    cache.Store(SPELL_AURA_MOD_STAT, AuraModifierAggregate::MaxPositive, 0, 20.0);
+    cache.Store(SPELL_AURA_MOD_INCREASE_SPEED, AuraModifierAggregate::Total, 0, 40.0);
+
+    cache.Invalidate(SPELL_AURA_MOD_STAT);
+    EXPECT_EQ(cache.Find(SPELL_AURA_MOD_STAT, AuraModifierAggregate::Total, 0), nullptr);
+    EXPECT_EQ(cache.Find(SPELL_AURA_MOD_STAT, AuraModifierAggregate::MaxPositive, 0), nullptr);
+    ASSERT_NE(cache.Find(SPELL_AURA_MOD_INCREASE_SPEED, AuraModifierAggregate::Total, 0), nullptr);
+
+    // an aura type never cached
+    cache.Invalidate(SPELL_AURA_MOD_DAMAGE_PERCENT_DONE);
+
+    // stored again after the invalidation
+    cache.Store(SPELL_AURA_MOD_STAT, AuraModifierAggregate::Total, 0, 35.0);
+    EXPECT_EQ(*cache.Find(SPELL_AURA_MOD_STAT, AuraModifierAggregate::Total, 0), 35.0);
+}
+
+TEST(AuraModifierCacheTest, AmountChangeRefreshesResults)
+{
+    TestUnit unit;
+    TestEffect first{ SPELL_AURA_MOD_STAT, 10, true };
+    TestEffect second{ SPELL_AURA_MOD_STAT, 20, true };
+    TestEffect speed{ SPELL_AURA_MOD_INCREASE_SPEED, 30, true };
+    unit.Register(first);
+    unit.Register(second);
+    unit.Register(speed);
+
+    EXPECT_EQ(unit.GetTotal(SPELL_AURA_MOD_STAT), 30);
+    EXPECT_EQ(unit.GetMaxPositive(SPELL_AURA_MOD_STAT), 20);
+    EXPECT_EQ(unit.GetTotal(SPELL_AURA_MOD_INCREASE_SPEED), 30);
+    EXPECT_EQ(unit.Walks, 3u);
+
+    // served from the cache
+    EXPECT_EQ(unit.GetTotal(SPELL_AURA_MOD_STAT), 30);
+    EXPECT_EQ(unit.Walks, 3u);
+
+    // SetAmount, like a talent or script changing the effect
+    unit.SetAmount(first, 50);
+    EXPECT_EQ(unit.GetTotal(SPELL_AURA_MOD_STAT), 70);
+    EXPECT_EQ(unit.GetMaxPositive(SPELL_AURA_MOD_STAT), 50);
+
+    // ChangeAmount of a stack, the other aura type keeps its results
+    unit.SetAmount(second, 5);
+    uint32 walks = unit.Walks;
+    EXPECT_EQ(unit.GetTotal(SPELL_AURA_MOD_INCREASE_SPEED), 30);
+    EXPECT_EQ(unit.Walks, walks);
+    EXPECT_EQ(unit.GetTotal(SPELL_AURA_MOD_STAT), 55);
+    EXPECT_EQ(unit.GetMaxPositive(SPELL_AURA_MOD_STAT), 50);
+}
+
+TEST(AuraModifierCacheTest, DisabledEffectLeavesResults)
+{
+    TestUnit unit;
+    TestEffect first{ SPELL_AURA_MOD_STAT, 10, true };
+    TestEffect second{ SPELL_AURA_MOD_STAT, 20, true };
+    unit.Register(first);
+    unit.Register(second);
+
+    EXPECT_EQ(unit.GetTotal(SPELL_AURA_MOD_STAT), 30);
+
+    unit.SetEnabled(second, false);
+    EXPECT_EQ(unit.GetTotal(SPELL_AURA_MOD_STAT), 10);
+    EXPECT_EQ(unit.GetMaxPositive(SPELL_AURA_MOD_STAT), 10);
+
+    unit.SetEnabled(second, true);
+    EXPECT_EQ(unit.GetTotal(SPELL_AURA_MOD_STAT), 30);
+}
@@ -0,0 +1,209 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DBCStores.h"
+#include "DBCStructure.h"
+#include "Spell.h"
+#include "SpellAuraDefines.h"
+#include "SpellDefines.h"
+#include "SpellInfo.h"
+#include "SpellMgr.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+namespace
+{
+    constexpr uint32 StoreSpellCount = 20000;
+    constexpr uint32 TestRangeIndex = 5;
+
+    SpellEntry MakeSpellEntry(uint32 id)
+    {
+        SpellEntry entry{};
+        entry.Id = id;
+        entry.Attributes = SPELL_ATTR0_PASSIVE;
+        entry.AttributesEx3 = id % 2 ? SPELL_ATTR3_NO_PROC_EQUIP_REQUIREMENT : 0;
+        entry.AuraInterruptFlags = id % 3 ? AURA_INTERRUPT_FLAG_MOVE : 0;
+        entry.ProcFlags = id % 5 ? PROC_FLAG_DONE_MELEE_AUTO_ATTACK : 0;
+        entry.ProcChance = 101;
+        entry.SchoolMask = SPELL_SCHOOL_MASK_FIRE;
+        entry.DmgClass = SPELL_DAMAGE_CLASS_MAGIC;
+        entry.EquippedItemClass = -1;
+        entry.SpellFamilyName = SPELLFAMILY_MAGE;
+        entry.SpellFamilyFlags = flag96(id, 0, 0x20);
+        entry.Effect[EFFECT_0] = SPELL_EFFECT_APPLY_AURA;
+        entry.EffectApplyAuraName[EFFECT_0] = SPELL_AURA_PROC_TRIGGER_SPELL;
+        entry.EffectImplicitTargetA[EFFECT_0] = TARGET_UNIT_CASTER;
+        entry.Effect[EFFECT_1] = SPELL_EFFECT_SCHOOL_DAMAGE;
+        entry.EffectImplicitTargetA[EFFECT_1] = TARGET_UNIT_TARGET_ENEMY;
+        return entry;
+    }
+
+    // The spells of these tests in the SpellMgr stores, loaded like at startup
+    class SpellHotInfoStoreTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            static bool const loaded = LoadStore();
+            ASSERT_TRUE(loaded);
+        }
+
+    private:
+        static bool LoadStore()
+        {
+            // the DBC store owns its entries
+            for (uint32 id = 1; id <= StoreSpellCount; ++id)
+                sSpellStore.SetEntry(id, new SpellEntry(MakeSpellEntry(id)));
+
+            sSpellMgr->LoadSpellInfoStore();
+            sSpellMgr->LoadSpellHotInfoStore();
+            return sSpellMgr->GetSpellInfo(StoreSpellCount) != nullptr;
+        }
+    };
+}
+
+TEST(SpellHotInfoTest, CopiesHotFields)
+{
+    sSpellRangeStore.SetEntry(TestRangeIndex, new SpellRangeEntry{ TestRangeIndex, { 5.0f, 0.0f }, { 30.0f, 40.0f }, SPELL_RANGE_RANGED });
+
+    SpellEntry entry = MakeSpellEntry(7);
+    entry.RangeIndex = TestRangeIndex;
+    entry.EquippedItemClass = ITEM_CLASS_WEAPON;
+    entry.EquippedItemSubClassMask = 1 << ITEM_SUBCLASS_WEAPON_SWORD;
+    entry.AttributesEx = SPELL_ATTR1_IS_CHANNELED;
+    SpellInfo spellInfo(&entry);
+    spellInfo.AttributesCu |= SPELL_ATTR0_CU_ENCOUNTER_REWARD;
+
+    SpellHotInfo hotInfo(&spellInfo);
+
+    EXPECT_EQ(hotInfo.Id, 7u);
+    EXPECT_TRUE(hotInfo.HasAttribute(SPELL_ATTR0_PASSIVE));
+    EXPECT_TRUE(hotInfo.HasAttribute(SPELL_ATTR3_NO_PROC_EQUIP_REQUIREMENT));
+    EXPECT_FALSE(hotInfo.HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT));
+    EXPECT_TRUE(hotInfo.HasAttribute(SPELL_ATTR0_CU_ENCOUNTER_REWARD));
+    EXPECT_EQ(hotInfo.IsChanneled(), spellInfo.IsChanneled());
+    EXPECT_EQ(hotInfo.AuraInterruptFlags, spellInfo.AuraInterruptFlags);
+    EXPECT_EQ(hotInfo.ProcFlags, spellInfo.ProcFlags);
+    EXPECT_EQ(hotInfo.ProcChance, spellInfo.ProcChance);
+    EXPECT_EQ(hotInfo.SchoolMask, spellInfo.SchoolMask);
+    EXPECT_EQ(hotInfo.DmgClass, spellInfo.DmgClass);
+    EXPECT_EQ(hotInfo.SpellFamilyName, spellInfo.SpellFamilyName);
+    EXPECT_TRUE(hotInfo.SpellFamilyFlags == spellInfo.SpellFamilyFlags);
+    EXPECT_EQ(hotInfo.EquippedItemClass, spellInfo.EquippedItemClass);
+    EXPECT_EQ(hotInfo.EquippedItemSubClassMask, spellInfo.EquippedItemSubClassMask);
+
+    EXPECT_EQ(hotInfo.RangeId, TestRangeIndex);
+    EXPECT_EQ(hotInfo.RangeFlags, uint8(SPELL_RANGE_RANGED));
+    EXPECT_EQ(hotInfo.MinRange[0], spellInfo.GetMinRange(false));
+    EXPECT_EQ(hotInfo.MinRange[1], spellInfo.GetMinRange(true));
+    EXPECT_EQ(hotInfo.MaxRange[0], spellInfo.GetMaxRange(false));
+    EXPECT_EQ(hotInfo.MaxRange[1], spellInfo.GetMaxRange(true));
+
+    EXPECT_TRUE(hotInfo.HasEffect(SPELL_EFFECT_SCHOOL_DAMAGE));
+    EXPECT_FALSE(hotInfo.HasEffect(SPELL_EFFECT_HEAL));
+    EXPECT_TRUE(hotInfo.HasAura(SPELL_AURA_PROC_TRIGGER_SPELL));
+    EXPECT_FALSE(hotInfo.HasAura(SPELL_AURA_DUMMY));
+
+    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+    {
+        EXPECT_EQ(hotInfo.Effect[i], spellInfo.Effects[i].Effect);
+        EXPECT_EQ(hotInfo.TargetA[i], spellInfo.Effects[i].TargetA.GetTarget());
+        EXPECT_EQ(hotInfo.TargetB[i], spellInfo.Effects[i].TargetB.GetTarget());
+        EXPECT_EQ((hotInfo.AuraEffectMask & (1 << i)) != 0, spellInfo.Effects[i].IsAura());
+    }
+
+    // without range entry both ranges are 0, like SpellInfo::GetMinRange and GetMaxRange
+    entry.RangeIndex = 0;
+    SpellInfo noRangeInfo(&entry);
+    SpellHotInfo noRange(&noRangeInfo);
+    EXPECT_EQ(noRange.RangeId, 0u);
+    EXPECT_EQ(noRange.MaxRange[0], 0.0f);
+    EXPECT_EQ(noRange.MaxRange[1], 0.0f);
+}
+
+TEST_F(SpellHotInfoStoreTest, StoreFollowsSpellInfos)
+{
+    for (uint32 id = 1; id <= StoreSpellCount; id += 997)
+    {
+        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(id);
+        ASSERT_NE(spellInfo, nullptr);
+
+        SpellHotInfo const& hotInfo = sSpellMgr->GetSpellHotInfo(spellInfo);
+        EXPECT_EQ(hotInfo.Id, id);
+        EXPECT_EQ(hotInfo.AuraInterruptFlags, spellInfo->AuraInterruptFlags);
+        EXPECT_TRUE(hotInfo.SpellFamilyFlags == spellInfo->SpellFamilyFlags);
+    }
+
+    // a loaded attribute changed like DisableMgr does, the record follows once refreshed
+    SpellInfo* spellInfo = const_cast<SpellInfo*>(sSpellMgr->GetSpellInfo(42));
+    uint32 const attributesCu = spellInfo->AttributesCu;
+    spellInfo->AttributesCu |= SPELL_ATTR0_CU_IGNORE_ARMOR;
+    EXPECT_FALSE(sSpellMgr->GetSpellHotInfo(spellInfo).HasAttribute(SPELL_ATTR0_CU_IGNORE_ARMOR));
+
+    sSpellMgr->UpdateSpellHotInfo(spellInfo);
+    EXPECT_TRUE(sSpellMgr->GetSpellHotInfo(spellInfo).HasAttribute(SPELL_ATTR0_CU_IGNORE_ARMOR));
+    EXPECT_EQ(sSpellMgr->GetSpellHotInfo(sSpellMgr->GetSpellInfo(43)).Id, 43u);
+
+    spellInfo->AttributesCu = attributesCu;
+    sSpellMgr->UpdateSpellHotInfo(spellInfo);
+}
+
+// An aura interrupt and proc filter loop over the auras of many units, reading the spells from the SpellMgr
+// store once through their SpellInfo and once through SpellMgr::GetSpellHotInfo. Timing only, so it is disabled:
+// run it with --gtest_also_run_disabled_tests, the times are test properties in the --gtest_output=xml report.
+TEST_F(SpellHotInfoStoreTest, DISABLED_CastProcLoopBenchmark)
+{
+    constexpr uint32 AuraCount = 200000;
+
+    // auras of many units, in no particular spell order
+    std::mt19937 random(42);
+    std::uniform_int_distribution<uint32> spellId(1, StoreSpellCount);
+    std::vector<SpellInfo const*> auras(AuraCount);
+    std::generate(auras.begin(), auras.end(), [&]() { return sSpellMgr->GetSpellInfo(spellId(random)); });
+
+    auto measure = [&](auto&& check)
+    {
+        auto start = std::chrono::steady_clock::now();
+        uint32 matches = 0;
+        for (SpellInfo const* spellInfo : auras)
+            matches += check(spellInfo) ? 1 : 0;
+
+        return std::make_pair(matches, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    auto [coldMatches, coldTime] = measure([](SpellInfo const* spellInfo)
+    {
+        return (spellInfo->AuraInterruptFlags & AURA_INTERRUPT_FLAG_MOVE) || ((spellInfo->ProcFlags & PROC_FLAG_DONE_MELEE_AUTO_ATTACK)
+            && !spellInfo->HasAttribute(SPELL_ATTR3_NO_PROC_EQUIP_REQUIREMENT) && spellInfo->HasAura(SPELL_AURA_PROC_TRIGGER_SPELL));
+    });
+
+    auto [hotMatches, hotTime] = measure([](SpellInfo const* spellInfo)
+    {
+        SpellHotInfo const& hotInfo = sSpellMgr->GetSpellHotInfo(spellInfo);
+        return (hotInfo.AuraInterruptFlags & AURA_INTERRUPT_FLAG_MOVE) || ((hotInfo.ProcFlags & PROC_FLAG_DONE_MELEE_AUTO_ATTACK)
+            && !hotInfo.HasAttribute(SPELL_ATTR3_NO_PROC_EQUIP_REQUIREMENT) && hotInfo.HasAura(SPELL_AURA_PROC_TRIGGER_SPELL));
+    });
+
+    EXPECT_EQ(coldMatches, hotMatches);
+
+    RecordProperty("SpellInfoMicroseconds", std::to_string(coldTime));
+    RecordProperty("SpellHotInfoMicroseconds", std::to_string(hotTime));
+    RecordProperty("SpellInfoBytes", std::to_string(sizeof(SpellInfo)));
+    RecordProperty("SpellHotInfoBytes", std::to_string(sizeof(SpellHotInfo)));
+}
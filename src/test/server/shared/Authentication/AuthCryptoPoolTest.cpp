@@ -0,0 +1,158 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuthCryptoPool.h"
+#include "CryptoRandom.h"
+#include "SRP6.h"
+#include "gtest/gtest.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    // Keeps the single worker busy until Release() so the following tasks stay queued
+    struct BlockingTask
+    {
+        std::promise<void> Started;
+        std::promise<void> Gate;
+
+        std::future<void> Enqueue(AuthCryptoPool& pool)
+        {
+            std::shared_future<void> gate = Gate.get_future().share();
+            std::future<void> result = pool.Enqueue([this, gate]()
+            {
+                Started.set_value();
+                gate.wait();
+            });
+
+            Started.get_future().wait();
+            return result;
+        }
+
+        void Release() { Gate.set_value(); }
+    };
+}
+
+TEST(AuthCryptoPoolTest, DisabledRunsInline)
+{
+    AuthCryptoPool pool;
+    pool.Start(0, 0);
+
+    bool done = false;
+    std::future<void> result = pool.Enqueue([&done]() { done = true; });
+
+    EXPECT_TRUE(done);
+    EXPECT_EQ(result.wait_for(0s), std::future_status::ready);
+
+    pool.Stop();
+}
+
+TEST(AuthCryptoPoolTest, FullQueueRunsInline)
+{
+    AuthCryptoPool pool;
+    pool.Start(1, 2);
+
+    BlockingTask blocker;
+    std::future<void> blocked = blocker.Enqueue(pool);
+
+    std::future<void> first = pool.Enqueue([]() { });
+    std::future<void> second = pool.Enqueue([]() { });
+    std::future<void> inlined = pool.Enqueue([]() { });
+
+    EXPECT_NE(first.wait_for(0s), std::future_status::ready);
+    EXPECT_NE(second.wait_for(0s), std::future_status::ready);
+    EXPECT_EQ(inlined.wait_for(0s), std::future_status::ready);
+
+    blocker.Release();
+    pool.Stop();
+
+    EXPECT_NO_THROW(blocked.get());
+    EXPECT_NO_THROW(first.get());
+    EXPECT_NO_THROW(second.get());
+}
+
+TEST(AuthCryptoPoolTest, StopRunsQueuedTasks)
+{
+    AuthCryptoPool pool;
+    pool.Start(1, 100);
+
+    BlockingTask blocker;
+    std::future<void> blocked = blocker.Enqueue(pool);
+
+    std::atomic<uint32> ran{ 0 };
+    std::vector<std::future<void>> results;
+    for (uint32 i = 0; i < 50; ++i)
+        results.push_back(pool.Enqueue([&ran]() { ++ran; }));
+
+    // Stop() waits for the workers, give it time to start before releasing the blocked one
+    std::thread stopper([&pool]() { pool.Stop(); });
+    std::this_thread::sleep_for(100ms);
+    blocker.Release();
+    stopper.join();
+
+    EXPECT_EQ(ran, 50u);
+    EXPECT_NO_THROW(blocked.get());
+    for (std::future<void>& result : results)
+        EXPECT_NO_THROW(result.get());
+
+    // stopped pool works inline
+    bool done = false;
+    pool.Enqueue([&done]() { done = true; }).get();
+    EXPECT_TRUE(done);
+}
+
+// A login storm without the network, each logon does the SRP6 work of a challenge and a proof through the
+// pool, inline and with 4 workers. Timing only, so it is disabled: run it with --gtest_also_run_disabled_tests,
+// the logons per second are test properties in the --gtest_output=xml report.
+TEST(AuthCryptoPoolTest, DISABLED_LoginStormBenchmark)
+{
+    constexpr uint32 Logons = 2000;
+
+    auto [salt, verifier] = Warhead::Crypto::SRP6::MakeRegistrationData("STORM", "STORM");
+
+    auto measure = [&, salt = salt, verifier = verifier](uint32 threads)
+    {
+        AuthCryptoPool pool;
+        pool.Start(threads, Logons);
+
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::future<void>> results;
+        results.reserve(Logons);
+        for (uint32 i = 0; i < Logons; ++i)
+        {
+            results.push_back(pool.Enqueue([&]()
+            {
+                Warhead::Crypto::SRP6 srp6("STORM", salt, verifier);
+                srp6.VerifyChallengeResponse(Warhead::Crypto::GetRandomBytes<Warhead::Crypto::SRP6::EPHEMERAL_KEY_LENGTH>(), {});
+            }));
+        }
+
+        for (std::future<void>& result : results)
+            result.get();
+
+        float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+        pool.Stop();
+        return Logons / seconds;
+    };
+
+    float inlineRate = measure(0);
+    float pooledRate = measure(4);
+
+    RecordProperty("InlineLogonsPerSecond", std::to_string(inlineRate));
+    RecordProperty("PooledLogonsPerSecond", std::to_string(pooledRate));
+}
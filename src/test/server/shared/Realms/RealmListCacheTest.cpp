@@ -0,0 +1,145 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RealmListCache.h"
+#include "IpAddress.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    typedef CharacterCountCache::Clock Clock;
+
+    // Stands in for AuthSession::BuildRealmList: a byte of characters per realm, after the realm id
+    ByteBuffer BuildPacket(RealmList::RealmMap const& realms, RealmListPacketCache::CharacterCountPositions& positions, uint32& builds)
+    {
+        ++builds;
+
+        ByteBuffer packet;
+        for (auto const& [id, realm] : realms)
+        {
+            packet << uint32(id.Realm);
+            positions.emplace_back(packet.wpos(), id.Realm);
+            packet << uint8(0);
+        }
+
+        return packet;
+    }
+
+    std::shared_ptr<RealmList::RealmMap const> MakeRealms(std::initializer_list<uint32> ids)
+    {
+        auto realms = std::make_shared<RealmList::RealmMap>();
+        for (uint32 id : ids)
+            (*realms)[RealmHandle(id)].Id = RealmHandle(id);
+
+        return realms;
+    }
+}
+
+TEST(RealmListCacheTest, CharacterCountsExpire)
+{
+    CharacterCountCache cache;
+    Clock::time_point now = Clock::now();
+
+    EXPECT_FALSE(cache.Get(1, now));
+
+    cache.Store(1, { { 1, 3 }, { 2, 1 } }, 30s, now);
+
+    Optional<RealmCharacterCountMap> counts = cache.Get(1, now + 30s);
+    ASSERT_TRUE(counts);
+    EXPECT_EQ((*counts)[1], 3);
+    EXPECT_EQ((*counts)[2], 1);
+
+    EXPECT_FALSE(cache.Get(2, now));
+    EXPECT_FALSE(cache.Get(1, now + 31s));
+}
+
+TEST(RealmListCacheTest, CharacterCountsClearAndDisabled)
+{
+    CharacterCountCache cache;
+    Clock::time_point now = Clock::now();
+
+    // a character created or deleted on logon drops the counts of the account
+    cache.Store(1, { { 1, 3 } }, 30s, now);
+    cache.Store(2, { { 1, 5 } }, 30s, now);
+    cache.Clear(1);
+    EXPECT_FALSE(cache.Get(1, now));
+    EXPECT_TRUE(cache.Get(2, now));
+
+    // a cache time of 0 turns the cache off
+    cache.Store(3, { { 1, 1 } }, 0s, now);
+    EXPECT_FALSE(cache.Get(3, now));
+    EXPECT_EQ(cache.GetSize(), 1u);
+}
+
+TEST(RealmListCacheTest, CharacterCountsPurgeExpiredAccounts)
+{
+    CharacterCountCache cache;
+    Clock::time_point now = Clock::now();
+
+    for (uint32 account = 0; account < 1000; ++account)
+        cache.Store(account, { { 1, 1 } }, 10s, now);
+
+    EXPECT_EQ(cache.GetSize(), 1000u);
+
+    // the 1024th insert purges the accounts which expired by then
+    for (uint32 account = 1000; account < 1024; ++account)
+        cache.Store(account, { { 1, 1 } }, 10s, now + 1min);
+
+    EXPECT_EQ(cache.GetSize(), 24u);
+    EXPECT_TRUE(cache.Get(1023, now + 1min));
+}
+
+TEST(RealmListCacheTest, PacketBuiltOncePerRealmListUpdate)
+{
+    RealmListPacketCache cache;
+    uint32 builds = 0;
+
+    std::shared_ptr<RealmList::RealmMap const> realms = MakeRealms({ 1, 2 });
+    auto build = [&](RealmList::RealmMap const& map) { return [&](RealmListPacketCache::CharacterCountPositions& positions) { return BuildPacket(map, positions, builds); }; };
+
+    ByteBuffer first = cache.Get(12340, 2, SEC_PLAYER, realms, { { 1, 4 } }, build(*realms));
+    ByteBuffer second = cache.Get(12340, 2, SEC_PLAYER, realms, { { 2, 7 } }, build(*realms));
+    EXPECT_EQ(builds, 1u);
+
+    // counts of the request, realms without characters keep 0
+    EXPECT_EQ(first.read<uint8>(4), 4);
+    EXPECT_EQ(first.read<uint8>(9), 0);
+    EXPECT_EQ(second.read<uint8>(4), 0);
+    EXPECT_EQ(second.read<uint8>(9), 7);
+
+    // another build or security level has a packet of its own
+    ByteBuffer gameMaster = cache.Get(12340, 2, SEC_GAMEMASTER, realms, {}, build(*realms));
+    ByteBuffer otherBuild = cache.Get(11723, 2, SEC_PLAYER, realms, {}, build(*realms));
+    EXPECT_EQ(builds, 3u);
+    EXPECT_EQ(gameMaster.read<uint8>(4), 0);
+    EXPECT_EQ(otherBuild.read<uint8>(4), 0);
+
+    // an update publishes a new map, even with the same realms
+    std::shared_ptr<RealmList::RealmMap const> updated = MakeRealms({ 1, 2, 3 });
+    ByteBuffer third = cache.Get(12340, 2, SEC_PLAYER, updated, { { 3, 2 } }, build(*updated));
+    EXPECT_EQ(builds, 4u);
+    EXPECT_EQ(third.size(), 15u);
+    EXPECT_EQ(third.read<uint8>(14), 2);
+}
+
+TEST(RealmListCacheTest, EmptyBeforeInitialize)
+{
+    // nothing loaded before Initialize
+    EXPECT_FALSE(sRealmList->GetRealm(RealmHandle(1)));
+    ASSERT_TRUE(sRealmList->GetRealms());
+    EXPECT_TRUE(sRealmList->GetRealms()->empty());
+}
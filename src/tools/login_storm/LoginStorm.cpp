@@ -0,0 +1,352 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Fires logons at an authserver from many connections at once, the way clients
+ * reconnect after a worldserver restart, and reports logon throughput and latency.
+ *
+ * With --password the logon proofs are real and the logons succeed. Without it the
+ * proofs are random: the server still does all of its SRP6 math before rejecting
+ * them, but every logon then counts as a failed login for the account, so disable
+ * WrongPass.MaxCount on the test realm.
+ */
+
+#include "AuthDefines.h"
+#include "BigNumber.h"
+#include "CryptoHash.h"
+#include "CryptoRandom.h"
+#include "SRP6.h"
+#include "Util.h"
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using boost::asio::ip::tcp;
+using SHA1 = Warhead::Crypto::SHA1;
+using SRP6 = Warhead::Crypto::SRP6;
+
+namespace
+{
+    struct StormOptions
+    {
+        std::string Host = "127.0.0.1";
+        std::string Port = "3724";
+        std::string Account;
+        std::string Password;
+        uint32 Connections = 100;
+        uint32 Logons = 1000;
+        uint16 Build = 12340;
+    };
+
+    struct StormStats
+    {
+        std::atomic<uint32> Succeeded{ 0 };
+        std::atomic<uint32> Rejected{ 0 };
+        std::atomic<uint32> Errors{ 0 };
+    };
+
+    // Answer times in microseconds, one list per connection merged at the end
+    struct StormLatencies
+    {
+        std::vector<uint64> Challenge;
+        std::vector<uint64> Proof;
+        std::vector<uint64> Logon;
+
+        void Merge(StormLatencies const& other)
+        {
+            Challenge.insert(Challenge.end(), other.Challenge.begin(), other.Challenge.end());
+            Proof.insert(Proof.end(), other.Proof.begin(), other.Proof.end());
+            Logon.insert(Logon.end(), other.Logon.begin(), other.Logon.end());
+        }
+    };
+
+    void PrintLatencies(char const* name, std::vector<uint64>& times)
+    {
+        if (times.empty())
+            return;
+
+        std::sort(times.begin(), times.end());
+
+        // nearest rank
+        auto percentile = [&times](uint32 percent) { return (unsigned long long)times[(times.size() * percent + 99) / 100 - 1]; };
+
+        uint64 total = 0;
+        for (uint64 time : times)
+            total += time;
+
+        printf("%-9s avg %lluus, p50 %lluus, p95 %lluus, p99 %lluus, max %lluus\n", name, (unsigned long long)(total / times.size()),
+            percentile(50), percentile(95), percentile(99), (unsigned long long)times.back());
+    }
+
+    uint64 MicrosecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Same as SRP6::SHA1Interleave, the client has to derive the session key the same way
+    SessionKey SHA1Interleave(SRP6::EphemeralKey const& S)
+    {
+        std::array<uint8, SRP6::EPHEMERAL_KEY_LENGTH / 2> buf0, buf1;
+        for (size_t i = 0; i < SRP6::EPHEMERAL_KEY_LENGTH / 2; ++i)
+        {
+            buf0[i] = S[2 * i + 0];
+            buf1[i] = S[2 * i + 1];
+        }
+
+        size_t p = 0;
+        while (p < SRP6::EPHEMERAL_KEY_LENGTH && !S[p]) { ++p; }
+        if (p & 1) { ++p; }
+        p /= 2;
+
+        SHA1::Digest const hash0 = SHA1::GetDigestOf(buf0.data() + p, SRP6::EPHEMERAL_KEY_LENGTH / 2 - p);
+        SHA1::Digest const hash1 = SHA1::GetDigestOf(buf1.data() + p, SRP6::EPHEMERAL_KEY_LENGTH / 2 - p);
+
+        SessionKey K;
+        for (size_t i = 0; i < SHA1::DIGEST_LENGTH; ++i)
+        {
+            K[2 * i + 0] = hash0[i];
+            K[2 * i + 1] = hash1[i];
+        }
+        return K;
+    }
+
+    std::vector<uint8> BuildLogonChallenge(StormOptions const& options)
+    {
+        std::vector<uint8> packet;
+        auto append = [&packet](auto value) { uint8 const* bytes = reinterpret_cast<uint8 const*>(&value); packet.insert(packet.end(), bytes, bytes + sizeof(value)); };
+
+        append(uint8(0x00));                                    // AUTH_LOGON_CHALLENGE
+        append(uint8(0x08));                                    // error
+        append(uint16(30 + options.Account.size()));            // size of the rest
+        append(uint32('W' | 'o' << 8 | 'W' << 16));             // game name
+        append(uint8(3)); append(uint8(3)); append(uint8(5));   // version
+        append(options.Build);
+        append(uint32('6' | '8' << 8 | 'x' << 16));             // platform, reversed
+        append(uint32('n' | 'i' << 8 | 'W' << 16));             // os, reversed
+        append(uint32('S' | 'U' << 8 | 'n' << 16 | 'e' << 24)); // country, reversed
+        append(uint32(0));                                      // timezone bias
+        append(uint32(0x0100007F));                             // ip
+        append(uint8(options.Account.size()));
+        packet.insert(packet.end(), options.Account.begin(), options.Account.end());
+        return packet;
+    }
+
+    // Returns false on a protocol or network error, rejected logons only count as rejected
+    bool RunLogon(boost::asio::io_context& ioContext, tcp::resolver::results_type const& endpoints, StormOptions const& options, StormStats& stats, StormLatencies& latencies)
+    {
+        tcp::socket socket(ioContext);
+        boost::asio::connect(socket, endpoints);
+
+        auto start = std::chrono::steady_clock::now();
+
+        boost::asio::write(socket, boost::asio::buffer(BuildLogonChallenge(options)));
+
+        std::array<uint8, 3> header;
+        boost::asio::read(socket, boost::asio::buffer(header));
+        if (header[0] != 0x00)
+            return false;
+
+        if (header[2] != 0x00)                                  // WOW_SUCCESS
+        {
+            ++stats.Rejected;
+            return true;
+        }
+
+        SRP6::EphemeralKey B;
+        std::array<uint8, 1 + 1 + 1 + 32> gN;                  // g length, g, N length, N
+        SRP6::Salt salt;
+        std::array<uint8, 16 + 1> versionChallenge;             // version challenge, security flags
+        boost::asio::read(socket, boost::asio::buffer(B));
+        boost::asio::read(socket, boost::asio::buffer(gN));
+        boost::asio::read(socket, boost::asio::buffer(salt));
+        boost::asio::read(socket, boost::asio::buffer(versionChallenge));
+        if (versionChallenge[16] != 0)
+        {
+            printf("Account %s requires a security token, use an account without one\n", options.Account.c_str());
+            return false;
+        }
+
+        latencies.Challenge.push_back(MicrosecondsSince(start));
+
+        SRP6::EphemeralKey A;
+        SHA1::Digest M1;
+        if (!options.Password.empty())
+        {
+            // S = (B - 3 * g^x) ^ (a + u * x), the client side of SRP6::VerifyChallengeResponse
+            BigNumber const g(SRP6::g);
+            BigNumber const N(SRP6::N);
+            BigNumber const x(SHA1::GetDigestOf(salt, SHA1::GetDigestOf(options.Account, ":", options.Password)));
+
+            BigNumber a;
+            a.SetRand(19 * 8);
+            A = g.ModExp(a, N).ToByteArray<SRP6::EPHEMERAL_KEY_LENGTH>();
+
+            BigNumber const u(SHA1::GetDigestOf(A, B));
+            BigNumber const base = (BigNumber(B) + N * 3 - g.ModExp(x, N) * 3) % N;
+            SRP6::EphemeralKey const S = base.ModExp(a + u * x, N).ToByteArray<SRP6::EPHEMERAL_KEY_LENGTH>();
+            SessionKey const K = SHA1Interleave(S);
+
+            SHA1::Digest const NHash = SHA1::GetDigestOf(SRP6::N);
+            SHA1::Digest const gHash = SHA1::GetDigestOf(SRP6::g);
+            SHA1::Digest NgHash;
+            std::transform(NHash.begin(), NHash.end(), gHash.begin(), NgHash.begin(), std::bit_xor<>());
+
+            M1 = SHA1::GetDigestOf(NgHash, SHA1::GetDigestOf(options.Account), salt, A, B, K);
+        }
+        else
+        {
+            A = Warhead::Crypto::GetRandomBytes<SRP6::EPHEMERAL_KEY_LENGTH>();
+            M1 = Warhead::Crypto::GetRandomBytes<SHA1::DIGEST_LENGTH>();
+        }
+
+        auto proofStart = std::chrono::steady_clock::now();
+
+        std::vector<uint8> proof;
+        proof.push_back(0x01);                                  // AUTH_LOGON_PROOF
+        proof.insert(proof.end(), A.begin(), A.end());
+        proof.insert(proof.end(), M1.begin(), M1.end());
+        proof.resize(proof.size() + SHA1::DIGEST_LENGTH + 2);   // crc hash, number of keys, security flags
+        boost::asio::write(socket, boost::asio::buffer(proof));
+
+        std::array<uint8, 2> result;
+        boost::asio::read(socket, boost::asio::buffer(result));
+        if (result[0] != 0x01)
+            return false;
+
+        latencies.Proof.push_back(MicrosecondsSince(proofStart));
+        latencies.Logon.push_back(MicrosecondsSince(start));
+
+        if (result[1] == 0x00)
+            ++stats.Succeeded;
+        else
+            ++stats.Rejected;
+
+        return true;
+    }
+
+    bool HandleArgs(int argc, char** argv, StormOptions& options)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            std::string_view const param = argv[i];
+            char const* value = argv[i + 1];
+
+            if (param == "--host")
+                options.Host = value;
+            else if (param == "--port")
+                options.Port = value;
+            else if (param == "--account")
+                options.Account = value;
+            else if (param == "--password")
+                options.Password = value;
+            else if (param == "--connections")
+                options.Connections = std::max(1, atoi(value));
+            else if (param == "--logons")
+                options.Logons = std::max(1, atoi(value));
+            else if (param == "--build")
+                options.Build = uint16(atoi(value));
+            else
+                return false;
+        }
+
+        if (!(argc % 2) || options.Account.empty())
+            return false;
+
+        Utf8ToUpperOnlyLatin(options.Account);
+        Utf8ToUpperOnlyLatin(options.Password);
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    StormOptions options;
+    if (!HandleArgs(argc, argv, options))
+    {
+        printf("usage: %s --account <name> [--password <password>] [--host 127.0.0.1] [--port 3724]\n"
+            "    [--connections 100] [--logons 1000] [--build 12340]\n", argv[0]);
+        return 1;
+    }
+
+    boost::asio::io_context ioContext;
+    tcp::resolver::results_type endpoints;
+    try
+    {
+        endpoints = tcp::resolver(ioContext).resolve(options.Host, options.Port);
+    }
+    catch (std::exception const& e)
+    {
+        printf("Could not resolve %s:%s: %s\n", options.Host.c_str(), options.Port.c_str(), e.what());
+        return 1;
+    }
+
+    printf("Sending %u logons for %s to %s:%s over %u connections\n", options.Logons, options.Account.c_str(),
+        options.Host.c_str(), options.Port.c_str(), options.Connections);
+
+    StormStats stats;
+    std::atomic<int32> remaining{ int32(options.Logons) };
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<StormLatencies> latencies(options.Connections);
+    std::vector<std::thread> connections;
+    for (uint32 i = 0; i < options.Connections; ++i)
+    {
+        connections.emplace_back([&, &connectionLatencies = latencies[i]]()
+        {
+            while (remaining.fetch_sub(1) > 0)
+            {
+                try
+                {
+                    if (!RunLogon(ioContext, endpoints, options, stats, connectionLatencies))
+                        ++stats.Errors;
+                }
+                catch (std::exception const&)
+                {
+                    ++stats.Errors;
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : connections)
+        thread.join();
+
+    float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    uint32 answered = stats.Succeeded + stats.Rejected;
+
+    printf("%u logons in %.2fs: %.1f logons/s, %u succeeded, %u rejected, %u errors\n", options.Logons, seconds,
+        seconds > 0.0f ? answered / seconds : 0.0f, stats.Succeeded.load(), stats.Rejected.load(), stats.Errors.load());
+
+    StormLatencies total;
+    for (StormLatencies const& connectionLatencies : latencies)
+        total.Merge(connectionLatencies);
+
+    PrintLatencies("challenge", total.Challenge);
+    PrintLatencies("proof", total.Proof);
+    PrintLatencies("logon", total.Logon);
+
+    return stats.Errors ? 1 : 0;
+}